@@ -0,0 +1,262 @@
+/**
+ * @file
+ * @brief Definition of the benchmark helpers and the counting replacement for the global allocation functions.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] Added MakeJsonDocument().
+ * @date 2026-10-19 [JFDR] Threads can be excluded from the allocation counters.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <curl/curl.h>
+#include "BenchSupport.hpp"
+
+namespace
+{
+    std::atomic<uint64_t> g_allocationCount(0u);
+    std::atomic<uint64_t> g_allocationBytes(0u);
+
+    /// Cleared on threads whose allocations must not be counted, such as the loopback server thread.
+    thread_local bool t_countAllocations = true;
+
+    inline void* CountedAllocate(std::size_t size)
+    {
+        if (t_countAllocations)
+        {
+            g_allocationCount.fetch_add(1u, std::memory_order_relaxed);
+            g_allocationBytes.fetch_add(size, std::memory_order_relaxed);
+        }
+        void* ptr = std::malloc((size != 0u) ? size : 1u);
+        if (ptr == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+        return ptr;
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    return CountedAllocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return CountedAllocate(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return CountedAllocate(size);
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return CountedAllocate(size);
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        namespace Bench
+        {
+            using std::string;
+            using nlohmann::json;
+
+            AllocationCounters GetAllocationCounters()
+            {
+                AllocationCounters result;
+                result.allocations = g_allocationCount.load(std::memory_order_relaxed);
+                result.bytes = g_allocationBytes.load(std::memory_order_relaxed);
+                return result;
+            }
+
+            void ExcludeThreadFromAllocationCounters()
+            {
+                t_countAllocations = false;
+            }
+
+            uint64_t NowNanoseconds()
+            {
+                return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>
+                (
+                    std::chrono::steady_clock::now().time_since_epoch()
+                ).count();
+            }
+
+            string MakeJsonDocument(size_t sizeBytes)
+            {
+                // The records are serialised one at a time, so that large documents don't need a second copy.
+                string text("[");
+                text.reserve(sizeBytes + 256u);
+                for (size_t index = 0u; text.size() < sizeBytes; ++index)
+                {
+                    json record;
+                    record["id"] = index;
+                    record["name"] = "record " + std::to_string(index);
+                    record["active"] = (index % 3u) != 0u;
+                    record["score"] = (double)index / 7.0;
+                    record["offset"] = -(long long)index;
+                    record["tags"] = { "alpha", "beta", "gamma \xC3\xA9" };
+                    record["parent"] = nullptr;
+                    if (index > 0u)
+                    {
+                        text.push_back(',');
+                    }
+                    text.append(record.dump());
+                }
+                text.push_back(']');
+                return text;
+            }
+
+            ////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // LatencyRecorder
+            ////////////////////////////////////////////////////////////////////////////////////////////////////////
+            LatencyRecorder::LatencyRecorder(size_t expectedSamples)
+                :   _sorted(true)
+            {
+                this->_samples.reserve(expectedSamples);
+            }
+
+            uint64_t LatencyRecorder::Percentile(double percentile)
+            {
+                if (this->_samples.empty())
+                {
+                    return 0u;
+                }
+
+                if (!this->_sorted)
+                {
+                    std::sort(this->_samples.begin(), this->_samples.end());
+                    this->_sorted = true;
+                }
+
+                // Nearest-rank method.
+                double rank = std::ceil((percentile / 100.0) * (double)this->_samples.size());
+                size_t index = (rank < 1.0) ? 0u : (size_t)rank - 1u;
+                return this->_samples[std::min(index, this->_samples.size() - 1u)];
+            }
+
+            json LatencyRecorder::ToJson()
+            {
+                double total = 0.0;
+                for (uint64_t sample : this->_samples)
+                {
+                    total += (double)sample;
+                }
+
+                json result;
+                result["count"] = this->_samples.size();
+                result["mean_us"] = this->_samples.empty() ? 0.0 : (total / (double)this->_samples.size()) / 1000.0;
+                result["p50_us"] = Percentile(50.0) / 1000.0;
+                result["p90_us"] = Percentile(90.0) / 1000.0;
+                result["p99_us"] = Percentile(99.0) / 1000.0;
+                result["p999_us"] = Percentile(99.9) / 1000.0;
+                result["max_us"] = Percentile(100.0) / 1000.0;
+                return result;
+            }
+
+            ////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // BenchArgs
+            ////////////////////////////////////////////////////////////////////////////////////////////////////////
+            BenchArgs::BenchArgs(int argc, char* argv[])
+            {
+                for (int argIndex = 1; argIndex < argc; ++argIndex)
+                {
+                    string arg(argv[argIndex]);
+                    if ((arg.size() < 3u) || (arg.compare(0u, 2u, "--") != 0))
+                    {
+                        continue;
+                    }
+
+                    string name(arg.substr(2u));
+                    if ((argIndex + 1 < argc) && (::strncmp(argv[argIndex + 1], "--", 2u) != 0))
+                    {
+                        this->_values[name] = argv[++argIndex];
+                    }
+                    else
+                    {
+                        this->_values[name] = "1";
+                    }
+                }
+            }
+
+            long long BenchArgs::GetNumber(const string& name, long long defaultValue) const
+            {
+                auto iter = this->_values.find(name);
+                return (iter == this->_values.end()) ? defaultValue : ::strtoll(iter->second.c_str(), nullptr, 10);
+            }
+
+            string BenchArgs::GetString(const string& name, const string& defaultValue) const
+            {
+                auto iter = this->_values.find(name);
+                return (iter == this->_values.end()) ? defaultValue : iter->second;
+            }
+
+            bool BenchArgs::Has(const string& name) const
+            {
+                return this->_values.find(name) != this->_values.end();
+            }
+
+            ////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // BenchReport
+            ////////////////////////////////////////////////////////////////////////////////////////////////////////
+            BenchReport::BenchReport(const string& benchmarkName)
+            {
+                this->_document["benchmark"] = benchmarkName;
+                this->_document["libcurl"] = curl_version_info(CURLVERSION_NOW)->version;
+                this->_document["results"] = json::array();
+            }
+
+            void BenchReport::Add(const json& result)
+            {
+                this->_document["results"].push_back(result);
+            }
+
+            void BenchReport::Print(std::ostream& os) const
+            {
+                os << this->_document.dump(2) << std::endl;
+            }
+        } // namespace Bench
+    } // namespace Web
+} // namespace AbcdEFramework
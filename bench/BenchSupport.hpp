@@ -0,0 +1,213 @@
+/**
+ * @file
+ * @brief Helpers shared by the benchmark programs: timing, allocation counting, argument parsing and JSON reports.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] Added MakeJsonDocument().
+ */
+#if !defined BENCH_SUPPORT_29D2FDBE499142A5A8335E09232C3669
+#define BENCH_SUPPORT_29D2FDBE499142A5A8335E09232C3669 1
+
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+#include <json.hpp>
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+#endif
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        namespace Bench
+        {
+            /**
+             * @brief Snapshot of the global allocation counters.
+             * @remark The counters are maintained by the replacement \c operator \c new that is linked into every
+             *      benchmark program. Allocations made by threads that called \c ExcludeThreadFromAllocationCounters()
+             *      are not counted.
+             */
+            struct AllocationCounters
+            {
+                uint64_t allocations; ///< Number of calls to \c operator \c new.
+                uint64_t bytes; ///< Number of bytes requested from \c operator \c new.
+
+                /**
+                 * @brief Get the difference between this snapshot and an earlier one.
+                 */
+                inline AllocationCounters operator-(const AllocationCounters& earlier) const;
+            };
+
+            inline AllocationCounters AllocationCounters::operator-(const AllocationCounters& earlier) const
+            {
+                AllocationCounters result;
+                result.allocations = this->allocations - earlier.allocations;
+                result.bytes = this->bytes - earlier.bytes;
+                return result;
+            }
+
+            /**
+             * @brief Read the global allocation counters.
+             */
+            AllocationCounters GetAllocationCounters();
+
+            /**
+             * @brief Stop counting the allocations made by the calling thread.
+             * @remark Threads that serve the benchmarks, such as the loopback server, call it so that the counters
+             *      only reflect the client side.
+             */
+            void ExcludeThreadFromAllocationCounters();
+
+            /**
+             * @brief Read a monotonic clock.
+             * @return Time in nanoseconds since an arbitrary epoch.
+             */
+            uint64_t NowNanoseconds();
+
+            /**
+             * @brief Build a JSON document of at least \c sizeBytes bytes: an array of records like those of a REST API.
+             * @remark Every record has an unsigned, a signed and a floating point number, strings, a boolean, a
+             *      nested array and a null, so that all value types are parsed.
+             */
+            std::string MakeJsonDocument(size_t sizeBytes);
+
+            /**
+             * @brief Read the CPU cycle counter.
+             * @return The time stamp counter on x86, otherwise the monotonic clock in nanoseconds.
+             */
+            inline uint64_t ReadCycleCounter()
+            {
+#if defined(__x86_64__) || defined(__i386__)
+                return __rdtsc();
+#else
+                return NowNanoseconds();
+#endif
+            }
+
+            /**
+             * @brief Prevent the compiler from optimising away the computation of \c value.
+             */
+            template <typename T>
+            inline void DoNotOptimize(const T& value)
+            {
+                asm volatile("" : : "r,m"(value) : "memory");
+            }
+
+            /**
+             * @brief Collects latency samples and reports percentiles.
+             */
+            class LatencyRecorder
+            {
+                private:
+                    std::vector<uint64_t> _samples; ///< Samples in nanoseconds.
+                    bool _sorted; ///< Set if \c _samples is sorted.
+
+                public:
+                    /**
+                     * @brief Construct a recorder with room for \c expectedSamples samples.
+                     */
+                    explicit LatencyRecorder(size_t expectedSamples = 0u);
+
+                public:
+                    /**
+                     * @brief Add a sample.
+                     * @param nanoseconds The latency that was measured.
+                     */
+                    inline void Record(uint64_t nanoseconds);
+
+                    /**
+                     * @brief Get the number of samples.
+                     */
+                    inline size_t Count() const;
+
+                    /**
+                     * @brief Get the value at the given percentile.
+                     * @param percentile Percentile in the range [0..100].
+                     * @return The latency in nanoseconds, or zero if there are no samples.
+                     */
+                    uint64_t Percentile(double percentile);
+
+                    /**
+                     * @brief Describe the distribution as a JSON object with values in microseconds.
+                     */
+                    nlohmann::json ToJson();
+            };
+
+            inline void LatencyRecorder::Record(uint64_t nanoseconds)
+            {
+                this->_samples.push_back(nanoseconds);
+                this->_sorted = false;
+            }
+
+            inline size_t LatencyRecorder::Count() const
+            {
+                return this->_samples.size();
+            }
+
+            /**
+             * @brief Parses command line arguments in the form <tt>--name value</tt>.
+             */
+            class BenchArgs
+            {
+                private:
+                    std::map<std::string, std::string> _values; ///< Values keyed on the argument name without dashes.
+
+                public:
+                    /**
+                     * @brief Parse the command line.
+                     */
+                    BenchArgs(int argc, char* argv[]);
+
+                public:
+                    /**
+                     * @brief Get a numeric argument.
+                     */
+                    long long GetNumber(const std::string& name, long long defaultValue) const;
+
+                    /**
+                     * @brief Get a string argument.
+                     */
+                    std::string GetString(const std::string& name, const std::string& defaultValue) const;
+
+                    /**
+                     * @brief Check if an argument was given.
+                     */
+                    bool Has(const std::string& name) const;
+            };
+
+            /**
+             * @brief Collects the results of a benchmark program and prints them as one JSON document.
+             * @remark The document has the form
+             *      <tt>{"benchmark": name, "libcurl": version, "results": [{"name": ..., ...}, ...]}</tt>
+             *      so that the output of two runs can be compared entry by entry.
+             */
+            class BenchReport
+            {
+                private:
+                    nlohmann::json _document; ///< The report.
+
+                public:
+                    /**
+                     * @brief Start a report for the named benchmark program.
+                     */
+                    explicit BenchReport(const std::string& benchmarkName);
+
+                public:
+                    /**
+                     * @brief Add a result. The \c result object must contain a \c name member.
+                     */
+                    void Add(const nlohmann::json& result);
+
+                    /**
+                     * @brief Print the report.
+                     */
+                    void Print(std::ostream& os = std::cout) const;
+            };
+        } // namespace Bench
+    } // namespace Web
+} // namespace AbcdEFramework
+
+#endif // BENCH_SUPPORT_29D2FDBE499142A5A8335E09232C3669
@@ -0,0 +1,766 @@
+/**
+ * @file
+ * @brief Definition of the LoopbackHttpServer methods.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] Added the ndjson query parameter.
+ * @date 2026-10-19 [JFDR] The allocations of the server thread are not counted.
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+#include <vector>
+#include <strings.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "BenchSupport.hpp"
+#include "LoopbackHttpServer.hpp"
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        namespace Bench
+        {
+            using std::string;
+            using std::system_error;
+            using std::chrono::steady_clock;
+
+            namespace
+            {
+                /// Maximum number of bytes we queue in the output buffer of a connection before writing.
+                const size_t OUTPUT_HIGH_WATER = 256u * 1024u;
+
+                /// Maximum size of the request line and headers.
+                const size_t MAX_HEADER_SIZE = 64u * 1024u;
+
+                /**
+                 * @brief Block of bytes used to fill response bodies.
+                 */
+                const string& BodyPattern()
+                {
+                    static const string pattern(64u * 1024u, 'x');
+                    return pattern;
+                }
+
+                /**
+                 * @brief Block of newline delimited JSON records of \c NDJSON_RECORD_SIZE bytes each.
+                 */
+                const string& NdjsonPattern()
+                {
+                    static const string pattern = []()
+                    {
+                        string records;
+                        char record[NDJSON_RECORD_SIZE + 1u];
+                        for (unsigned index = 0u; records.size() + NDJSON_RECORD_SIZE <= 64u * 1024u; ++index)
+                        {
+                            // Padded with spaces before the closing brace to the fixed size.
+                            int length = ::snprintf(record, sizeof(record), "{\"id\":%u,\"name\":\"record\",\"value\":%u.5,\"tags\":[\"a\",\"b\"]", index, index % 1000u);
+                            records.append(record, (size_t)length);
+                            records.append(NDJSON_RECORD_SIZE - 2u - (size_t)length, ' ');
+                            records.append("}\n");
+                        }
+                        return records;
+                    }();
+                    return pattern;
+                }
+
+                /**
+                 * @brief Get the reason phrase for the status codes that the benchmarks use.
+                 */
+                const char* ReasonPhrase(unsigned status)
+                {
+                    switch (status)
+                    {
+                        case 200: return "OK";
+                        case 204: return "No Content";
+                        case 400: return "Bad Request";
+                        case 404: return "Not Found";
+                        case 500: return "Internal Server Error";
+                        case 503: return "Service Unavailable";
+                        default: return "Status";
+                    }
+                }
+
+                /**
+                 * @brief Find the value of a query parameter in a request target.
+                 * @return The numeric value of the parameter, or \c defaultValue if it is not present.
+                 */
+                uint64_t QueryValue(const string& target, const char* name, uint64_t defaultValue)
+                {
+                    size_t queryPos = target.find('?');
+                    size_t nameLen = ::strlen(name);
+                    while (queryPos != string::npos)
+                    {
+                        size_t keyPos = queryPos + 1u;
+                        if ((target.compare(keyPos, nameLen, name) == 0) && (keyPos + nameLen < target.size()) && (target[keyPos + nameLen] == '='))
+                        {
+                            return ::strtoull(target.c_str() + keyPos + nameLen + 1u, nullptr, 10);
+                        }
+                        queryPos = target.find('&', keyPos);
+                    }
+
+                    return defaultValue;
+                }
+
+                /**
+                 * @brief Case-insensitive check whether a header line starts with the given header name.
+                 */
+                bool HeaderIs(const char* line, size_t lineLen, const char* name)
+                {
+                    size_t nameLen = ::strlen(name);
+                    return (lineLen > nameLen) && (line[nameLen] == ':') && (::strncasecmp(line, name, nameLen) == 0);
+                }
+
+                /**
+                 * @brief Get a pointer to the value of a header line, skipping leading white space.
+                 */
+                const char* HeaderValue(const char* line, size_t nameLen)
+                {
+                    const char* value = line + nameLen + 1u;
+                    while ((*value == ' ') || (*value == '\t'))
+                    {
+                        ++value;
+                    }
+                    return value;
+                }
+            }
+
+            /**
+             * @brief State of a single client connection.
+             */
+            struct LoopbackHttpServer::Connection
+            {
+                int fd; ///< Client socket.
+                string input; ///< Bytes received but not consumed yet.
+                string output; ///< Bytes waiting to be sent.
+                size_t outputOffset; ///< Number of bytes in \c output that were already sent.
+                bool readingBody; ///< Set while the body of a request is being consumed.
+                uint64_t requestBodyRemaining; ///< Number of request body bytes still to be consumed.
+                bool closeAfterResponse; ///< Set if the client asked to close the connection.
+                bool delayed; ///< Set while a response is waiting for its delay to expire.
+                steady_clock::time_point due; ///< Time at which a delayed response must be sent.
+                bool responding; ///< Set while a response body is being generated.
+                unsigned status; ///< Status code of the current response.
+                uint64_t bodySize; ///< Size of the body of the current response.
+                uint64_t bodyRemaining; ///< Number of body bytes still to be generated.
+                uint64_t chunkSize; ///< Chunk size of the current response, or zero if not chunked.
+                uint64_t delayMicroseconds; ///< Delay of the current response.
+                bool ndjson; ///< Set if the body of the current response consists of JSON records.
+
+                explicit Connection(int socketFd)
+                    :   fd(socketFd),
+                        outputOffset(0u),
+                        readingBody(false),
+                        requestBodyRemaining(0u),
+                        closeAfterResponse(false),
+                        delayed(false),
+                        responding(false),
+                        status(200u),
+                        bodySize(0u),
+                        bodyRemaining(0u),
+                        chunkSize(0u),
+                        delayMicroseconds(0u),
+                        ndjson(false)
+                {
+                }
+
+                /**
+                 * @brief Number of bytes in the output buffer that still have to be sent.
+                 */
+                size_t Pending() const
+                {
+                    return output.size() - outputOffset;
+                }
+
+                /**
+                 * @brief Generate body data into the output buffer until the high water mark is reached.
+                 */
+                void FillOutput()
+                {
+                    const string& pattern = ndjson ? NdjsonPattern() : BodyPattern();
+                    while (responding && (Pending() < OUTPUT_HIGH_WATER))
+                    {
+                        if (bodyRemaining == 0u)
+                        {
+                            if (chunkSize != 0u)
+                            {
+                                output.append("0\r\n\r\n");
+                            }
+                            responding = false;
+                            return;
+                        }
+
+                        size_t blockSize = (size_t)std::min<uint64_t>(bodyRemaining, pattern.size());
+                        if (chunkSize != 0u)
+                        {
+                            blockSize = (size_t)std::min<uint64_t>(blockSize, chunkSize);
+                            char chunkHeader[32];
+                            int headerLen = ::snprintf(chunkHeader, sizeof(chunkHeader), "%zx\r\n", blockSize);
+                            output.append(chunkHeader, (size_t)headerLen);
+                            output.append(pattern.data(), blockSize);
+                            output.append("\r\n");
+                        }
+                        else
+                        {
+                            output.append(pattern.data(), blockSize);
+                        }
+                        bodyRemaining -= blockSize;
+                    }
+                }
+            };
+
+            LoopbackHttpServer::LoopbackHttpServer(bool listenOnLoopback)
+                :   _listenFd(-1),
+                    _epollFd(-1),
+                    _wakeFd(-1),
+                    _port(0u),
+                    _running(false),
+                    _requestCount(0u),
+                    _bytesReceived(0u)
+            {
+                if (listenOnLoopback)
+                {
+                    this->_listenFd = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+                    if (this->_listenFd < 0)
+                    {
+                        throw system_error(errno, std::generic_category(), "socket");
+                    }
+
+                    int reuse = 1;
+                    ::setsockopt(this->_listenFd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+                    sockaddr_in address;
+                    ::memset(&address, 0, sizeof(address));
+                    address.sin_family = AF_INET;
+                    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+                    address.sin_port = 0;
+                    if (::bind(this->_listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0)
+                    {
+                        int errorCode = errno;
+                        ::close(this->_listenFd);
+                        throw system_error(errorCode, std::generic_category(), "bind");
+                    }
+
+                    socklen_t addressLen = sizeof(address);
+                    ::getsockname(this->_listenFd, reinterpret_cast<sockaddr*>(&address), &addressLen);
+                    this->_port = ntohs(address.sin_port);
+
+                    if (::listen(this->_listenFd, 1024) != 0)
+                    {
+                        int errorCode = errno;
+                        ::close(this->_listenFd);
+                        throw system_error(errorCode, std::generic_category(), "listen");
+                    }
+                }
+
+                this->_epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+                this->_wakeFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+                if ((this->_epollFd < 0) || (this->_wakeFd < 0))
+                {
+                    int errorCode = errno;
+                    if (this->_listenFd >= 0) ::close(this->_listenFd);
+                    if (this->_epollFd >= 0) ::close(this->_epollFd);
+                    if (this->_wakeFd >= 0) ::close(this->_wakeFd);
+                    throw system_error(errorCode, std::generic_category(), "epoll_create1/eventfd");
+                }
+
+                epoll_event event;
+                ::memset(&event, 0, sizeof(event));
+                event.events = EPOLLIN;
+                if (this->_listenFd >= 0)
+                {
+                    event.data.fd = this->_listenFd;
+                    ::epoll_ctl(this->_epollFd, EPOLL_CTL_ADD, this->_listenFd, &event);
+                }
+                event.data.fd = this->_wakeFd;
+                ::epoll_ctl(this->_epollFd, EPOLL_CTL_ADD, this->_wakeFd, &event);
+            }
+
+            LoopbackHttpServer::~LoopbackHttpServer()
+            {
+                Stop();
+
+                for (auto& entry : this->_connections)
+                {
+                    ::close(entry.first);
+                }
+                this->_connections.clear();
+
+                for (int fd : this->_adoptQueue)
+                {
+                    ::close(fd);
+                }
+                this->_adoptQueue.clear();
+
+                ::close(this->_wakeFd);
+                ::close(this->_epollFd);
+                if (this->_listenFd >= 0)
+                {
+                    ::close(this->_listenFd);
+                }
+            }
+
+            void LoopbackHttpServer::Start()
+            {
+                if (this->_running.exchange(true))
+                {
+                    return;
+                }
+
+                this->_thread = std::thread(&LoopbackHttpServer::Run, this);
+            }
+
+            void LoopbackHttpServer::Stop()
+            {
+                if (!this->_running.exchange(false))
+                {
+                    return;
+                }
+
+                uint64_t one = 1u;
+                ssize_t written = ::write(this->_wakeFd, &one, sizeof(one));
+                (void)written;
+                if (this->_thread.joinable())
+                {
+                    this->_thread.join();
+                }
+            }
+
+            void LoopbackHttpServer::Adopt(int fd)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(this->_adoptMutex);
+                    this->_adoptQueue.push_back(fd);
+                }
+
+                uint64_t one = 1u;
+                ssize_t written = ::write(this->_wakeFd, &one, sizeof(one));
+                (void)written;
+            }
+
+            string LoopbackHttpServer::Url(const string& pathAndQuery) const
+            {
+                return string("http://127.0.0.1:") + std::to_string(this->_port) + pathAndQuery;
+            }
+
+            void LoopbackHttpServer::Run()
+            {
+                const int MAX_EVENTS = 64;
+                epoll_event events[MAX_EVENTS];
+                std::vector<int> closeList;
+
+                // The benchmarks measure the allocations of the client.
+                ExcludeThreadFromAllocationCounters();
+
+                while (this->_running.load(std::memory_order_relaxed))
+                {
+                    int timeoutMs = ReleaseDelayedResponses();
+                    int eventCount = ::epoll_wait(this->_epollFd, events, MAX_EVENTS, timeoutMs);
+                    if (eventCount < 0)
+                    {
+                        if (errno == EINTR)
+                        {
+                            continue;
+                        }
+                        break;
+                    }
+
+                    closeList.clear();
+                    for (int eventIndex = 0; eventIndex < eventCount; ++eventIndex)
+                    {
+                        int fd = events[eventIndex].data.fd;
+                        if (fd == this->_wakeFd)
+                        {
+                            uint64_t counter;
+                            ssize_t bytesRead = ::read(this->_wakeFd, &counter, sizeof(counter));
+                            (void)bytesRead;
+                            AdoptQueuedConnections();
+                            continue;
+                        }
+
+                        if (fd == this->_listenFd)
+                        {
+                            AcceptConnections();
+                            continue;
+                        }
+
+                        auto connIter = this->_connections.find(fd);
+                        if (connIter == this->_connections.end())
+                        {
+                            continue;
+                        }
+
+                        Connection& conn = *connIter->second;
+                        bool keep = true;
+                        if ((events[eventIndex].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) != 0u)
+                        {
+                            keep = HandleReadable(conn);
+                        }
+                        if (keep && ((events[eventIndex].events & EPOLLOUT) != 0u))
+                        {
+                            keep = HandleWritable(conn);
+                        }
+
+                        if (keep)
+                        {
+                            UpdateInterest(conn);
+                        }
+                        else
+                        {
+                            closeList.push_back(fd);
+                        }
+                    }
+
+                    for (int fd : closeList)
+                    {
+                        CloseConnection(fd);
+                    }
+                }
+            }
+
+            void LoopbackHttpServer::AcceptConnections()
+            {
+                for (;;)
+                {
+                    int clientFd = ::accept4(this->_listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+                    if (clientFd < 0)
+                    {
+                        return;
+                    }
+
+                    int noDelay = 1;
+                    ::setsockopt(clientFd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+                    AddConnection(clientFd);
+                }
+            }
+
+            void LoopbackHttpServer::AdoptQueuedConnections()
+            {
+                std::vector<int> adopted;
+                {
+                    std::lock_guard<std::mutex> lock(this->_adoptMutex);
+                    adopted.swap(this->_adoptQueue);
+                }
+
+                for (int fd : adopted)
+                {
+                    ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+                    AddConnection(fd);
+                }
+            }
+
+            void LoopbackHttpServer::AddConnection(int fd)
+            {
+                epoll_event event;
+                ::memset(&event, 0, sizeof(event));
+                event.events = EPOLLIN;
+                event.data.fd = fd;
+                ::epoll_ctl(this->_epollFd, EPOLL_CTL_ADD, fd, &event);
+                this->_connections[fd].reset(new Connection(fd));
+            }
+
+            bool LoopbackHttpServer::HandleReadable(Connection& conn)
+            {
+                char buffer[64u * 1024u];
+                for (;;)
+                {
+                    ssize_t received = ::recv(conn.fd, buffer, sizeof(buffer), 0);
+                    if (received > 0)
+                    {
+                        conn.input.append(buffer, (size_t)received);
+                        if ((size_t)received < sizeof(buffer))
+                        {
+                            break;
+                        }
+                    }
+                    else if (received == 0)
+                    {
+                        return false;
+                    }
+                    else if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+                    {
+                        break;
+                    }
+                    else if (errno != EINTR)
+                    {
+                        return false;
+                    }
+                }
+
+                if (!ProcessInput(conn))
+                {
+                    return false;
+                }
+
+                return HandleWritable(conn);
+            }
+
+            bool LoopbackHttpServer::HandleWritable(Connection& conn)
+            {
+                for (;;)
+                {
+                    conn.FillOutput();
+                    if (conn.Pending() == 0u)
+                    {
+                        if (conn.responding || conn.delayed || conn.readingBody)
+                        {
+                            return true;
+                        }
+
+                        // The previous response went out completely.
+                        if (conn.closeAfterResponse)
+                        {
+                            return false;
+                        }
+
+                        // Handle the next request if it is already waiting in the input buffer.
+                        if (!conn.input.empty())
+                        {
+                            if (!ProcessInput(conn))
+                            {
+                                return false;
+                            }
+                            if ((conn.Pending() != 0u) || conn.responding)
+                            {
+                                continue;
+                            }
+                        }
+                        return true;
+                    }
+
+                    ssize_t sent = ::send(conn.fd, conn.output.data() + conn.outputOffset, conn.Pending(), MSG_NOSIGNAL);
+                    if (sent > 0)
+                    {
+                        conn.outputOffset += (size_t)sent;
+                        if (conn.outputOffset == conn.output.size())
+                        {
+                            conn.output.clear();
+                            conn.outputOffset = 0u;
+                        }
+                    }
+                    else if ((sent < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK)))
+                    {
+                        return true;
+                    }
+                    else if ((sent < 0) && (errno == EINTR))
+                    {
+                        continue;
+                    }
+                    else
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            bool LoopbackHttpServer::ProcessInput(Connection& conn)
+            {
+                while (!conn.responding && !conn.delayed)
+                {
+                    if (conn.readingBody)
+                    {
+                        uint64_t consumed = std::min<uint64_t>(conn.requestBodyRemaining, conn.input.size());
+                        conn.input.erase(0u, (size_t)consumed);
+                        conn.requestBodyRemaining -= consumed;
+                        this->_bytesReceived.fetch_add(consumed, std::memory_order_relaxed);
+                        if (conn.requestBodyRemaining != 0u)
+                        {
+                            return true;
+                        }
+
+                        conn.readingBody = false;
+                        if (conn.delayMicroseconds != 0u)
+                        {
+                            conn.delayed = true;
+                            conn.due = steady_clock::now() + std::chrono::microseconds(conn.delayMicroseconds);
+                        }
+                        else
+                        {
+                            QueueResponse(conn);
+                        }
+                        continue;
+                    }
+
+                    size_t headerEnd = conn.input.find("\r\n\r\n");
+                    if (headerEnd == string::npos)
+                    {
+                        return conn.input.size() <= MAX_HEADER_SIZE;
+                    }
+
+                    // Request line: METHOD SP target SP version
+                    size_t lineEnd = conn.input.find("\r\n");
+                    size_t targetStart = conn.input.find(' ');
+                    if ((targetStart == string::npos) || (targetStart > lineEnd))
+                    {
+                        return false;
+                    }
+                    size_t targetEnd = conn.input.find(' ', targetStart + 1u);
+                    if ((targetEnd == string::npos) || (targetEnd > lineEnd))
+                    {
+                        return false;
+                    }
+                    string target(conn.input, targetStart + 1u, targetEnd - targetStart - 1u);
+                    bool http10 = (conn.input.compare(targetEnd + 1u, 8u, "HTTP/1.0") == 0);
+
+                    uint64_t contentLength = 0u;
+                    bool expectContinue = false;
+                    conn.closeAfterResponse = http10;
+                    size_t linePos = lineEnd + 2u;
+                    while (linePos < headerEnd + 2u)
+                    {
+                        size_t nextLine = conn.input.find("\r\n", linePos);
+                        const char* line = conn.input.data() + linePos;
+                        size_t lineLen = nextLine - linePos;
+                        if (HeaderIs(line, lineLen, "Content-Length"))
+                        {
+                            contentLength = ::strtoull(HeaderValue(line, 14u), nullptr, 10);
+                        }
+                        else if (HeaderIs(line, lineLen, "Expect"))
+                        {
+                            expectContinue = (::strncasecmp(HeaderValue(line, 6u), "100-continue", 12u) == 0);
+                        }
+                        else if (HeaderIs(line, lineLen, "Connection"))
+                        {
+                            const char* value = HeaderValue(line, 10u);
+                            if (::strncasecmp(value, "close", 5u) == 0)
+                            {
+                                conn.closeAfterResponse = true;
+                            }
+                            else if (::strncasecmp(value, "keep-alive", 10u) == 0)
+                            {
+                                conn.closeAfterResponse = false;
+                            }
+                        }
+                        linePos = nextLine + 2u;
+                    }
+
+                    conn.status = (unsigned)QueryValue(target, "status", 200u);
+                    conn.bodySize = QueryValue(target, "size", 0u);
+                    conn.chunkSize = QueryValue(target, "chunk", 0u);
+                    conn.delayMicroseconds = QueryValue(target, "delay_us", 0u);
+                    conn.ndjson = (QueryValue(target, "ndjson", 0u) != 0u);
+                    conn.input.erase(0u, headerEnd + 4u);
+
+                    conn.readingBody = true;
+                    conn.requestBodyRemaining = contentLength;
+                    if (expectContinue && (contentLength != 0u))
+                    {
+                        conn.output.append("HTTP/1.1 100 Continue\r\n\r\n");
+                    }
+                }
+
+                return true;
+            }
+
+            void LoopbackHttpServer::QueueResponse(Connection& conn)
+            {
+                char header[256];
+                int headerLen;
+                if (conn.chunkSize != 0u)
+                {
+                    headerLen = ::snprintf
+                    (
+                        header,
+                        sizeof(header),
+                        "HTTP/1.1 %u %s\r\nContent-Type: application/octet-stream\r\nTransfer-Encoding: chunked\r\n%s\r\n",
+                        conn.status,
+                        ReasonPhrase(conn.status),
+                        conn.closeAfterResponse ? "Connection: close\r\n" : ""
+                    );
+                }
+                else
+                {
+                    headerLen = ::snprintf
+                    (
+                        header,
+                        sizeof(header),
+                        "HTTP/1.1 %u %s\r\nContent-Type: application/octet-stream\r\nContent-Length: %llu\r\n%s\r\n",
+                        conn.status,
+                        ReasonPhrase(conn.status),
+                        (unsigned long long)conn.bodySize,
+                        conn.closeAfterResponse ? "Connection: close\r\n" : ""
+                    );
+                }
+
+                conn.output.append(header, (size_t)headerLen);
+                conn.bodyRemaining = conn.bodySize;
+                conn.responding = true;
+                conn.delayed = false;
+                this->_requestCount.fetch_add(1u, std::memory_order_relaxed);
+            }
+
+            void LoopbackHttpServer::UpdateInterest(Connection& conn)
+            {
+                epoll_event event;
+                ::memset(&event, 0, sizeof(event));
+                event.events = ((conn.Pending() != 0u) || conn.responding) ? (EPOLLIN | EPOLLOUT) : EPOLLIN;
+                event.data.fd = conn.fd;
+                ::epoll_ctl(this->_epollFd, EPOLL_CTL_MOD, conn.fd, &event);
+            }
+
+            void LoopbackHttpServer::CloseConnection(int fd)
+            {
+                ::epoll_ctl(this->_epollFd, EPOLL_CTL_DEL, fd, nullptr);
+                ::close(fd);
+                this->_connections.erase(fd);
+            }
+
+            int LoopbackHttpServer::ReleaseDelayedResponses()
+            {
+                int timeoutMs = -1;
+                steady_clock::time_point now = steady_clock::now();
+                std::vector<int> closeList;
+
+                for (auto& entry : this->_connections)
+                {
+                    Connection& conn = *entry.second;
+                    if (!conn.delayed)
+                    {
+                        continue;
+                    }
+
+                    if (conn.due <= now)
+                    {
+                        QueueResponse(conn);
+                        if (HandleWritable(conn))
+                        {
+                            UpdateInterest(conn);
+                        }
+                        else
+                        {
+                            closeList.push_back(conn.fd);
+                        }
+                        continue;
+                    }
+
+                    // Round up so that we never wake up before the response is due.
+                    auto remaining = std::chrono::duration_cast<std::chrono::microseconds>(conn.due - now).count();
+                    int remainingMs = (int)((remaining + 999) / 1000);
+                    if ((timeoutMs < 0) || (remainingMs < timeoutMs))
+                    {
+                        timeoutMs = remainingMs;
+                    }
+                }
+
+                for (int fd : closeList)
+                {
+                    CloseConnection(fd);
+                }
+
+                return timeoutMs;
+            }
+        } // namespace Bench
+    } // namespace Web
+} // namespace AbcdEFramework
@@ -0,0 +1,200 @@
+/**
+ * @file
+ * @brief Declaration of the LoopbackHttpServer class used by the benchmark programs.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] Added the ndjson query parameter.
+ */
+#if !defined LOOPBACK_HTTP_SERVER_173FF816E3B04DBBA11F9DE24B762B5E
+#define LOOPBACK_HTTP_SERVER_173FF816E3B04DBBA11F9DE24B762B5E 1
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        namespace Bench
+        {
+            /**
+             * @brief Size of a record in a body that is served with the \c ndjson parameter, with its line feed.
+             */
+            const size_t NDJSON_RECORD_SIZE = 96u;
+
+            /**
+             * @brief Minimal HTTP/1.1 server that runs an epoll loop on a background thread and listens on 127.0.0.1.
+             * @remark The response is controlled by query parameters on the request URL:
+             *      - \c size Number of body bytes to return (default 0).
+             *      - \c delay_us Number of microseconds to wait before the response is sent (default 0).
+             *      - \c chunk If non-zero the body is sent with chunked transfer encoding in chunks of this size.
+             *      - \c status HTTP status code to return (default 200).
+             *      - \c ndjson If non-zero the body consists of JSON records of \c NDJSON_RECORD_SIZE bytes, each on
+             *        its own line, instead of \c x characters. Use a size that is a multiple of the record size.
+             *
+             *      Request bodies must be sent with a \c Content-Length header; they are read and discarded.
+             *      Connections are kept alive unless the client asks otherwise.
+             *
+             *      Besides accepting TCP connections the server can serve sockets that were connected elsewhere,
+             *      e.g. one end of a \c socketpair(), through \c Adopt().
+             */
+            class LoopbackHttpServer
+            {
+                private:
+                    struct Connection;
+
+                private:
+                    int _listenFd; ///< Listening socket.
+                    int _epollFd; ///< The epoll instance that drives all sockets.
+                    int _wakeFd; ///< eventfd used to wake up the loop for adopted sockets and to stop it.
+                    unsigned short _port; ///< Port number the server is bound to.
+                    std::thread _thread; ///< Thread that runs the event loop.
+                    std::atomic<bool> _running; ///< Set while the event loop must keep on running.
+                    std::atomic<uint64_t> _requestCount; ///< Number of requests that were answered.
+                    std::atomic<uint64_t> _bytesReceived; ///< Number of request body bytes that were consumed.
+                    std::map<int, std::unique_ptr<Connection>> _connections; ///< Open connections keyed on the socket.
+                    std::mutex _adoptMutex; ///< Protects \c _adoptQueue.
+                    std::vector<int> _adoptQueue; ///< Sockets handed to \c Adopt() that the loop has not picked up yet.
+
+                public:
+                    /**
+                     * @brief Create the listening socket on an ephemeral port of the loopback interface.
+                     * @param listenOnLoopback If \c false no listening socket is created and the server only serves
+                     *      sockets that are passed to \c Adopt().
+                     */
+                    explicit LoopbackHttpServer(bool listenOnLoopback = true);
+
+                    /**
+                     * @brief Destructor. Stops the event loop and closes all sockets.
+                     */
+                    ~LoopbackHttpServer();
+
+                public:
+                    /**
+                     * @brief Start the event loop on a background thread.
+                     */
+                    void Start();
+
+                    /**
+                     * @brief Stop the event loop and wait for the thread to finish.
+                     */
+                    void Stop();
+
+                    /**
+                     * @brief Serve a socket that is already connected to a client.
+                     * @param fd The socket. The server takes ownership and sets it to non-blocking mode.
+                     * @remark This method may be called from any thread.
+                     */
+                    void Adopt(int fd);
+
+                    /**
+                     * @brief Get the port number that the server is listening on.
+                     */
+                    inline unsigned short GetPort() const;
+
+                    /**
+                     * @brief Get the number of requests that were answered.
+                     */
+                    inline uint64_t GetRequestCount() const;
+
+                    /**
+                     * @brief Get the number of request body bytes that were consumed.
+                     */
+                    inline uint64_t GetBytesReceived() const;
+
+                    /**
+                     * @brief Build a URL that points to the server.
+                     * @param pathAndQuery Path and query string, starting with a slash.
+                     */
+                    std::string Url(const std::string& pathAndQuery) const;
+
+                private:
+                    /**
+                     * @brief The event loop.
+                     */
+                    void Run();
+
+                    /**
+                     * @brief Accept all pending connections on the listening socket.
+                     */
+                    void AcceptConnections();
+
+                    /**
+                     * @brief Register the sockets that are waiting in the adopt queue.
+                     */
+                    void AdoptQueuedConnections();
+
+                    /**
+                     * @brief Register a connected, non-blocking socket with the event loop.
+                     */
+                    void AddConnection(int fd);
+
+                    /**
+                     * @brief Read from a connection and handle any complete requests.
+                     * @return \c false if the connection must be closed.
+                     */
+                    bool HandleReadable(Connection& conn);
+
+                    /**
+                     * @brief Write pending response data to a connection.
+                     * @return \c false if the connection must be closed.
+                     */
+                    bool HandleWritable(Connection& conn);
+
+                    /**
+                     * @brief Parse the requests in the input buffer of a connection.
+                     * @return \c false if the request is malformed.
+                     */
+                    bool ProcessInput(Connection& conn);
+
+                    /**
+                     * @brief Queue the response for the request that was parsed last.
+                     */
+                    void QueueResponse(Connection& conn);
+
+                    /**
+                     * @brief Register interest in write events if there is data waiting to be sent.
+                     */
+                    void UpdateInterest(Connection& conn);
+
+                    /**
+                     * @brief Close a connection and forget about it.
+                     */
+                    void CloseConnection(int fd);
+
+                    /**
+                     * @brief Release delayed responses that are due and calculate the next epoll timeout.
+                     * @return Timeout in milliseconds, or -1 to wait indefinitely.
+                     */
+                    int ReleaseDelayedResponses();
+
+                private:
+                    LoopbackHttpServer(const LoopbackHttpServer&) = delete;
+                    LoopbackHttpServer& operator=(const LoopbackHttpServer&) = delete;
+            };
+
+            inline unsigned short LoopbackHttpServer::GetPort() const
+            {
+                return this->_port;
+            }
+
+            inline uint64_t LoopbackHttpServer::GetRequestCount() const
+            {
+                return this->_requestCount.load(std::memory_order_relaxed);
+            }
+
+            inline uint64_t LoopbackHttpServer::GetBytesReceived() const
+            {
+                return this->_bytesReceived.load(std::memory_order_relaxed);
+            }
+        } // namespace Bench
+    } // namespace Web
+} // namespace AbcdEFramework
+
+#endif // LOOPBACK_HTTP_SERVER_173FF816E3B04DBBA11F9DE24B762B5E
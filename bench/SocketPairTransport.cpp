@@ -0,0 +1,207 @@
+/**
+ * @file
+ * @brief Definition of the SocketPairTransport methods.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] Attach() uses the typed Set<>() method.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#include <dlfcn.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "SocketPairTransport.hpp"
+
+namespace
+{
+    /**
+     * @brief The address cURL asked for when it opened a socket pair socket.
+     */
+    struct PairSocketAddress
+    {
+        sockaddr_storage address; ///< Address that cURL wanted to connect to.
+        socklen_t addressLen; ///< Length of \c address.
+    };
+
+    std::mutex g_pairSocketMutex; ///< Protects \c g_pairSockets.
+    std::unordered_map<int, PairSocketAddress> g_pairSockets; ///< Sockets handed to cURL by \c SocketPairTransport.
+
+    /**
+     * @brief Look up a socket pair socket.
+     * @param fd The socket.
+     * @param address Receives the address that cURL asked for, if \c address is not \c nullptr.
+     * @return \c true if \c fd is a socket pair socket.
+     */
+    bool FindPairSocket(int fd, PairSocketAddress* address)
+    {
+        std::lock_guard<std::mutex> lock(g_pairSocketMutex);
+        auto iter = g_pairSockets.find(fd);
+        if (iter == g_pairSockets.end())
+        {
+            return false;
+        }
+
+        if (address != nullptr)
+        {
+            *address = iter->second;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Copy an address to the buffer of a \c getpeername() or \c getsockname() call.
+     */
+    int CopyAddress(const sockaddr_storage& source, socklen_t sourceLen, struct sockaddr* address, socklen_t* addressLen)
+    {
+        ::memcpy(address, &source, std::min(sourceLen, *addressLen));
+        *addressLen = sourceLen;
+        return 0;
+    }
+}
+
+/*
+ * Some libcurl releases (7.88 among them) ignore CURL_SOCKOPT_ALREADY_CONNECTED and call connect() anyway, which
+ * fails on a connected AF_UNIX socket. They also derive the connection's IP address from getpeername(), and refuse
+ * to reuse a connection without one. The three functions below interpose the C library versions for the sockets
+ * of SocketPairTransport so that those sockets look like connected TCP sockets; all other sockets are passed on.
+ */
+
+extern "C" int connect(int fd, const struct sockaddr* address, socklen_t addressLen)
+{
+    typedef int (*ConnectFunction)(int, const struct sockaddr*, socklen_t);
+    static ConnectFunction realConnect = reinterpret_cast<ConnectFunction>(::dlsym(RTLD_NEXT, "connect"));
+
+    if (FindPairSocket(fd, nullptr))
+    {
+        return 0;
+    }
+
+    return realConnect(fd, address, addressLen);
+}
+
+extern "C" int getpeername(int fd, struct sockaddr* address, socklen_t* addressLen)
+{
+    typedef int (*GetNameFunction)(int, struct sockaddr*, socklen_t*);
+    static GetNameFunction realGetPeerName = reinterpret_cast<GetNameFunction>(::dlsym(RTLD_NEXT, "getpeername"));
+
+    PairSocketAddress peer;
+    if (FindPairSocket(fd, &peer))
+    {
+        return CopyAddress(peer.address, peer.addressLen, address, addressLen);
+    }
+
+    return realGetPeerName(fd, address, addressLen);
+}
+
+extern "C" int getsockname(int fd, struct sockaddr* address, socklen_t* addressLen)
+{
+    typedef int (*GetNameFunction)(int, struct sockaddr*, socklen_t*);
+    static GetNameFunction realGetSockName = reinterpret_cast<GetNameFunction>(::dlsym(RTLD_NEXT, "getsockname"));
+
+    PairSocketAddress local;
+    if (FindPairSocket(fd, &local))
+    {
+        // Same address as the peer, on a port derived from the socket number.
+        if (local.address.ss_family == AF_INET)
+        {
+            reinterpret_cast<sockaddr_in*>(&local.address)->sin_port = htons((uint16_t)(32768 + (fd & 0x3fff)));
+        }
+        else if (local.address.ss_family == AF_INET6)
+        {
+            reinterpret_cast<sockaddr_in6*>(&local.address)->sin6_port = htons((uint16_t)(32768 + (fd & 0x3fff)));
+        }
+        return CopyAddress(local.address, local.addressLen, address, addressLen);
+    }
+
+    return realGetSockName(fd, address, addressLen);
+}
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        namespace Bench
+        {
+            using std::string;
+
+            SocketPairTransport::SocketPairTransport()
+                :   _responder(false),
+                    _connectionCount(0u)
+            {
+                this->_responder.Start();
+            }
+
+            SocketPairTransport::~SocketPairTransport()
+            {
+                this->_responder.Stop();
+            }
+
+            void SocketPairTransport::Attach(CurlEasyWrapper& curl)
+            {
+                curl.Set<CURLOPT_TCP_NODELAY>(0l);
+                curl.Set<CURLOPT_OPENSOCKETFUNCTION>(SocketPairTransport::OpenSocketProc);
+                curl.Set<CURLOPT_OPENSOCKETDATA>((void*)this);
+                curl.Set<CURLOPT_SOCKOPTFUNCTION>(SocketPairTransport::SockOptProc);
+                curl.Set<CURLOPT_SOCKOPTDATA>((void*)this);
+                curl.Set<CURLOPT_CLOSESOCKETFUNCTION>(SocketPairTransport::CloseSocketProc);
+                curl.Set<CURLOPT_CLOSESOCKETDATA>((void*)this);
+            }
+
+            string SocketPairTransport::Url(const string& pathAndQuery)
+            {
+                // Port 9 is the discard service; it is never connected to.
+                return string("http://127.0.0.1:9") + pathAndQuery;
+            }
+
+            curl_socket_t SocketPairTransport::OpenSocketProc(void* clientp, curlsocktype purpose, curl_sockaddr* address)
+            {
+                if (purpose != CURLSOCKTYPE_IPCXN)
+                {
+                    return CURL_SOCKET_BAD;
+                }
+
+                int fds[2];
+                if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) != 0)
+                {
+                    return CURL_SOCKET_BAD;
+                }
+
+                PairSocketAddress peer;
+                ::memset(&peer, 0, sizeof(peer));
+                peer.addressLen = std::min<socklen_t>(address->addrlen, sizeof(peer.address));
+                ::memcpy(&peer.address, &address->addr, peer.addressLen);
+                {
+                    std::lock_guard<std::mutex> lock(g_pairSocketMutex);
+                    g_pairSockets[fds[0]] = peer;
+                }
+
+                SocketPairTransport* transport = reinterpret_cast<SocketPairTransport*>(clientp);
+                transport->_responder.Adopt(fds[1]);
+                transport->_connectionCount.fetch_add(1u, std::memory_order_relaxed);
+                return fds[0];
+            }
+
+            int SocketPairTransport::SockOptProc(void* clientp, curl_socket_t curlfd, curlsocktype purpose)
+            {
+                (void)clientp;
+                (void)curlfd;
+                (void)purpose;
+                return CURL_SOCKOPT_ALREADY_CONNECTED;
+            }
+
+            int SocketPairTransport::CloseSocketProc(void* clientp, curl_socket_t item)
+            {
+                (void)clientp;
+                {
+                    std::lock_guard<std::mutex> lock(g_pairSocketMutex);
+                    g_pairSockets.erase(item);
+                }
+
+                return ::close(item);
+            }
+        } // namespace Bench
+    } // namespace Web
+} // namespace AbcdEFramework
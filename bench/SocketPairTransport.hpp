@@ -0,0 +1,103 @@
+/**
+ * @file
+ * @brief Declaration of the SocketPairTransport class.
+ * @date 2026-10-19 [JFDR] Created.
+ */
+#if !defined SOCKET_PAIR_TRANSPORT_0FF097D36A73402C88543FD087A4484C
+#define SOCKET_PAIR_TRANSPORT_0FF097D36A73402C88543FD087A4484C 1
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <curl/curl.h>
+#include <CurlEasyWrapper.hpp>
+#include "LoopbackHttpServer.hpp"
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        namespace Bench
+        {
+            /**
+             * @brief Network-free transport for benchmarks.
+             * @remark Every connection that cURL opens on an attached handle is replaced by one end of an
+             *      \c AF_UNIX \c socketpair(). The other end is served by an in-process \c LoopbackHttpServer that
+             *      has no listening socket, so the responses are shaped by the same query parameters
+             *      (\c size, \c chunk, \c delay_us, \c status). The host and port in the URL are never connected
+             *      to, but must be numeric so that no name resolution takes place; use \c Url().
+             */
+            class SocketPairTransport
+            {
+                private:
+                    LoopbackHttpServer _responder; ///< Serves the far end of every socket pair.
+                    std::atomic<uint64_t> _connectionCount; ///< Number of socket pairs handed to cURL.
+
+                public:
+                    /**
+                     * @brief Start the in-process responder.
+                     */
+                    SocketPairTransport();
+
+                    /**
+                     * @brief Stop the responder. All attached handles must have been destroyed first.
+                     */
+                    ~SocketPairTransport();
+
+                public:
+                    /**
+                     * @brief Route all connections of a handle through this transport.
+                     */
+                    void Attach(CurlEasyWrapper& curl);
+
+                    /**
+                     * @brief Build a URL for a request over this transport.
+                     * @param pathAndQuery Path and query string, starting with a slash.
+                     */
+                    static std::string Url(const std::string& pathAndQuery);
+
+                    /**
+                     * @brief Get the number of connections that were opened.
+                     */
+                    inline uint64_t GetConnectionCount() const;
+
+                    /**
+                     * @brief Get the number of requests that the responder answered.
+                     */
+                    inline uint64_t GetRequestCount() const;
+
+                private:
+                    /**
+                     * @brief \c CURLOPT_OPENSOCKETFUNCTION callback that creates a socket pair.
+                     */
+                    static curl_socket_t OpenSocketProc(void* clientp, curlsocktype purpose, curl_sockaddr* address);
+
+                    /**
+                     * @brief \c CURLOPT_SOCKOPTFUNCTION callback that tells cURL not to connect the socket.
+                     */
+                    static int SockOptProc(void* clientp, curl_socket_t curlfd, curlsocktype purpose);
+
+                    /**
+                     * @brief \c CURLOPT_CLOSESOCKETFUNCTION callback that closes cURL's end of a socket pair.
+                     */
+                    static int CloseSocketProc(void* clientp, curl_socket_t item);
+
+                private:
+                    SocketPairTransport(const SocketPairTransport&) = delete;
+                    SocketPairTransport& operator=(const SocketPairTransport&) = delete;
+            };
+
+            inline uint64_t SocketPairTransport::GetConnectionCount() const
+            {
+                return this->_connectionCount.load(std::memory_order_relaxed);
+            }
+
+            inline uint64_t SocketPairTransport::GetRequestCount() const
+            {
+                return this->_responder.GetRequestCount();
+            }
+        } // namespace Bench
+    } // namespace Web
+} // namespace AbcdEFramework
+
+#endif // SOCKET_PAIR_TRANSPORT_0FF097D36A73402C88543FD087A4484C
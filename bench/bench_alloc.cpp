@@ -0,0 +1,168 @@
+/**
+ * @file
+ * @brief Heap allocations made by CurlEasyWrapper on its construction and request paths.
+ * @remark Allocations made through \c operator \c new are counted by the bench support code. libcurl is initialised
+ *      with counting allocators through \c CurlGlobal, so its own allocations are reported separately, together with
+ *      the growth of the wrapper's buffers.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] Report the libcurl and wrapper buffer allocations per operation.
+ * @date 2026-10-19 [JFDR] Added a handle that is recycled with ResetToBaseline() between requests.
+ */
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <CurlEasyWrapper.hpp>
+#include <CurlGlobal.hpp>
+#include "BenchSupport.hpp"
+#include "LoopbackHttpServer.hpp"
+
+using std::cerr;
+using std::endl;
+using std::exception;
+using std::string;
+using std::to_string;
+using AbcdEFramework::Web::CurlEasyWrapper;
+using AbcdEFramework::Web::CURL_ALLOC_LIBCURL;
+using AbcdEFramework::Web::CurlAllocationStats;
+using AbcdEFramework::Web::CurlException;
+using AbcdEFramework::Web::CurlGlobal;
+using AbcdEFramework::Web::Bench::AllocationCounters;
+using AbcdEFramework::Web::Bench::BenchArgs;
+using AbcdEFramework::Web::Bench::BenchReport;
+using AbcdEFramework::Web::Bench::GetAllocationCounters;
+using AbcdEFramework::Web::Bench::LoopbackHttpServer;
+using json = nlohmann::json;
+
+namespace
+{
+    /**
+     * @brief Allocation counters of both the bench support code and \c CurlGlobal.
+     */
+    struct Snapshot
+    {
+        AllocationCounters heap; ///< Allocations made through \c operator \c new.
+        CurlAllocationStats curl; ///< Allocations made by libcurl and in the wrapper's buffers.
+    };
+
+    /**
+     * @brief Take a snapshot of all counters.
+     */
+    Snapshot TakeSnapshot()
+    {
+        Snapshot result;
+        result.heap = GetAllocationCounters();
+        result.curl = CurlGlobal::GetAllocationStats();
+        return result;
+    }
+
+    /**
+     * @brief Build the result object from the allocation counters collected over \c operations operations.
+     */
+    json MakeResult(const string& name, long long operations, const Snapshot& before)
+    {
+        AllocationCounters heap = GetAllocationCounters() - before.heap;
+        CurlAllocationStats curl = CurlGlobal::GetAllocationStats() - before.curl;
+
+        json result;
+        result["name"] = name;
+        result["operations"] = operations;
+        result["allocations_per_op"] = (double)heap.allocations / (double)operations;
+        result["bytes_per_op"] = (double)heap.bytes / (double)operations;
+        result["libcurl_allocations_per_op"] = (double)curl.allocations[CURL_ALLOC_LIBCURL] / (double)operations;
+        result["libcurl_bytes_per_op"] = (double)curl.bytes[CURL_ALLOC_LIBCURL] / (double)operations;
+        result["wrapper_allocations_per_op"] = (double)curl.WrapperAllocations() / (double)operations;
+        result["wrapper_bytes_per_op"] = (double)curl.WrapperBytes() / (double)operations;
+        return result;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    BenchArgs args(argc, argv);
+    const long long operations = args.GetNumber("operations", 1000);
+    const long long bodySize = args.GetNumber("size", 1024);
+
+    int exitCode = 0;
+
+    try
+    {
+        CurlGlobal curlGlobal(CURL_GLOBAL_ALL, true);
+        LoopbackHttpServer server;
+        server.Start();
+        const string url(server.Url("/bytes?size=" + to_string(bodySize)));
+        BenchReport report("alloc");
+
+        // Construction and destruction of a wrapper.
+        {
+            Snapshot before = TakeSnapshot();
+            for (long long operation = 0; operation < operations; ++operation)
+            {
+                CurlEasyWrapper curl;
+            }
+            report.Add(MakeResult("construct_destroy", operations, before));
+        }
+
+        // Steady state of a reused handle: set the URL, execute and clear the receive buffer.
+        {
+            CurlEasyWrapper curl;
+            curl.Url(url);
+            curl.Execute();
+            curl.ClearReceiveBuffer();
+
+            Snapshot before = TakeSnapshot();
+            for (long long operation = 0; operation < operations; ++operation)
+            {
+                curl.Url(url);
+                curl.Execute();
+                curl.ClearReceiveBuffer();
+            }
+            report.Add(MakeResult("reused_handle_request", operations, before));
+        }
+
+        // A handle that is recycled between unrelated requests.
+        {
+            CurlEasyWrapper curl;
+            curl.Url(url);
+            curl.Execute();
+            curl.ResetToBaseline();
+
+            Snapshot before = TakeSnapshot();
+            for (long long operation = 0; operation < operations; ++operation)
+            {
+                curl.Url(url);
+                curl.TimeoutSeconds(30l);
+                curl.Execute();
+                curl.ResetToBaseline();
+            }
+            report.Add(MakeResult("reset_to_baseline_request", operations, before));
+        }
+
+        // A complete request on a fresh handle.
+        {
+            Snapshot before = TakeSnapshot();
+            for (long long operation = 0; operation < operations; ++operation)
+            {
+                CurlEasyWrapper curl;
+                curl.Url(url);
+                curl.Execute();
+            }
+            report.Add(MakeResult("new_handle_request", operations, before));
+        }
+
+        server.Stop();
+        report.Print();
+    }
+    catch (CurlException& ex)
+    {
+        cerr << ex.what() << endl;
+        exitCode = 1;
+    }
+    catch (exception& ex)
+    {
+        cerr << ex.what() << endl;
+        exitCode = 1;
+    }
+
+    return exitCode;
+}
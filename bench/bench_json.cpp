@@ -0,0 +1,924 @@
+/**
+ * @file
+ * @brief Cost of parsing large JSON response bodies that were received by CurlEasyWrapper.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] Added parsing into an arena_json and the time to release a parsed document.
+ * @date 2026-10-19 [JFDR] Added flat_json: parse, member lookup and dump of wide objects.
+ * @date 2026-10-19 [JFDR] Added CurlJsonExtractor.
+ * @date 2026-10-19 [JFDR] Added CurlJsonIndex for each instruction set.
+ * @date 2026-10-19 [JFDR] Added printing and reading numbers, with a bit exact round-trip check.
+ * @date 2026-10-19 [JFDR] Added serialising a request body with PostJson().
+ * @date 2026-10-19 [JFDR] Added CBOR and MessagePack request and response bodies.
+ * @date 2026-10-19 [JFDR] The push parsers are reused, also across CurlArena::Reset().
+ * @date 2026-10-19 [JFDR] Check the lookups of a CurlFlatMap that was reserved while it was small.
+ * @date 2026-10-19 [JFDR] Check that CurlArena::Reset() keeps the block of a large allocation.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include <CurlArenaJson.hpp>
+#include <CurlEasyWrapper.hpp>
+#include <CurlFlatJson.hpp>
+#include <CurlFlatMap.hpp>
+#include <CurlJsonExtractor.hpp>
+#include <CurlJsonIndex.hpp>
+#include <CurlJsonNumbers.hpp>
+#include <CurlJsonPushParser.hpp>
+#include <CurlTextScan.hpp>
+#include "BenchSupport.hpp"
+
+using std::cerr;
+using std::endl;
+using std::exception;
+using std::string;
+using std::to_string;
+using AbcdEFramework::Web::arena_json;
+using AbcdEFramework::Web::CurlArena;
+using AbcdEFramework::Web::CurlEasyWrapper;
+using AbcdEFramework::Web::CurlFlatMap;
+using AbcdEFramework::Web::CurlJsonExtractor;
+using AbcdEFramework::Web::CurlJsonIndex;
+using AbcdEFramework::Web::CurlJsonNumbers;
+using AbcdEFramework::Web::CurlJsonPushParser;
+using AbcdEFramework::Web::CurlException;
+using AbcdEFramework::Web::CurlSimdLevel;
+using AbcdEFramework::Web::CurlTextScan;
+using AbcdEFramework::Web::flat_json;
+using AbcdEFramework::Web::Bench::AllocationCounters;
+using AbcdEFramework::Web::Bench::BenchArgs;
+using AbcdEFramework::Web::Bench::BenchReport;
+using AbcdEFramework::Web::Bench::DoNotOptimize;
+using AbcdEFramework::Web::Bench::GetAllocationCounters;
+using AbcdEFramework::Web::Bench::MakeJsonDocument;
+using AbcdEFramework::Web::Bench::NowNanoseconds;
+using json = nlohmann::json;
+
+namespace
+{
+    /**
+     * @brief A file with the given contents that is deleted again by the destructor.
+     * @remark The bodies are fetched through a \c file:// URL, so that the receive buffer is filled by the wrapper
+     *      itself without a server that has to generate them.
+     */
+    class TemporaryFile
+    {
+        private:
+            string _path; ///< Path of the file.
+
+        public:
+            /**
+             * @brief Create the file and write \c contents to it.
+             */
+            explicit TemporaryFile(const string& contents)
+            {
+                char path[] = "/tmp/curl_bench_json_XXXXXX";
+                int fd = ::mkstemp(path);
+                if (fd < 0)
+                {
+                    throw std::runtime_error("mkstemp() failed");
+                }
+                this->_path = path;
+
+                size_t written = 0u;
+                while (written < contents.size())
+                {
+                    ssize_t result = ::write(fd, contents.data() + written, contents.size() - written);
+                    if (result <= 0)
+                    {
+                        ::close(fd);
+                        ::unlink(path);
+                        throw std::runtime_error("write() failed");
+                    }
+                    written += (size_t)result;
+                }
+                ::close(fd);
+            }
+
+            /**
+             * @brief Delete the file.
+             */
+            ~TemporaryFile()
+            {
+                ::unlink(this->_path.c_str());
+            }
+
+        public:
+            /**
+             * @brief Get the URL of the file.
+             */
+            string Url() const
+            {
+                return "file://" + this->_path;
+            }
+    };
+
+    /**
+     * @brief Run \c operation a number of times and report the best and mean throughput and the allocations.
+     * @remark The parsed value is destroyed inside the operation, so freeing it is part of the cost.
+     */
+    template <typename Operation>
+    json Measure(long long iterations, size_t bytes, Operation operation)
+    {
+        uint64_t bestNs = UINT64_MAX;
+        uint64_t totalNs = 0u;
+        AllocationCounters allocBefore = GetAllocationCounters();
+        for (long long iteration = 0; iteration < iterations; ++iteration)
+        {
+            uint64_t start = NowNanoseconds();
+            operation();
+            uint64_t elapsedNs = NowNanoseconds() - start;
+            bestNs = std::min(bestNs, elapsedNs);
+            totalNs += elapsedNs;
+        }
+        AllocationCounters allocs = GetAllocationCounters() - allocBefore;
+
+        const double megabytes = (double)bytes / (1024.0 * 1024.0);
+        json result;
+        result["best_ms"] = (double)bestNs / 1e6;
+        result["best_mb_per_sec"] = megabytes / ((double)bestNs / 1e9);
+        result["mean_mb_per_sec"] = megabytes / (((double)totalNs / (double)iterations) / 1e9);
+        result["allocations_per_op"] = (double)allocs.allocations / (double)iterations;
+        result["bytes_per_op"] = (double)allocs.bytes / (double)iterations;
+        return result;
+    }
+
+    /**
+     * @brief Parse a body with a \c CurlJsonPushParser that is reused from one body to the next.
+     */
+    template <typename JsonType>
+    JsonType PushParse(CurlJsonPushParser<JsonType>& parser, const std::vector<unsigned char>& body)
+    {
+        parser.Reset();
+        parser.Feed(reinterpret_cast<const char*>(body.data()), body.size());
+        parser.Finish();
+        return parser.TakeValue();
+    }
+
+    /**
+     * @brief Check a \c CurlFlatMap that was reserved for more entries than it searches linearly, while it fills.
+     * @return Number of keys that were not found or were added twice.
+     */
+    size_t CheckReservedFlatMap()
+    {
+        const size_t keyCount = 32u;
+        size_t failures = 0u;
+        CurlFlatMap<string, size_t> map;
+        map.reserve(keyCount * 2u);
+        for (size_t key = 0u; key < keyCount; ++key)
+        {
+            const string name("key_" + to_string(key));
+            failures += map.insert(std::make_pair(name, key)).second ? 0u : 1u;
+            failures += map.insert(std::make_pair(name, key)).second ? 1u : 0u;
+        }
+
+        for (size_t key = 0u; key < keyCount; ++key)
+        {
+            CurlFlatMap<string, size_t>::const_iterator found(map.find("key_" + to_string(key)));
+            failures += ((found != map.end()) && (found->second == key)) ? 0u : 1u;
+        }
+        return failures + ((map.size() == keyCount) ? 0u : 1u);
+    }
+
+    /**
+     * @brief Check that an arena keeps the block of an allocation that was larger than the next block, when a
+     *      smaller block was added after it, so that the same allocation does not need a new block after a reset.
+     * @return \c true if no block was added for the allocation after the reset.
+     */
+    bool CheckArenaReset()
+    {
+        const size_t largeSize = 1024u * 1024u;
+        CurlArena arena(1024u);
+        arena.Allocate(largeSize, 16u);
+        arena.Allocate(512u, 16u);
+        arena.Reset();
+
+        const size_t reservedAfterReset = arena.GetBytesReserved();
+        arena.Allocate(largeSize, 16u);
+        return (reservedAfterReset >= largeSize) && (arena.GetBytesReserved() == reservedAfterReset);
+    }
+
+    /**
+     * @brief Get the member names of the objects of \c MakeWideObjectDocument().
+     */
+    std::vector<string> MakeMemberNames(size_t members)
+    {
+        std::vector<string> names;
+        for (size_t index = 0u; index < members; ++index)
+        {
+            names.push_back("field_" + to_string((index * 7919u) % 100003u));
+        }
+        return names;
+    }
+
+    /**
+     * @brief Make an array of \c objects objects that each have a member for every name in \c names.
+     * @remark The members of each object are in a different order, as a server that builds its responses from a
+     *      hash table would send them; none of the maps gets them presorted.
+     */
+    string MakeWideObjectDocument(std::vector<string> names, size_t objects)
+    {
+        string text("[");
+        uint32_t random = 12345u;
+        for (size_t object = 0u; object < objects; ++object)
+        {
+            for (size_t index = names.size(); index > 1u; --index)
+            {
+                random = random * 1103515245u + 12345u;
+                std::swap(names[index - 1u], names[(random >> 8) % index]);
+            }
+
+            text += (object > 0u) ? ",{" : "{";
+            for (size_t index = 0u; index < names.size(); ++index)
+            {
+                text += (index > 0u) ? ",\"" : "\"";
+                text += names[index];
+                text += "\":";
+                text += to_string(object * names.size() + index);
+            }
+            text += "}";
+        }
+        text += "]";
+        return text;
+    }
+
+    /**
+     * @brief Look up every member of every object of a parsed \c MakeWideObjectDocument().
+     */
+    template <typename JsonType>
+    uint64_t LookUpMembers(const JsonType& document, const std::vector<string>& names)
+    {
+        uint64_t sum = 0u;
+        for (const JsonType& object : document)
+        {
+            for (const string& name : names)
+            {
+                sum += object[name].template get<uint64_t>();
+            }
+        }
+        return sum;
+    }
+
+    /**
+     * @brief Make doubles of the kinds found in numeric payloads: prices and measurements with a few decimals,
+     *      integers scaled by a power of ten, and random bit patterns, subnormals included.
+     */
+    std::vector<double> MakeNumbers(size_t count)
+    {
+        std::vector<double> numbers;
+        uint64_t random = 88172645463325252ull;
+        while (numbers.size() < count)
+        {
+            random ^= random << 13;
+            random ^= random >> 7;
+            random ^= random << 17;
+
+            double value;
+            switch (numbers.size() % 4u)
+            {
+                case 0u:
+                    value = (double)(random % 10000000u) / 100.0;
+                    break;
+                case 1u:
+                    value = (double)(int64_t)random * 1e-6;
+                    break;
+                case 2u:
+                    random &= (numbers.size() % 8u == 2u) ? 0x800FFFFFFFFFFFFFull : UINT64_MAX;
+                    // fall through
+                default:
+                    std::memcpy(&value, &random, sizeof(value));
+                    break;
+            }
+            if (value - value == 0.0)
+            {
+                numbers.push_back(value);
+            }
+        }
+        return numbers;
+    }
+
+    /**
+     * @brief Make a request body of the kind an uploader sends: a few named readings, strings that need escapes
+     *      and an array of samples.
+     */
+    json MakeUploadBody()
+    {
+        json body;
+        body["sequence"] = 0;
+        body["deviceId"] = "sensor-0042";
+        body["comment"] = "Line one\nLine \"two\"\t\\ end";
+        for (int index = 0; index < 16; ++index)
+        {
+            body["reading_" + to_string(index)] = index * 1.25 - 3.0;
+        }
+        json& samples = body["samples"];
+        for (int index = 0; index < 64; ++index)
+        {
+            samples.push_back(20.0 + index * 0.1);
+        }
+        return body;
+    }
+
+    /**
+     * @brief Test whether two doubles have the same bits.
+     */
+    bool SameBits(double a, double b)
+    {
+        return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    BenchArgs args(argc, argv);
+    const long long minMegabytes = args.GetNumber("min_megabytes", 1);
+    const long long maxMegabytes = args.GetNumber("max_megabytes", 100);
+    const long long iterations = args.GetNumber("iterations", 3);
+    const long long objectMembers = args.GetNumber("object_members", 500);
+    const long long objects = args.GetNumber("objects", 2000);
+    const long long numberCount = args.GetNumber("numbers", 1000000);
+    const long long postBodies = args.GetNumber("post_bodies", 100000);
+
+    curl_global_init(CURL_GLOBAL_ALL);
+    int exitCode = 0;
+
+    try
+    {
+        BenchReport report("json");
+
+        // 1, 10, 100 MB by default.
+        for (long long megabytes = minMegabytes; megabytes <= maxMegabytes; megabytes *= 10)
+        {
+            CurlEasyWrapper curl;
+            {
+                TemporaryFile file(MakeJsonDocument((size_t)megabytes * 1024u * 1024u));
+                curl.Url(file.Url());
+                curl.Execute();
+            }
+            const size_t bytes = curl.GetReceiveBuffer().size();
+
+            json result;
+            result["name"] = "parse_" + to_string(megabytes) + "mb";
+            result["bytes"] = bytes;
+            result["iterations"] = iterations;
+
+            // ParseJsonResponse() reads the receive buffer in place.
+            result["receive_buffer"] = Measure
+            (
+                iterations,
+                bytes,
+                [&]()
+                {
+                    DoNotOptimize(curl.ParseJsonResponse<json>());
+                }
+            );
+
+            result["receive_buffer_flat"] = Measure
+            (
+                iterations,
+                bytes,
+                [&]()
+                {
+                    DoNotOptimize(curl.ParseJsonResponse<flat_json>());
+                }
+            );
+
+            // Two fields that the document does not have, so the extractor has to skip over all of it: the worst
+            // case, compared with building the whole tree to look them up.
+            CurlJsonExtractor extractor({ "/inputValue", "/errorMessage" });
+            result["extract_missing_fields"] = Measure
+            (
+                iterations,
+                bytes,
+                [&]()
+                {
+                    DoNotOptimize(extractor.Extract(curl.GetReceiveBuffer()));
+                }
+            );
+
+            // The structural index on its own with each instruction set, and the same extraction walking it.
+            const CurlSimdLevel bestLevel = CurlTextScan::GetSimdLevel();
+            const char* levelNames[] = { "scalar", "sse2", "avx2" };
+            CurlJsonIndex index;
+            for (int level = AbcdEFramework::Web::CURL_SIMD_SCALAR; level <= bestLevel; ++level)
+            {
+                CurlTextScan::SetSimdLevel((CurlSimdLevel)level);
+                result["index_build"][levelNames[level]] = Measure
+                (
+                    iterations,
+                    bytes,
+                    [&]()
+                    {
+                        index.Build(curl.GetReceiveBuffer());
+                    }
+                );
+            }
+            result["index_tokens"] = index.GetTokenCount();
+
+            result["extract_indexed_missing_fields"] = Measure
+            (
+                iterations,
+                bytes,
+                [&]()
+                {
+                    index.Build(curl.GetReceiveBuffer());
+                    DoNotOptimize(extractor.Extract(index));
+                }
+            );
+
+            // The pattern it replaces: copy the body into a string, then parse the string.
+            result["string_copy"] = Measure
+            (
+                iterations,
+                bytes,
+                [&]()
+                {
+                    string receivedData(curl.GetReceiveBuffer().begin(), curl.GetReceiveBuffer().end());
+                    DoNotOptimize(json::parse(receivedData));
+                }
+            );
+
+            // The same parser building a nlohmann::json on the heap and an arena_json in an arena. The arena is
+            // reset after each parse, which is what releases the document; the parser is kept.
+            CurlJsonPushParser<json> heapParser;
+            CurlJsonPushParser<arena_json> arenaParser;
+            result["push_parser"] = Measure
+            (
+                iterations,
+                bytes,
+                [&]()
+                {
+                    DoNotOptimize(PushParse(heapParser, curl.GetReceiveBuffer()));
+                }
+            );
+
+            CurlArena arena;
+            result["push_parser_arena"] = Measure
+            (
+                iterations,
+                bytes,
+                [&]()
+                {
+                    {
+                        CurlArena::Scope scope(arena);
+                        DoNotOptimize(arena.New<arena_json>(PushParse(arenaParser, curl.GetReceiveBuffer())));
+                    }
+                    arena.Reset();
+                }
+            );
+
+            // Releasing a parsed document on its own: the destructor of the tree compared with resetting the arena.
+            {
+                json* heapValue = new json(PushParse(heapParser, curl.GetReceiveBuffer()));
+                uint64_t start = NowNanoseconds();
+                delete heapValue;
+                uint64_t heapNs = NowNanoseconds() - start;
+
+                {
+                    CurlArena::Scope scope(arena);
+                    DoNotOptimize(arena.New<arena_json>(PushParse(arenaParser, curl.GetReceiveBuffer())));
+                }
+                start = NowNanoseconds();
+                arena.Reset();
+                uint64_t arenaNs = NowNanoseconds() - start;
+
+                result["release_ms"]["heap"] = (double)heapNs / 1e6;
+                result["release_ms"]["arena"] = (double)arenaNs / 1e6;
+                result["arena_bytes_reserved"] = arena.GetBytesReserved();
+            }
+
+            report.Add(result);
+        }
+
+        if (!CheckArenaReset())
+        {
+            cerr << "CurlArena::Reset() did not keep the block of a large allocation" << endl;
+            exitCode = 1;
+        }
+
+        // Objects with hundreds of members: std::map against the flat vector with a hash index of flat_json.
+        {
+            const size_t flatMapFailures = CheckReservedFlatMap();
+            if (flatMapFailures > 0u)
+            {
+                cerr << flatMapFailures << " keys of a reserved CurlFlatMap were not found or were added twice" << endl;
+                exitCode = 1;
+            }
+
+            const std::vector<string> names(MakeMemberNames((size_t)objectMembers));
+            const string text(MakeWideObjectDocument(names, (size_t)objects));
+
+            json result;
+            result["name"] = "wide_objects";
+            result["bytes"] = text.size();
+            result["object_members"] = objectMembers;
+            result["objects"] = objects;
+            result["iterations"] = iterations;
+
+            result["parse"]["json"] = Measure
+            (
+                iterations,
+                text.size(),
+                [&]()
+                {
+                    DoNotOptimize(json::parse(text));
+                }
+            );
+            result["parse"]["flat_json"] = Measure
+            (
+                iterations,
+                text.size(),
+                [&]()
+                {
+                    DoNotOptimize(flat_json::parse(text));
+                }
+            );
+
+            const json heapDocument(json::parse(text));
+            const flat_json flatDocument(flat_json::parse(text));
+            result["lookup"]["json"] = Measure
+            (
+                iterations,
+                text.size(),
+                [&]()
+                {
+                    DoNotOptimize(LookUpMembers(heapDocument, names));
+                }
+            );
+            result["lookup"]["flat_json"] = Measure
+            (
+                iterations,
+                text.size(),
+                [&]()
+                {
+                    DoNotOptimize(LookUpMembers(flatDocument, names));
+                }
+            );
+
+            result["dump"]["json"] = Measure
+            (
+                iterations,
+                text.size(),
+                [&]()
+                {
+                    DoNotOptimize(heapDocument.dump());
+                }
+            );
+            result["dump"]["flat_json"] = Measure
+            (
+                iterations,
+                text.size(),
+                [&]()
+                {
+                    DoNotOptimize(flatDocument.dump());
+                }
+            );
+
+            report.Add(result);
+        }
+
+        // Printing and reading numbers: CurlJsonNumbers against the C library, and json.hpp using it.
+        {
+            const std::vector<double> numbers(MakeNumbers((size_t)numberCount));
+            char buffer[CurlJsonNumbers::MaxFormattedSize];
+
+            // A JSON array of the shortest text of each number, and the same with 17 digits from snprintf().
+            string shortest("[");
+            string full("[");
+            std::vector<size_t> starts;
+            std::vector<size_t> fullStarts;
+            for (double value : numbers)
+            {
+                CurlJsonNumbers::TryFormat(value, buffer);
+                shortest += (starts.empty()) ? "" : ",";
+                starts.push_back(shortest.size());
+                shortest += buffer;
+
+                std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+                full += (fullStarts.empty()) ? "" : ",";
+                fullStarts.push_back(full.size());
+                full += buffer;
+            }
+            shortest += "]";
+            full += "]";
+            starts.push_back(shortest.size());
+            fullStarts.push_back(full.size());
+
+            // Every number must read back with the same bits, and reading 17 digits must agree with strtod().
+            size_t mismatches = 0u;
+            size_t fallbacks = 0u;
+            for (size_t index = 0u; index < numbers.size(); ++index)
+            {
+                const char* text = shortest.c_str() + starts[index];
+                double value;
+                if (!CurlJsonNumbers::TryParse(text, shortest.c_str() + starts[index + 1u] - 1, value))
+                {
+                    ++fallbacks;
+                    value = std::strtod(text, nullptr);
+                }
+                mismatches += (SameBits(value, numbers[index]) && SameBits(std::strtod(text, nullptr), numbers[index])) ? 0u : 1u;
+
+                text = full.c_str() + fullStarts[index];
+                if (!CurlJsonNumbers::TryParse(text, full.c_str() + fullStarts[index + 1u] - 1, value))
+                {
+                    ++fallbacks;
+                    value = std::strtod(text, nullptr);
+                }
+                mismatches += SameBits(value, std::strtod(text, nullptr)) ? 0u : 1u;
+            }
+
+            const json document(json::parse(shortest));
+            const json reparsed(json::parse(document.dump()));
+            for (size_t index = 0u; index < numbers.size(); ++index)
+            {
+                mismatches += SameBits(reparsed[index].get<double>(), numbers[index]) ? 0u : 1u;
+            }
+
+            json result;
+            result["name"] = "numbers";
+            result["numbers"] = numberCount;
+            result["bytes"] = shortest.size();
+            result["iterations"] = iterations;
+            result["round_trip_mismatches"] = mismatches;
+            result["parse_fallbacks"] = fallbacks;
+
+            result["format"]["snprintf"] = Measure
+            (
+                iterations,
+                full.size(),
+                [&]()
+                {
+                    for (double value : numbers)
+                    {
+                        DoNotOptimize(std::snprintf(buffer, sizeof(buffer), "%.17g", value));
+                    }
+                }
+            );
+            result["format"]["curl_json_numbers"] = Measure
+            (
+                iterations,
+                shortest.size(),
+                [&]()
+                {
+                    for (double value : numbers)
+                    {
+                        DoNotOptimize(CurlJsonNumbers::TryFormat(value, buffer));
+                    }
+                }
+            );
+
+            result["parse"]["strtod"] = Measure
+            (
+                iterations,
+                shortest.size(),
+                [&]()
+                {
+                    for (size_t index = 0u; index < numbers.size(); ++index)
+                    {
+                        DoNotOptimize(std::strtod(shortest.c_str() + starts[index], nullptr));
+                    }
+                }
+            );
+            result["parse"]["curl_json_numbers"] = Measure
+            (
+                iterations,
+                shortest.size(),
+                [&]()
+                {
+                    double value;
+                    for (size_t index = 0u; index < numbers.size(); ++index)
+                    {
+                        CurlJsonNumbers::TryParse(shortest.c_str() + starts[index], shortest.c_str() + starts[index + 1u] - 1, value);
+                        DoNotOptimize(value);
+                    }
+                }
+            );
+
+            result["json_parse"] = Measure
+            (
+                iterations,
+                shortest.size(),
+                [&]()
+                {
+                    DoNotOptimize(json::parse(shortest));
+                }
+            );
+            result["json_dump"] = Measure
+            (
+                iterations,
+                shortest.size(),
+                [&]()
+                {
+                    DoNotOptimize(document.dump());
+                }
+            );
+
+            report.Add(result);
+            if (mismatches > 0u)
+            {
+                cerr << mismatches << " numbers did not read back with the same bits" << endl;
+                exitCode = 1;
+            }
+        }
+
+        // Serialising a request body: through a stringstream into PostFields(), as demo_upload did, and with
+        // PostJson() straight into the POST data. The sequence number changes so that every body is new.
+        {
+            json body(MakeUploadBody());
+            CurlEasyWrapper curl;
+            curl.Post();
+            curl.PostJson(body, "UploadValue=");
+            const string expected("UploadValue=" + body.dump());
+            const bool sameText = (curl.Snapshot().postData == expected);
+
+            json result;
+            result["name"] = "post_body";
+            result["bytes"] = expected.size();
+            result["iterations"] = postBodies;
+            result["same_text_as_dump"] = sameText;
+
+            long long sequence = 0;
+            result["stringstream"] = Measure
+            (
+                postBodies,
+                expected.size(),
+                [&]()
+                {
+                    body["sequence"] = ++sequence;
+                    std::stringstream stream;
+                    stream << "UploadValue=" << body;
+                    string text(stream.str());
+                    curl.PostFields(text);
+                    curl.PostFieldSize(text.size());
+                }
+            );
+            result["post_json"] = Measure
+            (
+                postBodies,
+                expected.size(),
+                [&]()
+                {
+                    body["sequence"] = ++sequence;
+                    curl.PostJson(body, "UploadValue=");
+                }
+            );
+
+            report.Add(result);
+            if (!sameText)
+            {
+                cerr << "PostJson() did not write the same text as dump()" << endl;
+                exitCode = 1;
+            }
+        }
+
+        // Encoding a request body as CBOR and MessagePack: with to_cbor() and to_msgpack() into a new vector that
+        // is copied into PostFields(), and with PostCbor() and PostMsgPack() straight into the POST data.
+        {
+            json body(MakeUploadBody());
+            CurlEasyWrapper curl;
+            curl.Post();
+            curl.PostCbor(body);
+            const std::vector<uint8_t> cbor(json::to_cbor(body));
+            const bool sameCbor = (curl.Snapshot().postData == string(cbor.begin(), cbor.end()));
+            curl.PostMsgPack(body);
+            const std::vector<uint8_t> msgPack(json::to_msgpack(body));
+            const bool sameMsgPack = (curl.Snapshot().postData == string(msgPack.begin(), msgPack.end()));
+
+            json result;
+            result["name"] = "binary_body";
+            result["json_bytes"] = body.dump().size();
+            result["cbor_bytes"] = cbor.size();
+            result["msgpack_bytes"] = msgPack.size();
+            result["iterations"] = postBodies;
+            result["same_bytes_as_to_cbor"] = sameCbor;
+            result["same_bytes_as_to_msgpack"] = sameMsgPack;
+
+            long long sequence = 0;
+            result["to_cbor"] = Measure
+            (
+                postBodies,
+                cbor.size(),
+                [&]()
+                {
+                    body["sequence"] = ++sequence;
+                    std::vector<uint8_t> bytes(json::to_cbor(body));
+                    curl.PostFields(string(bytes.begin(), bytes.end()));
+                }
+            );
+            result["post_cbor"] = Measure
+            (
+                postBodies,
+                cbor.size(),
+                [&]()
+                {
+                    body["sequence"] = ++sequence;
+                    curl.PostCbor(body);
+                }
+            );
+            result["to_msgpack"] = Measure
+            (
+                postBodies,
+                msgPack.size(),
+                [&]()
+                {
+                    body["sequence"] = ++sequence;
+                    std::vector<uint8_t> bytes(json::to_msgpack(body));
+                    curl.PostFields(string(bytes.begin(), bytes.end()));
+                }
+            );
+            result["post_msgpack"] = Measure
+            (
+                postBodies,
+                msgPack.size(),
+                [&]()
+                {
+                    body["sequence"] = ++sequence;
+                    curl.PostMsgPack(body);
+                }
+            );
+
+            report.Add(result);
+            if (!sameCbor || !sameMsgPack)
+            {
+                cerr << "PostCbor() or PostMsgPack() did not write the same bytes as json.hpp" << endl;
+                exitCode = 1;
+            }
+        }
+
+        // Decoding a CBOR and a MessagePack response body of the smallest document size: in place with
+        // ParseCborResponse() and ParseMsgPackResponse(), and from a copy of the receive buffer.
+        {
+            const json document(json::parse(MakeJsonDocument((size_t)minMegabytes * 1024u * 1024u)));
+            const std::vector<uint8_t> encodings[2] = { json::to_cbor(document), json::to_msgpack(document) };
+            const char* names[2] = { "cbor", "msgpack" };
+
+            json result;
+            result["name"] = "binary_response";
+            result["iterations"] = iterations;
+            bool sameValue = true;
+            for (size_t format = 0u; format < 2u; ++format)
+            {
+                CurlEasyWrapper curl;
+                {
+                    TemporaryFile file(string(encodings[format].begin(), encodings[format].end()));
+                    curl.Url(file.Url());
+                    curl.Execute();
+                }
+                const size_t bytes = curl.GetReceiveBuffer().size();
+                const bool isCbor = (format == 0u);
+                sameValue = sameValue && ((isCbor ? curl.ParseCborResponse<json>() : curl.ParseMsgPackResponse<json>()) == document);
+
+                result[string(names[format]) + "_bytes"] = bytes;
+                result[string(names[format]) + "_receive_buffer"] = Measure
+                (
+                    iterations,
+                    bytes,
+                    [&]()
+                    {
+                        DoNotOptimize(isCbor ? curl.ParseCborResponse<json>() : curl.ParseMsgPackResponse<json>());
+                    }
+                );
+                result[string(names[format]) + "_copy"] = Measure
+                (
+                    iterations,
+                    bytes,
+                    [&]()
+                    {
+                        const std::vector<uint8_t> copy(curl.GetReceiveBuffer().begin(), curl.GetReceiveBuffer().end());
+                        DoNotOptimize(isCbor ? json::from_cbor(copy) : json::from_msgpack(copy));
+                    }
+                );
+            }
+            result["same_value"] = sameValue;
+
+            report.Add(result);
+            if (!sameValue)
+            {
+                cerr << "A CBOR or MessagePack response did not decode to the document that was encoded" << endl;
+                exitCode = 1;
+            }
+        }
+
+        report.Print();
+    }
+    catch (CurlException& ex)
+    {
+        cerr << ex.what() << endl;
+        exitCode = 1;
+    }
+    catch (exception& ex)
+    {
+        cerr << ex.what() << endl;
+        exitCode = 1;
+    }
+
+    curl_global_cleanup();
+    return exitCode;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file
+ * @brief Request latency percentiles of CurlEasyWrapper against the loopback server.
+ * @date 2026-10-19 [JFDR] Created.
+ */
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <CurlEasyWrapper.hpp>
+#include "BenchSupport.hpp"
+#include "LoopbackHttpServer.hpp"
+
+using std::cerr;
+using std::endl;
+using std::exception;
+using std::string;
+using std::to_string;
+using AbcdEFramework::Web::CurlEasyWrapper;
+using AbcdEFramework::Web::CurlException;
+using AbcdEFramework::Web::Bench::BenchArgs;
+using AbcdEFramework::Web::Bench::BenchReport;
+using AbcdEFramework::Web::Bench::LatencyRecorder;
+using AbcdEFramework::Web::Bench::LoopbackHttpServer;
+using AbcdEFramework::Web::Bench::NowNanoseconds;
+using json = nlohmann::json;
+
+namespace
+{
+    /**
+     * @brief Measure the latency of \c requests sequential requests to \c url over one kept-alive connection.
+     */
+    json MeasureLatency(const string& name, const string& url, long long requests)
+    {
+        CurlEasyWrapper curl;
+        curl.Url(url);
+        curl.Execute();
+        curl.ClearReceiveBuffer();
+
+        LatencyRecorder recorder((size_t)requests);
+        for (long long requestIndex = 0; requestIndex < requests; ++requestIndex)
+        {
+            uint64_t start = NowNanoseconds();
+            curl.Execute();
+            recorder.Record(NowNanoseconds() - start);
+            curl.ClearReceiveBuffer();
+        }
+
+        json result = recorder.ToJson();
+        result["name"] = name;
+        return result;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    BenchArgs args(argc, argv);
+    const long long requests = args.GetNumber("requests", 10000);
+    const long long delayUs = args.GetNumber("delay_us", 0);
+
+    curl_global_init(CURL_GLOBAL_ALL);
+    int exitCode = 0;
+
+    try
+    {
+        LoopbackHttpServer server;
+        server.Start();
+        BenchReport report("latency");
+
+        const long long sizes[] = { 0, 1024, 64 * 1024 };
+        for (long long bodySize : sizes)
+        {
+            string query("/bytes?size=" + to_string(bodySize) + "&delay_us=" + to_string(delayUs));
+            report.Add(MeasureLatency("get_" + to_string(bodySize), server.Url(query), requests));
+            report.Add(MeasureLatency("get_chunked_" + to_string(bodySize), server.Url(query + "&chunk=4096"), requests));
+        }
+
+        server.Stop();
+        report.Print();
+    }
+    catch (CurlException& ex)
+    {
+        cerr << ex.what() << endl;
+        exitCode = 1;
+    }
+    catch (exception& ex)
+    {
+        cerr << ex.what() << endl;
+        exitCode = 1;
+    }
+
+    curl_global_cleanup();
+    return exitCode;
+}
@@ -0,0 +1,720 @@
+/**
+ * @file
+ * @brief Microbenchmarks that compare the cost of CurlEasyWrapper operations with the equivalent raw libcurl calls.
+ * @remark Every entry reports nanoseconds, cycles, \c operator \c new allocations and allocated bytes per operation
+ *      for the wrapper and for the raw equivalent. No network traffic takes place.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] The setopt cases use the typed Set<>() method.
+ * @date 2026-10-19 [JFDR] Added the cost of a failed transfer with and without an exception.
+ * @date 2026-10-19 [JFDR] Added the polling loop and snapshot cases for the cached option values.
+ * @date 2026-10-19 [JFDR] Added cloning a request template compared with configuring a new wrapper.
+ * @date 2026-10-19 [JFDR] Added applying a prepared request to a pooled handle.
+ * @date 2026-10-19 [JFDR] Added building and interning a CurlHeaderList.
+ * @date 2026-10-19 [JFDR] Added storing and reading the response headers.
+ * @date 2026-10-19 [JFDR] Added parsing the response headers with the vectorised scanner and with the scalar one.
+ * @date 2026-10-19 [JFDR] Added parsing a JSON body in the write callback compared with buffering it first.
+ * @date 2026-10-19 [JFDR] The JSON document is built by MakeJsonDocument() of BenchSupport.
+ * @date 2026-10-19 [JFDR] The setopt comparisons use options that Set<>() accepts.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <strings.h>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <CurlEasyWrapper.hpp>
+#include <CurlJsonSink.hpp>
+#include <CurlPreparedRequest.hpp>
+#include <CurlTextScan.hpp>
+#include "BenchSupport.hpp"
+
+using std::cerr;
+using std::endl;
+using std::exception;
+using std::string;
+using std::to_string;
+using std::vector;
+using AbcdEFramework::Web::CurlEasyWrapper;
+using AbcdEFramework::Web::CurlException;
+using AbcdEFramework::Web::CurlHeaderList;
+using AbcdEFramework::Web::CurlJsonSink;
+using AbcdEFramework::Web::CurlOptionState;
+using AbcdEFramework::Web::CurlPreparedRequest;
+using AbcdEFramework::Web::CurlResponseHeaders;
+using AbcdEFramework::Web::CurlResult;
+using AbcdEFramework::Web::CurlSList;
+using AbcdEFramework::Web::CurlSimdLevel;
+using AbcdEFramework::Web::CurlTextScan;
+using AbcdEFramework::Web::Bench::AllocationCounters;
+using AbcdEFramework::Web::Bench::BenchArgs;
+using AbcdEFramework::Web::Bench::BenchReport;
+using AbcdEFramework::Web::Bench::DoNotOptimize;
+using AbcdEFramework::Web::Bench::GetAllocationCounters;
+using AbcdEFramework::Web::Bench::MakeJsonDocument;
+using AbcdEFramework::Web::Bench::NowNanoseconds;
+using AbcdEFramework::Web::Bench::ReadCycleCounter;
+using json = nlohmann::json;
+
+namespace
+{
+    /**
+     * @brief Gives the benchmarks access to the protected members of the wrapper.
+     */
+    class WrapperProbe : public CurlEasyWrapper
+    {
+        public:
+            using CurlEasyWrapper::CurlSinkDataProc;
+            using CurlEasyWrapper::CurlWriteDataProc;
+    };
+
+    /**
+     * @brief Run \c operation \c iterations times and report the cost per operation.
+     */
+    template <typename Operation>
+    json Measure(long long iterations, Operation operation)
+    {
+        for (long long warmup = 0; warmup < (iterations / 10) + 1; ++warmup)
+        {
+            operation();
+        }
+
+        AllocationCounters allocBefore = GetAllocationCounters();
+        uint64_t nsBefore = NowNanoseconds();
+        uint64_t cyclesBefore = ReadCycleCounter();
+        for (long long iteration = 0; iteration < iterations; ++iteration)
+        {
+            operation();
+        }
+        uint64_t cycles = ReadCycleCounter() - cyclesBefore;
+        uint64_t ns = NowNanoseconds() - nsBefore;
+        AllocationCounters allocs = GetAllocationCounters() - allocBefore;
+
+        json result;
+        result["ns_per_op"] = (double)ns / (double)iterations;
+        result["cycles_per_op"] = (double)cycles / (double)iterations;
+        result["allocations_per_op"] = (double)allocs.allocations / (double)iterations;
+        result["bytes_per_op"] = (double)allocs.bytes / (double)iterations;
+        return result;
+    }
+
+    /**
+     * @brief Measure the wrapper and the raw variant of an operation and put them side by side.
+     */
+    template <typename WrapperOperation, typename RawOperation>
+    json Compare(const string& name, long long iterations, WrapperOperation wrapperOperation, RawOperation rawOperation)
+    {
+        json result;
+        result["name"] = name;
+        result["iterations"] = iterations;
+        result["wrapper"] = Measure(iterations, wrapperOperation);
+        result["raw"] = Measure(iterations, rawOperation);
+        result["overhead_cycles_per_op"] =
+            result["wrapper"]["cycles_per_op"].get<double>() - result["raw"]["cycles_per_op"].get<double>();
+        return result;
+    }
+
+    /**
+     * @brief Build a response header block with a status line, \c fieldCount headers and the empty line.
+     */
+    vector<string> MakeResponseHeaderLines(size_t fieldCount)
+    {
+        const char* const commonLines[] =
+        {
+            "Date: Mon, 19 Oct 2026 10:00:00 GMT\r\n",
+            "Content-Type: application/json; charset=utf-8\r\n",
+            "Content-Length: 1024\r\n",
+            "Cache-Control: private, max-age=0\r\n",
+            "ETag: \"33a64df551425fcc55e4d42a148795d9f25f89d4\"\r\n",
+            "Retry-After: 120\r\n",
+            "Server: upstream\r\n",
+            "Vary: Accept-Encoding\r\n"
+        };
+        const size_t commonCount = sizeof(commonLines) / sizeof(commonLines[0]);
+
+        vector<string> lines;
+        lines.push_back("HTTP/1.1 200 OK\r\n");
+        for (size_t index = 0u; index < fieldCount; ++index)
+        {
+            lines.push_back
+            (
+                (index < commonCount) ? string(commonLines[index])
+                    : "X-Upstream-Trace-" + to_string(index) + ": 0123456789abcdef0123456789abcdef\r\n"
+            );
+        }
+        lines.push_back("\r\n");
+        return lines;
+    }
+
+    /**
+     * @brief Raw equivalent of the wrapper constructor and destructor.
+     */
+    void RawConstructDestroy(char* errorBuffer, vector<unsigned char>* receiveBuffer)
+    {
+        CURL* handle = curl_easy_init();
+        curl_easy_setopt(handle, CURLOPT_NOSIGNAL, 1L);
+        curl_easy_setopt(handle, CURLOPT_ERRORBUFFER, errorBuffer);
+        curl_easy_setopt(handle, CURLOPT_USERAGENT, "libcurl-agent/1.0");
+        curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, WrapperProbe::CurlWriteDataProc);
+        curl_easy_setopt(handle, CURLOPT_WRITEDATA, receiveBuffer);
+        curl_easy_setopt(handle, CURLOPT_PRIVATE, (void*)handle);
+        curl_easy_cleanup(handle);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    BenchArgs args(argc, argv);
+    const long long iterations = args.GetNumber("iterations", 200000);
+    const long long appendBytes = args.GetNumber("append_megabytes", 256) * 1024 * 1024;
+
+    curl_global_init(CURL_GLOBAL_ALL);
+    int exitCode = 0;
+
+    try
+    {
+        BenchReport report("overhead");
+        WrapperProbe probe;
+        CURL* rawHandle = curl_easy_init();
+        char rawErrorBuffer[CURL_ERROR_SIZE];
+        vector<unsigned char> rawReceiveBuffer;
+        const string url("http://127.0.0.1:8080/some/resource/path?query=value&other=1");
+        const string agent("CurlWrapper-bench/1.0");
+        const string escapeInput("key=value with spaces & symbols/?#[]@!$'()*+,;");
+
+        report.Add
+        (
+            Compare
+            (
+                "construct_destroy",
+                iterations / 10,
+                []() { CurlEasyWrapper curl; },
+                [&]() { RawConstructDestroy(rawErrorBuffer, &rawReceiveBuffer); }
+            )
+        );
+
+        report.Add
+        (
+            Compare
+            (
+                "setopt_string",
+                iterations,
+                [&]() { probe.Set<CURLOPT_REFERER>(url.c_str()); },
+                [&]() { curl_easy_setopt(rawHandle, CURLOPT_REFERER, url.c_str()); }
+            )
+        );
+
+        report.Add
+        (
+            Compare
+            (
+                "setopt_long",
+                iterations,
+                [&]() { probe.Set<CURLOPT_CONNECTTIMEOUT>(30L); },
+                [&]() { curl_easy_setopt(rawHandle, CURLOPT_CONNECTTIMEOUT, 30L); }
+            )
+        );
+
+        report.Add
+        (
+            Compare
+            (
+                "setopt_pointer",
+                iterations,
+                [&]() { probe.Set<CURLOPT_DEBUGDATA>((void*)&probe); },
+                [&]() { curl_easy_setopt(rawHandle, CURLOPT_DEBUGDATA, (void*)&probe); }
+            )
+        );
+
+        report.Add
+        (
+            Compare
+            (
+                "url",
+                iterations,
+                [&]() { probe.Url(url); },
+                [&]() { curl_easy_setopt(rawHandle, CURLOPT_URL, url.c_str()); }
+            )
+        );
+
+        report.Add
+        (
+            Compare
+            (
+                "user_agent",
+                iterations,
+                [&]() { probe.UserAgent(agent); },
+                [&]() { curl_easy_setopt(rawHandle, CURLOPT_USERAGENT, agent.c_str()); }
+            )
+        );
+
+        report.Add
+        (
+            Compare
+            (
+                "escape",
+                iterations,
+                [&]()
+                {
+                    string escaped(probe.Escape(escapeInput));
+                    DoNotOptimize(escaped);
+                },
+                [&]()
+                {
+                    char* escaped = curl_easy_escape(rawHandle, escapeInput.c_str(), (int)escapeInput.size());
+                    DoNotOptimize(escaped);
+                    curl_free(escaped);
+                }
+            )
+        );
+
+        report.Add
+        (
+            Compare
+            (
+                "slist_initializer_list",
+                iterations,
+                []()
+                {
+                    CurlSList headers({ "Accept: application/json", "Content-Type: application/json", "charsets: utf-8" });
+                    DoNotOptimize(headers);
+                },
+                []()
+                {
+                    curl_slist* headers = nullptr;
+                    headers = curl_slist_append(headers, "Accept: application/json");
+                    headers = curl_slist_append(headers, "Content-Type: application/json");
+                    headers = curl_slist_append(headers, "charsets: utf-8");
+                    DoNotOptimize(headers);
+                    curl_slist_free_all(headers);
+                }
+            )
+        );
+
+        report.Add
+        (
+            Compare
+            (
+                "header_list_initializer_list",
+                iterations,
+                []()
+                {
+                    CurlHeaderList headers({ "Accept: application/json", "Content-Type: application/json", "charsets: utf-8" });
+                    const curl_slist* listPtr = headers;
+                    DoNotOptimize(listPtr);
+                },
+                []()
+                {
+                    curl_slist* headers = nullptr;
+                    headers = curl_slist_append(headers, "Accept: application/json");
+                    headers = curl_slist_append(headers, "Content-Type: application/json");
+                    headers = curl_slist_append(headers, "charsets: utf-8");
+                    DoNotOptimize(headers);
+                    curl_slist_free_all(headers);
+                }
+            )
+        );
+
+        // Looking up a header set that is already in use, compared with building it again.
+        {
+            const CurlHeaderList pattern({ "Accept: application/json", "Content-Type: application/json", "charsets: utf-8" });
+            std::shared_ptr<const CurlHeaderList> inUse(CurlHeaderList::Intern(pattern));
+
+            report.Add
+            (
+                Compare
+                (
+                    "header_list_intern",
+                    iterations,
+                    [&]()
+                    {
+                        std::shared_ptr<const CurlHeaderList> headers(CurlHeaderList::Intern(pattern));
+                        DoNotOptimize(headers);
+                    },
+                    []()
+                    {
+                        curl_slist* headers = nullptr;
+                        headers = curl_slist_append(headers, "Accept: application/json");
+                        headers = curl_slist_append(headers, "Content-Type: application/json");
+                        headers = curl_slist_append(headers, "charsets: utf-8");
+                        DoNotOptimize(headers);
+                        curl_slist_free_all(headers);
+                    }
+                )
+            );
+        }
+
+        // The options a polling loop sets before every request, with values that do not change.
+        {
+            std::shared_ptr<const CurlSList> headers(new CurlSList({ "Accept: application/json", "Cache-Control: no-cache" }));
+            curl_slist* rawHeaders = nullptr;
+            rawHeaders = curl_slist_append(rawHeaders, "Accept: application/json");
+            rawHeaders = curl_slist_append(rawHeaders, "Cache-Control: no-cache");
+
+            report.Add
+            (
+                Compare
+                (
+                    "polling_cycle_options",
+                    iterations,
+                    [&]()
+                    {
+                        probe.Url(url);
+                        probe.UserAgent(agent);
+                        probe.TimeoutSeconds(30l);
+                        probe.HttpHeader(headers);
+                    },
+                    [&]()
+                    {
+                        curl_easy_setopt(rawHandle, CURLOPT_URL, url.c_str());
+                        curl_easy_setopt(rawHandle, CURLOPT_USERAGENT, agent.c_str());
+                        curl_easy_setopt(rawHandle, CURLOPT_TIMEOUT, 30l);
+                        curl_easy_setopt(rawHandle, CURLOPT_HTTPHEADER, rawHeaders);
+                    }
+                )
+            );
+
+            // Switching between two request templates.
+            CurlEasyWrapper templated;
+            templated.Url(url);
+            templated.HttpHeader(headers);
+            const CurlOptionState getState(templated.Snapshot());
+            templated.Url(url + "&post=1");
+            templated.PostFields("{\"key\":\"value\"}");
+            const CurlOptionState postState(templated.Snapshot());
+            bool usePost = false;
+
+            report.Add
+            (
+                Compare
+                (
+                    "restore_snapshot",
+                    iterations,
+                    [&]()
+                    {
+                        usePost = !usePost;
+                        templated.Restore(usePost ? postState : getState);
+                    },
+                    [&]()
+                    {
+                        usePost = !usePost;
+                        if (usePost)
+                        {
+                            curl_easy_setopt(rawHandle, CURLOPT_URL, postState.url.c_str());
+                            curl_easy_setopt(rawHandle, CURLOPT_POSTFIELDS, postState.postData.c_str());
+                        }
+                        else
+                        {
+                            curl_easy_setopt(rawHandle, CURLOPT_URL, getState.url.c_str());
+                            curl_easy_setopt(rawHandle, CURLOPT_HTTPGET, 1l);
+                        }
+                    }
+                )
+            );
+
+            // Stamping out requests from a configured template.
+            report.Add
+            (
+                Compare
+                (
+                    "clone_template",
+                    iterations / 10,
+                    [&]()
+                    {
+                        CurlEasyWrapper request(templated.Clone());
+                        DoNotOptimize(request);
+                    },
+                    [&]()
+                    {
+                        CurlEasyWrapper request;
+                        request.Url(postState.url);
+                        request.HttpHeader(headers);
+                        request.PostFields(postState.postData);
+                        DoNotOptimize(request);
+                    }
+                )
+            );
+
+            // Applying a shared prepared request where only the query string changes.
+            const CurlPreparedRequest prepared
+            (
+                CurlPreparedRequest::Builder()
+                    .UrlPrefix(url)
+                    .UserAgent(agent)
+                    .TimeoutMSeconds(30000l)
+                    .HttpHeader(headers)
+                    .Set<CURLOPT_CONNECTTIMEOUT_MS>(5000l)
+                    .Build()
+            );
+            const string queries[2] = { "&id=1", "&id=2" };
+            CurlEasyWrapper pooled;
+            string rawUrl;
+            size_t queryIndex = 0u;
+
+            report.Add
+            (
+                Compare
+                (
+                    "prepared_request_apply",
+                    iterations,
+                    [&]()
+                    {
+                        queryIndex ^= 1u;
+                        prepared.Apply(pooled, queries[queryIndex]);
+                    },
+                    [&]()
+                    {
+                        queryIndex ^= 1u;
+                        rawUrl.assign(url).append(queries[queryIndex]);
+                        curl_easy_setopt(rawHandle, CURLOPT_URL, rawUrl.c_str());
+                        curl_easy_setopt(rawHandle, CURLOPT_USERAGENT, agent.c_str());
+                        curl_easy_setopt(rawHandle, CURLOPT_TIMEOUT_MS, 30000l);
+                        curl_easy_setopt(rawHandle, CURLOPT_HTTPHEADER, rawHeaders);
+                        curl_easy_setopt(rawHandle, CURLOPT_CONNECTTIMEOUT_MS, 5000l);
+                    }
+                )
+            );
+
+            curl_easy_setopt(rawHandle, CURLOPT_HTTPHEADER, nullptr);
+            curl_slist_free_all(rawHeaders);
+        }
+
+        // A transfer that fails before any I/O, reported through an exception and through a CurlResult.
+        {
+            CurlEasyWrapper failing;
+            failing.Url("unsupported://127.0.0.1/");
+            CURL* rawFailing = curl_easy_init();
+            curl_easy_setopt(rawFailing, CURLOPT_URL, "unsupported://127.0.0.1/");
+
+            report.Add
+            (
+                Compare
+                (
+                    "execute_error_throw",
+                    iterations / 10,
+                    [&]()
+                    {
+                        try
+                        {
+                            failing.Execute();
+                        }
+                        catch (CurlException& ex)
+                        {
+                            DoNotOptimize(ex);
+                        }
+                    },
+                    [&]() { DoNotOptimize(curl_easy_perform(rawFailing)); }
+                )
+            );
+
+            report.Add
+            (
+                Compare
+                (
+                    "execute_error_result",
+                    iterations / 10,
+                    [&]()
+                    {
+                        CurlResult result(failing.TryExecute());
+                        DoNotOptimize(result);
+                    },
+                    [&]() { DoNotOptimize(curl_easy_perform(rawFailing)); }
+                )
+            );
+
+            curl_easy_cleanup(rawFailing);
+        }
+
+        // Storing a block of 32 response headers and looking up five of them, compared with a callback that keeps
+        // one string per line and compares the names with strncasecmp().
+        {
+            const vector<string> headerLines(MakeResponseHeaderLines(32u));
+            const char* const lookups[] = { "Content-Type", "ETag", "Cache-Control", "Retry-After", "X-Missing" };
+            CurlResponseHeaders responseHeaders;
+            vector<string> rawLines;
+
+            auto feedWrapper = [&]()
+            {
+                responseHeaders.Clear();
+                for (const string& line : headerLines)
+                {
+                    CurlResponseHeaders::CurlHeaderDataProc(const_cast<char*>(line.data()), 1u, line.size(), &responseHeaders);
+                }
+            };
+            auto feedRaw = [&]()
+            {
+                rawLines.clear();
+                for (const string& line : headerLines)
+                {
+                    rawLines.push_back(line);
+                }
+            };
+
+            report.Add(Compare("response_headers_store", iterations / 10, feedWrapper, feedRaw));
+
+            // Storing, parsing and lookups. The "raw" side is the same code with the scalar scanner.
+            auto parseAndFind = [&]()
+            {
+                feedWrapper();
+                for (const char* name : lookups)
+                {
+                    DoNotOptimize(responseHeaders.Find(name));
+                }
+            };
+            const CurlSimdLevel detectedLevel = CurlTextScan::GetSimdLevel();
+            json simdResult = Compare
+            (
+                "response_headers_parse_simd",
+                iterations / 10,
+                [&]()
+                {
+                    CurlTextScan::SetSimdLevel(detectedLevel);
+                    parseAndFind();
+                },
+                [&]()
+                {
+                    CurlTextScan::SetSimdLevel(AbcdEFramework::Web::CURL_SIMD_SCALAR);
+                    parseAndFind();
+                }
+            );
+            CurlTextScan::SetSimdLevel(detectedLevel);
+            simdResult["simd_level"] = (int)detectedLevel;
+            report.Add(simdResult);
+
+            report.Add
+            (
+                Compare
+                (
+                    "response_headers_find",
+                    iterations / 10,
+                    [&]()
+                    {
+                        feedWrapper();
+                        for (const char* name : lookups)
+                        {
+                            DoNotOptimize(responseHeaders.Find(name));
+                        }
+                    },
+                    [&]()
+                    {
+                        feedRaw();
+                        for (const char* name : lookups)
+                        {
+                            size_t nameLength = ::strlen(name);
+                            for (const string& line : rawLines)
+                            {
+                                if ((line.size() > nameLength) && (':' == line[nameLength])
+                                    && (::strncasecmp(line.c_str(), name, nameLength) == 0))
+                                {
+                                    DoNotOptimize(line);
+                                    break;
+                                }
+                            }
+                        }
+                    }
+                )
+            );
+        }
+
+        // Parsing a JSON body chunk by chunk in the write callback, compared with buffering the body, copying it
+        // into a string and parsing it, as demo_fetch did.
+        {
+            const string document = MakeJsonDocument((size_t)args.GetNumber("json_kilobytes", 1024) * 1024u);
+            const size_t jsonChunkSize = 16384u;
+            CurlJsonSink<> sink;
+            WrapperProbe probe;
+            probe.ReceiveSink(&sink);
+            vector<unsigned char> bodyBuffer;
+            json result = Compare
+            (
+                "json_sink_parse",
+                iterations / 10000 + 1,
+                [&]()
+                {
+                    sink.Reset();
+                    for (size_t offset = 0u; offset < document.size(); offset += jsonChunkSize)
+                    {
+                        size_t chunkSize = std::min(jsonChunkSize, document.size() - offset);
+                        WrapperProbe::CurlSinkDataProc(const_cast<char*>(document.data() + offset), 1u, chunkSize, &probe);
+                    }
+                    DoNotOptimize(sink.TakeValue());
+                },
+                [&]()
+                {
+                    bodyBuffer.clear();
+                    for (size_t offset = 0u; offset < document.size(); offset += jsonChunkSize)
+                    {
+                        size_t chunkSize = std::min(jsonChunkSize, document.size() - offset);
+                        WrapperProbe::CurlWriteDataProc(const_cast<char*>(document.data() + offset), 1u, chunkSize, &bodyBuffer);
+                    }
+                    string receivedData(bodyBuffer.begin(), bodyBuffer.end());
+                    DoNotOptimize(json::parse(receivedData));
+                }
+            );
+
+            const double megabytesPerOp = (double)document.size() / (1024.0 * 1024.0);
+            result["document_bytes"] = document.size();
+            result["wrapper"]["mb_per_sec"] = megabytesPerOp / (result["wrapper"]["ns_per_op"].get<double>() / 1e9);
+            result["raw"]["mb_per_sec"] = megabytesPerOp / (result["raw"]["ns_per_op"].get<double>() / 1e9);
+            report.Add(result);
+        }
+
+        // Append throughput of the write callback compared with a plain memcpy() into a buffer of the same size.
+        const size_t chunkSizes[] = { 16u, 256u, 4096u, 65536u };
+        vector<char> chunk(65536u, 'c');
+        vector<unsigned char> receiveBuffer;
+        vector<unsigned char> copyBuffer((size_t)appendBytes);
+        receiveBuffer.reserve((size_t)appendBytes);
+        for (size_t chunkSize : chunkSizes)
+        {
+            size_t copyOffset = 0u;
+            long long appendIterations = appendBytes / (long long)chunkSize;
+            json result = Compare
+            (
+                "write_callback_append_" + to_string(chunkSize),
+                appendIterations,
+                [&]()
+                {
+                    if (receiveBuffer.size() + chunkSize > (size_t)appendBytes)
+                    {
+                        receiveBuffer.clear();
+                    }
+                    WrapperProbe::CurlWriteDataProc(chunk.data(), 1u, chunkSize, &receiveBuffer);
+                },
+                [&]()
+                {
+                    if (copyOffset + chunkSize > (size_t)appendBytes)
+                    {
+                        copyOffset = 0u;
+                    }
+                    ::memcpy(copyBuffer.data() + copyOffset, chunk.data(), chunkSize);
+                    copyOffset += chunkSize;
+                    DoNotOptimize(copyBuffer);
+                }
+            );
+
+            const double megabytesPerOp = (double)chunkSize / (1024.0 * 1024.0);
+            result["wrapper"]["mb_per_sec"] = megabytesPerOp / (result["wrapper"]["ns_per_op"].get<double>() / 1e9);
+            result["raw"]["mb_per_sec"] = megabytesPerOp / (result["raw"]["ns_per_op"].get<double>() / 1e9);
+            report.Add(result);
+        }
+
+        curl_easy_cleanup(rawHandle);
+        report.Print();
+    }
+    catch (CurlException& ex)
+    {
+        cerr << ex.what() << endl;
+        exitCode = 1;
+    }
+    catch (exception& ex)
+    {
+        cerr << ex.what() << endl;
+        exitCode = 1;
+    }
+
+    curl_global_cleanup();
+    return exitCode;
+}
@@ -0,0 +1,181 @@
+/**
+ * @file
+ * @brief Request path throughput of CurlEasyWrapper and CurlMultiWrapper over the network-free socket pair transport.
+ * @date 2026-10-19 [JFDR] Created.
+ */
+
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <CurlEasyWrapper.hpp>
+#include <CurlMultiWrapper.hpp>
+#include "BenchSupport.hpp"
+#include "SocketPairTransport.hpp"
+
+using std::cerr;
+using std::endl;
+using std::exception;
+using std::string;
+using std::to_string;
+using std::unique_ptr;
+using std::vector;
+using AbcdEFramework::Web::CurlEasyWrapper;
+using AbcdEFramework::Web::CurlException;
+using AbcdEFramework::Web::CurlMultiWrapper;
+using AbcdEFramework::Web::Bench::AllocationCounters;
+using AbcdEFramework::Web::Bench::BenchArgs;
+using AbcdEFramework::Web::Bench::BenchReport;
+using AbcdEFramework::Web::Bench::GetAllocationCounters;
+using AbcdEFramework::Web::Bench::NowNanoseconds;
+using AbcdEFramework::Web::Bench::SocketPairTransport;
+using json = nlohmann::json;
+
+namespace
+{
+    /**
+     * @brief Build the result object for \c requests requests.
+     */
+    json MakeResult(const string& name, long long requests, uint64_t elapsedNs, const AllocationCounters& allocs, uint64_t connections)
+    {
+        json result;
+        result["name"] = name;
+        result["requests"] = requests;
+        result["connections"] = connections;
+        result["requests_per_sec"] = (double)requests / ((double)elapsedNs / 1e9);
+        result["ns_per_request"] = (double)elapsedNs / (double)requests;
+        result["allocations_per_request"] = (double)allocs.allocations / (double)requests;
+        result["bytes_per_request"] = (double)allocs.bytes / (double)requests;
+        return result;
+    }
+
+    /**
+     * @brief Sequential Execute() calls on one handle.
+     */
+    json MeasureExecute(const string& url, long long requests)
+    {
+        SocketPairTransport transport;
+        CurlEasyWrapper curl;
+        transport.Attach(curl);
+        curl.Url(url);
+        curl.Execute();
+        curl.ClearReceiveBuffer();
+
+        AllocationCounters before = GetAllocationCounters();
+        uint64_t start = NowNanoseconds();
+        for (long long requestIndex = 0; requestIndex < requests; ++requestIndex)
+        {
+            curl.Execute();
+            curl.ClearReceiveBuffer();
+        }
+        uint64_t elapsedNs = NowNanoseconds() - start;
+
+        return MakeResult("execute_reused_handle", requests, elapsedNs, GetAllocationCounters() - before, transport.GetConnectionCount());
+    }
+
+    /**
+     * @brief \c handleCount handles that are kept busy by one multi loop until \c requests requests completed.
+     */
+    json MeasureMultiLoop(const string& url, long long requests, long long handleCount)
+    {
+        SocketPairTransport transport;
+        CurlMultiWrapper multi;
+        vector<unique_ptr<CurlEasyWrapper>> handles;
+        for (long long handleIndex = 0; handleIndex < handleCount; ++handleIndex)
+        {
+            handles.emplace_back(new CurlEasyWrapper());
+            transport.Attach(*handles.back());
+            handles.back()->Url(url);
+        }
+
+        AllocationCounters before = GetAllocationCounters();
+        uint64_t start = NowNanoseconds();
+        long long started = 0;
+        long long completed = 0;
+        for (auto& handle : handles)
+        {
+            if (started < requests)
+            {
+                multi.AddHandle(*handle);
+                ++started;
+            }
+        }
+
+        while (completed < requests)
+        {
+            multi.Perform();
+
+            CurlEasyWrapper* easy;
+            CURLcode curlRes;
+            bool anyCompleted = false;
+            while (multi.ReadInfo(easy, curlRes))
+            {
+                if (curlRes != CURLE_OK)
+                {
+                    throw std::runtime_error(string("multi loop transfer failed: ") + curl_easy_strerror(curlRes));
+                }
+
+                multi.RemoveHandle(*easy);
+                easy->ClearReceiveBuffer();
+                ++completed;
+                anyCompleted = true;
+                if (started < requests)
+                {
+                    multi.AddHandle(*easy);
+                    ++started;
+                }
+            }
+
+            if (!anyCompleted)
+            {
+                multi.Poll(100);
+            }
+        }
+        uint64_t elapsedNs = NowNanoseconds() - start;
+
+        return MakeResult
+        (
+            "multi_loop_" + to_string(handleCount),
+            requests,
+            elapsedNs,
+            GetAllocationCounters() - before,
+            transport.GetConnectionCount()
+        );
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    BenchArgs args(argc, argv);
+    const long long requests = args.GetNumber("requests", 20000);
+    const long long bodySize = args.GetNumber("size", 64);
+
+    curl_global_init(CURL_GLOBAL_ALL);
+    int exitCode = 0;
+
+    try
+    {
+        BenchReport report("socketpair");
+        const string url(SocketPairTransport::Url("/bytes?size=" + to_string(bodySize)));
+
+        report.Add(MeasureExecute(url, requests));
+        report.Add(MeasureMultiLoop(url, requests, 1));
+        report.Add(MeasureMultiLoop(url, requests, 16));
+
+        report.Print();
+    }
+    catch (CurlException& ex)
+    {
+        cerr << ex.what() << endl;
+        exitCode = 1;
+    }
+    catch (exception& ex)
+    {
+        cerr << ex.what() << endl;
+        exitCode = 1;
+    }
+
+    curl_global_cleanup();
+    return exitCode;
+}
@@ -0,0 +1,105 @@
+/**
+ * @file
+ * @brief Request throughput of CurlEasyWrapper against the loopback server.
+ * @date 2026-10-19 [JFDR] Created.
+ */
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <CurlEasyWrapper.hpp>
+#include "BenchSupport.hpp"
+#include "LoopbackHttpServer.hpp"
+
+using std::cerr;
+using std::endl;
+using std::exception;
+using std::string;
+using std::to_string;
+using AbcdEFramework::Web::CurlEasyWrapper;
+using AbcdEFramework::Web::CurlException;
+using AbcdEFramework::Web::Bench::BenchArgs;
+using AbcdEFramework::Web::Bench::BenchReport;
+using AbcdEFramework::Web::Bench::LoopbackHttpServer;
+using AbcdEFramework::Web::Bench::NowNanoseconds;
+using json = nlohmann::json;
+
+namespace
+{
+    /**
+     * @brief Build the result object for a run of \c requests requests that took \c elapsedNs nanoseconds.
+     */
+    json MakeResult(const string& name, long long requests, long long bodySize, uint64_t elapsedNs)
+    {
+        json result;
+        result["name"] = name;
+        result["requests"] = requests;
+        result["body_bytes"] = bodySize;
+        result["elapsed_ms"] = (double)elapsedNs / 1e6;
+        result["requests_per_sec"] = (double)requests / ((double)elapsedNs / 1e9);
+        return result;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    BenchArgs args(argc, argv);
+    const long long requests = args.GetNumber("requests", 20000);
+    const long long bodySize = args.GetNumber("size", 64);
+
+    curl_global_init(CURL_GLOBAL_ALL);
+    int exitCode = 0;
+
+    try
+    {
+        LoopbackHttpServer server;
+        server.Start();
+        const string url(server.Url("/bytes?size=" + to_string(bodySize)));
+        BenchReport report("throughput");
+
+        // One handle that is reused for every request, so that the connection is kept alive.
+        {
+            CurlEasyWrapper curl;
+            curl.Url(url);
+            curl.Execute();
+            curl.ClearReceiveBuffer();
+
+            uint64_t start = NowNanoseconds();
+            for (long long requestIndex = 0; requestIndex < requests; ++requestIndex)
+            {
+                curl.Execute();
+                curl.ClearReceiveBuffer();
+            }
+            report.Add(MakeResult("reused_handle", requests, bodySize, NowNanoseconds() - start));
+        }
+
+        // A new handle for every request, which also means a new connection for every request.
+        {
+            long long newHandleRequests = requests / 4;
+            uint64_t start = NowNanoseconds();
+            for (long long requestIndex = 0; requestIndex < newHandleRequests; ++requestIndex)
+            {
+                CurlEasyWrapper curl;
+                curl.Url(url);
+                curl.Execute();
+            }
+            report.Add(MakeResult("new_handle", newHandleRequests, bodySize, NowNanoseconds() - start));
+        }
+
+        server.Stop();
+        report.Print();
+    }
+    catch (CurlException& ex)
+    {
+        cerr << ex.what() << endl;
+        exitCode = 1;
+    }
+    catch (exception& ex)
+    {
+        cerr << ex.what() << endl;
+        exitCode = 1;
+    }
+
+    curl_global_cleanup();
+    return exitCode;
+}
@@ -0,0 +1,498 @@
+/**
+ * @file
+ * @brief Large body download and upload throughput of CurlEasyWrapper against the loopback server.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] Added streaming a newline delimited JSON body through CurlNdjsonSink.
+ * @date 2026-10-19 [JFDR] Check that a moved or cloned wrapper keeps the request method that replaced POST.
+ * @date 2026-10-19 [JFDR] Check that the NDJSON queue stays within its capacity and that Execute() fails on a full queue.
+ * @date 2026-10-19 [JFDR] Check that a prepared request replaces the request method that the handle used last.
+ * @date 2026-10-19 [JFDR] Check that Restore() restores the request method of the snapshot.
+ * @date 2026-10-19 [JFDR] Check that PostFields() sends the whole data again after PostFieldSize().
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <CurlEasyWrapper.hpp>
+#include <CurlMultiWrapper.hpp>
+#include <CurlNdjsonSink.hpp>
+#include <CurlPreparedRequest.hpp>
+#include "BenchSupport.hpp"
+#include "LoopbackHttpServer.hpp"
+
+using std::cerr;
+using std::endl;
+using std::exception;
+using std::string;
+using std::to_string;
+using AbcdEFramework::Web::CurlEasyWrapper;
+using AbcdEFramework::Web::CurlException;
+using AbcdEFramework::Web::CurlMultiWrapper;
+using AbcdEFramework::Web::CurlNdjsonSink;
+using AbcdEFramework::Web::CurlOptionState;
+using AbcdEFramework::Web::CurlPreparedRequest;
+using AbcdEFramework::Web::CurlResult;
+using AbcdEFramework::Web::Bench::BenchArgs;
+using AbcdEFramework::Web::Bench::BenchReport;
+using AbcdEFramework::Web::Bench::LoopbackHttpServer;
+using AbcdEFramework::Web::Bench::NDJSON_RECORD_SIZE;
+using AbcdEFramework::Web::Bench::NowNanoseconds;
+using json = nlohmann::json;
+
+namespace
+{
+    /**
+     * @brief Build the result object from the best and total time of a number of iterations.
+     */
+    json MakeResult(const string& name, long long bytes, long long iterations, uint64_t bestNs, uint64_t totalNs)
+    {
+        const double megabytes = (double)bytes / (1024.0 * 1024.0);
+        json result;
+        result["name"] = name;
+        result["bytes"] = bytes;
+        result["iterations"] = iterations;
+        result["best_mb_per_sec"] = megabytes / ((double)bestNs / 1e9);
+        result["mean_mb_per_sec"] = megabytes / (((double)totalNs / (double)iterations) / 1e9);
+        return result;
+    }
+
+    /**
+     * @brief Download \c bytes bytes from \c url a number of times.
+     */
+    json MeasureDownload(const string& name, const string& url, long long bytes, long long iterations)
+    {
+        CurlEasyWrapper curl;
+        curl.Url(url);
+
+        uint64_t bestNs = UINT64_MAX;
+        uint64_t totalNs = 0u;
+        for (long long iteration = 0; iteration < iterations; ++iteration)
+        {
+            curl.ClearReceiveBuffer();
+            uint64_t start = NowNanoseconds();
+            curl.Execute();
+            uint64_t elapsedNs = NowNanoseconds() - start;
+            if ((long long)curl.GetReceiveBuffer().size() != bytes)
+            {
+                throw std::runtime_error(name + ": unexpected body size " + to_string(curl.GetReceiveBuffer().size()));
+            }
+            bestNs = std::min(bestNs, elapsedNs);
+            totalNs += elapsedNs;
+        }
+
+        return MakeResult(name, bytes, iterations, bestNs, totalNs);
+    }
+
+    /**
+     * @brief POST a body of \c bytes bytes to \c url a number of times.
+     */
+    json MeasureUpload(const string& name, const string& url, long long bytes, long long iterations)
+    {
+        const string body((size_t)bytes, 'u');
+        CurlEasyWrapper curl;
+        curl.Url(url);
+        curl.Upload(false);
+        curl.Post();
+
+        uint64_t bestNs = UINT64_MAX;
+        uint64_t totalNs = 0u;
+        for (long long iteration = 0; iteration < iterations; ++iteration)
+        {
+            uint64_t start = NowNanoseconds();
+            curl.PostFields(body);
+            curl.PostFieldSize(body.size());
+            curl.Execute();
+            uint64_t elapsedNs = NowNanoseconds() - start;
+            bestNs = std::min(bestNs, elapsedNs);
+            totalNs += elapsedNs;
+        }
+
+        return MakeResult(name, bytes, iterations, bestNs, totalNs);
+    }
+
+    /**
+     * @brief Download a newline delimited JSON body into the receive buffer, then split and parse its records.
+     */
+    json MeasureNdjsonBuffered(const string& url, long long bytes, long long iterations)
+    {
+        CurlEasyWrapper curl;
+        curl.Url(url);
+
+        uint64_t bestNs = UINT64_MAX;
+        uint64_t totalNs = 0u;
+        long long records = 0;
+        for (long long iteration = 0; iteration < iterations; ++iteration)
+        {
+            curl.ClearReceiveBuffer();
+            uint64_t start = NowNanoseconds();
+            curl.Execute();
+            const char* pos = reinterpret_cast<const char*>(curl.GetReceiveBuffer().data());
+            const char* end = pos + curl.GetReceiveBuffer().size();
+            records = 0;
+            while (pos < end)
+            {
+                const char* lineFeed = static_cast<const char*>(::memchr(pos, '\n', (size_t)(end - pos)));
+                json record(json::parse(pos, lineFeed));
+                records += record.is_object() ? 1 : 0;
+                pos = lineFeed + 1;
+            }
+            uint64_t elapsedNs = NowNanoseconds() - start;
+            bestNs = std::min(bestNs, elapsedNs);
+            totalNs += elapsedNs;
+        }
+
+        json result(MakeResult("ndjson_buffered", bytes, iterations, bestNs, totalNs));
+        result["records"] = records;
+        result["peak_buffered_bytes"] = curl.GetReceiveBuffer().size();
+        return result;
+    }
+
+    /**
+     * @brief Stream a newline delimited JSON body through a \c CurlNdjsonSink that passes the records to a function.
+     */
+    json MeasureNdjsonConsumer(const string& url, long long bytes, long long iterations)
+    {
+        long long records = 0;
+        CurlNdjsonSink<json> sink
+        (
+            [&records](json& record)
+            {
+                records += record.is_object() ? 1 : 0;
+                return true;
+            }
+        );
+        CurlEasyWrapper curl;
+        curl.Url(url);
+        curl.ReceiveSink(&sink);
+
+        uint64_t bestNs = UINT64_MAX;
+        uint64_t totalNs = 0u;
+        for (long long iteration = 0; iteration < iterations; ++iteration)
+        {
+            sink.Reset();
+            records = 0;
+            uint64_t start = NowNanoseconds();
+            curl.Execute();
+            sink.Finish();
+            uint64_t elapsedNs = NowNanoseconds() - start;
+            bestNs = std::min(bestNs, elapsedNs);
+            totalNs += elapsedNs;
+        }
+
+        json result(MakeResult("ndjson_consumer", bytes, iterations, bestNs, totalNs));
+        result["records"] = records;
+        return result;
+    }
+
+    /**
+     * @brief Stream a newline delimited JSON body into a bounded queue, driven by \c CurlMultiWrapper. The loop takes
+     *      at most \c recordsPerTurn records per turn, so that the queue fills up and the transfer is paused.
+     */
+    json MeasureNdjsonQueue(const string& url, long long bytes, long long iterations, size_t capacity, size_t recordsPerTurn)
+    {
+        CurlNdjsonSink<json> sink(capacity);
+        CurlEasyWrapper curl;
+        curl.Url(url);
+        curl.ReceiveSink(&sink);
+        CurlMultiWrapper multi;
+
+        uint64_t bestNs = UINT64_MAX;
+        uint64_t totalNs = 0u;
+        long long records = 0;
+        long long resumes = 0;
+        size_t peakQueued = 0u;
+        for (long long iteration = 0; iteration < iterations; ++iteration)
+        {
+            sink.Reset();
+            records = 0;
+            uint64_t start = NowNanoseconds();
+            multi.AddHandle(curl);
+            bool running = true;
+            while (running || (sink.Size() != 0u))
+            {
+                peakQueued = std::max(peakQueued, sink.Size());
+                json record;
+                for (size_t taken = 0u; (taken < recordsPerTurn) && sink.TryPop(record); ++taken)
+                {
+                    records += record.is_object() ? 1 : 0;
+                }
+                if (curl.ResumeReceive())
+                {
+                    ++resumes;
+                }
+
+                running = (multi.Perform() != 0);
+                peakQueued = std::max(peakQueued, sink.Size());
+                CurlEasyWrapper* easy;
+                CURLcode curlRes;
+                while (multi.ReadInfo(easy, curlRes))
+                {
+                    if (curlRes != CURLE_OK)
+                    {
+                        throw std::runtime_error(string("ndjson transfer failed: ") + curl_easy_strerror(curlRes));
+                    }
+                }
+                if (running && (sink.Size() == 0u))
+                {
+                    multi.Poll(100);
+                }
+            }
+            multi.RemoveHandle(curl);
+            sink.Finish();
+            uint64_t elapsedNs = NowNanoseconds() - start;
+            bestNs = std::min(bestNs, elapsedNs);
+            totalNs += elapsedNs;
+        }
+
+        json result(MakeResult("ndjson_queue_" + to_string(capacity), bytes, iterations, bestNs, totalNs));
+        result["records"] = records;
+        result["resumes_per_transfer"] = (double)resumes / (double)iterations;
+        result["capacity"] = capacity;
+        result["peak_queued_records"] = peakQueued;
+        return result;
+    }
+
+    /**
+     * @brief Make a request and count it as a failure if it was not made with the expected method.
+     */
+    int CheckMethod(const char* name, CurlEasyWrapper& curl, const char* expected)
+    {
+        curl.Execute();
+        const char* method = nullptr;
+        curl_easy_getinfo(curl.GetHandle(), CURLINFO_EFFECTIVE_METHOD, &method);
+        if ((nullptr == method) || (::strcmp(method, expected) != 0))
+        {
+            cerr << "request_method: " << name << " made a " << ((method != nullptr) ? method : "?") << " request instead of " << expected << endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Check that a request whose method was changed after the POST data was set keeps that method when the
+     *      wrapper is moved, move assigned and cloned.
+     * @return Number of requests that were made with another method.
+     */
+    int CheckMethodAfterMove(const string& url)
+    {
+        int failures = 0;
+        const char* const expectedMethods[2] = { "GET", "HEAD" };
+        for (const char* expected : expectedMethods)
+        {
+            CurlEasyWrapper curl;
+            curl.Url(url);
+            curl.PostFields("key=value");
+            if (::strcmp(expected, "GET") == 0)
+            {
+                curl.Post(false);
+            }
+            else
+            {
+                curl.NoBody();
+            }
+
+            CurlEasyWrapper moved(std::move(curl));
+            failures += CheckMethod("move constructed", moved, expected);
+            CurlEasyWrapper assigned;
+            assigned = std::move(moved);
+            failures += CheckMethod("move assigned", assigned, expected);
+            CurlEasyWrapper cloned(assigned.Clone());
+            failures += CheckMethod("cloned", cloned, expected);
+        }
+
+        return failures;
+    }
+
+    /**
+     * @brief Check that a prepared request sends a GET or a POST request whatever method the handle used last.
+     * @return Number of requests that were made with another method.
+     */
+    int CheckPreparedMethod(const string& url)
+    {
+        int failures = 0;
+        const CurlPreparedRequest prepared(CurlPreparedRequest::Builder().UrlPrefix(url).Build());
+        for (int previous = 0; previous < 3; ++previous)
+        {
+            CurlEasyWrapper curl;
+            curl.Url(url);
+            switch (previous)
+            {
+                case 0:
+                    curl.NoBody();
+                    break;
+                case 1:
+                    // Without a size, cURL would read the body from stdin.
+                    curl.Post();
+                    curl.PostFieldSize(0u);
+                    break;
+                default:
+                    curl.PostFields("key=value");
+                    curl.NoBody();
+                    break;
+            }
+            curl.Execute();
+
+            prepared.Apply(curl, "&a");
+            failures += CheckMethod("prepared GET", curl, "GET");
+            curl.NoBody();
+            prepared.Apply(curl, "&b", "key=value");
+            failures += CheckMethod("prepared POST", curl, "POST");
+        }
+
+        return failures;
+    }
+
+    /**
+     * @brief Check that restoring a snapshot switches one handle between GET, HEAD and POST requests.
+     * @return Number of requests that were made with another method.
+     */
+    int CheckSnapshotMethod(const string& url)
+    {
+        int failures = 0;
+        CurlEasyWrapper curl;
+        curl.Url(url);
+        const CurlOptionState getState(curl.Snapshot());
+        curl.NoBody();
+        const CurlOptionState headState(curl.Snapshot());
+        curl.PostFields("key=value");
+        const CurlOptionState postState(curl.Snapshot());
+        curl.NoBody();
+        const CurlOptionState postHeadState(curl.Snapshot());
+
+        curl.Restore(getState);
+        failures += CheckMethod("restored GET", curl, "GET");
+        curl.Restore(postHeadState);
+        failures += CheckMethod("restored HEAD after POST data", curl, "HEAD");
+        curl.Restore(postState);
+        failures += CheckMethod("restored POST", curl, "POST");
+        curl.Restore(headState);
+        failures += CheckMethod("restored HEAD", curl, "HEAD");
+        curl.Restore(postState);
+        failures += CheckMethod("restored POST after HEAD", curl, "POST");
+        curl.Restore(getState);
+        failures += CheckMethod("restored GET after POST", curl, "GET");
+
+        return failures;
+    }
+
+    /**
+     * @brief Check that \c PostFields() sends all of its data after \c PostFieldSize() set a smaller size.
+     * @return 1 if the second request did not send the whole data.
+     */
+    int CheckPostFieldSize(const string& url)
+    {
+        const string data("abcdef");
+        CurlEasyWrapper curl;
+        curl.Url(url);
+        curl.PostFields(data);
+        curl.PostFieldSize(3u);
+        curl.Execute();
+        curl.PostFields(data);
+        curl.Execute();
+
+        curl_off_t sent = 0;
+        curl_easy_getinfo(curl.GetHandle(), CURLINFO_SIZE_UPLOAD_T, &sent);
+        if (sent != (curl_off_t)data.size())
+        {
+            cerr << "post_field_size: sent " << sent << " bytes instead of " << data.size() << endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Check that \c Execute() fails instead of pausing when a queue with a capacity is full, since nothing
+     *      could resume the transfer.
+     * @return 1 if the transfer did not fail with \c CURLE_WRITE_ERROR or the queue went past its capacity.
+     */
+    int CheckNdjsonExecute(const string& url, size_t capacity)
+    {
+        CurlNdjsonSink<json> sink(capacity);
+        CurlEasyWrapper curl;
+        curl.Url(url);
+        curl.ReceiveSink(&sink);
+        CurlResult result(curl.TryExecute());
+        if ((result.GetErrorCode() != CURLE_WRITE_ERROR) || (sink.Size() > capacity))
+        {
+            cerr << "ndjson_execute: " << curl_easy_strerror(result.GetErrorCode()) << " with " << sink.Size() << " queued records, capacity " << capacity << endl;
+            return 1;
+        }
+        return 0;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    BenchArgs args(argc, argv);
+    const long long bytes = args.GetNumber("megabytes", 64) * 1024 * 1024;
+    const long long iterations = args.GetNumber("iterations", 5);
+
+    curl_global_init(CURL_GLOBAL_ALL);
+    int exitCode = 0;
+
+    try
+    {
+        LoopbackHttpServer server;
+        server.Start();
+        BenchReport report("transfer");
+
+        const string emptyUrl(server.Url("/empty?size=0"));
+        if ((CheckMethodAfterMove(emptyUrl) != 0) || (CheckPreparedMethod(emptyUrl) != 0) || (CheckSnapshotMethod(emptyUrl) != 0)
+            || (CheckPostFieldSize(emptyUrl) != 0))
+        {
+            exitCode = 1;
+        }
+
+        const string sizeQuery("/bytes?size=" + to_string(bytes));
+        report.Add(MeasureDownload("download_content_length", server.Url(sizeQuery), bytes, iterations));
+        report.Add(MeasureDownload("download_chunked_16k", server.Url(sizeQuery + "&chunk=16384"), bytes, iterations));
+        report.Add(MeasureUpload("upload_post_fields", server.Url("/upload"), bytes, iterations));
+
+        // A newline delimited JSON body of whole records, buffered and parsed afterwards, and streamed.
+        const long long ndjsonRecords = bytes / (long long)NDJSON_RECORD_SIZE;
+        const long long ndjsonBytes = ndjsonRecords * (long long)NDJSON_RECORD_SIZE;
+        const string ndjsonUrl(server.Url("/records?ndjson=1&size=" + to_string(ndjsonBytes)));
+        json ndjsonResults[3] =
+        {
+            MeasureNdjsonBuffered(ndjsonUrl, ndjsonBytes, iterations),
+            MeasureNdjsonConsumer(ndjsonUrl, ndjsonBytes, iterations),
+            MeasureNdjsonQueue(ndjsonUrl, ndjsonBytes, iterations, 4096u, 1024u)
+        };
+        for (json& result : ndjsonResults)
+        {
+            if (result["records"].get<long long>() != ndjsonRecords)
+            {
+                cerr << result["name"].get<string>() << ": " << result["records"] << " records instead of " << ndjsonRecords << endl;
+                exitCode = 1;
+            }
+            if ((result.count("capacity") != 0u) && (result["peak_queued_records"].get<size_t>() > result["capacity"].get<size_t>()))
+            {
+                cerr << result["name"].get<string>() << ": " << result["peak_queued_records"] << " queued records, more than the capacity" << endl;
+                exitCode = 1;
+            }
+            report.Add(result);
+        }
+        if (CheckNdjsonExecute(ndjsonUrl, 64u) != 0)
+        {
+            exitCode = 1;
+        }
+
+        server.Stop();
+        report.Print();
+    }
+    catch (CurlException& ex)
+    {
+        cerr << ex.what() << endl;
+        exitCode = 1;
+    }
+    catch (exception& ex)
+    {
+        cerr << ex.what() << endl;
+        exitCode = 1;
+    }
+
+    curl_global_cleanup();
+    return exitCode;
+}
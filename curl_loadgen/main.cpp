@@ -0,0 +1,418 @@
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <json.hpp>
+#include <CurlEasyWrapper.hpp>
+#include <CurlMultiWrapper.hpp>
+
+using std::cout;
+using std::cerr;
+using std::endl;
+using std::exception;
+using std::map;
+using std::string;
+using std::unique_ptr;
+using std::unordered_map;
+using std::vector;
+using AbcdEFramework::Web::CurlEasyWrapper;
+using AbcdEFramework::Web::CurlException;
+using AbcdEFramework::Web::CurlMultiWrapper;
+using json = nlohmann::json;
+
+namespace
+{
+    /**
+     * @brief Command line options.
+     */
+    struct LoadOptions
+    {
+        string url; ///< Target URL.
+        long connections; ///< Maximum number of transfers in flight.
+        double durationSeconds; ///< Length of the run.
+        double rate; ///< Requests per second, or zero to run at fixed concurrency.
+        long timeoutMs; ///< Per-request timeout.
+        bool jsonOutput; ///< Print the report as JSON instead of text.
+    };
+
+    /**
+     * @brief A transfer slot: one easy handle and the bookkeeping of the request it is running.
+     */
+    struct Slot
+    {
+        unique_ptr<CurlEasyWrapper> curl; ///< The handle that performs the request.
+        uint64_t intendedStartNs; ///< Time at which the request should have been sent according to the schedule.
+        uint64_t actualStartNs; ///< Time at which the request was handed to the multi stack.
+    };
+
+    /**
+     * @brief Latency samples with nearest-rank percentiles.
+     */
+    class LatencySamples
+    {
+        private:
+            vector<uint64_t> _samples; ///< Samples in nanoseconds.
+
+        public:
+            void Record(uint64_t nanoseconds)
+            {
+                _samples.push_back(nanoseconds);
+            }
+
+            void Sort()
+            {
+                std::sort(_samples.begin(), _samples.end());
+            }
+
+            size_t Count() const
+            {
+                return _samples.size();
+            }
+
+            /**
+             * @brief Get a percentile in milliseconds. The samples must have been sorted.
+             */
+            double PercentileMs(double percentile) const
+            {
+                if (_samples.empty())
+                {
+                    return 0.0;
+                }
+                double rank = std::ceil((percentile / 100.0) * (double)_samples.size());
+                size_t index = (rank < 1.0) ? 0u : std::min((size_t)rank - 1u, _samples.size() - 1u);
+                return (double)_samples[index] / 1e6;
+            }
+    };
+
+    /**
+     * @brief Everything that was measured during a run.
+     */
+    struct LoadResults
+    {
+        LatencySamples corrected; ///< Latency measured from the intended start time.
+        LatencySamples uncorrected; ///< Latency measured from the actual start time.
+        map<int, uint64_t> curlErrors; ///< Number of failed transfers by CURLcode.
+        map<long, uint64_t> statusCodes; ///< Number of completed transfers by HTTP status code.
+        uint64_t completed; ///< Number of transfers that completed, successfully or not.
+        uint64_t bytesReceived; ///< Number of body bytes received.
+        uint64_t elapsedNs; ///< Wall clock time of the run.
+    };
+
+    const double PERCENTILES[] = { 50.0, 75.0, 90.0, 99.0, 99.9, 99.99, 100.0 };
+
+    uint64_t NowNanoseconds()
+    {
+        return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>
+        (
+            std::chrono::steady_clock::now().time_since_epoch()
+        ).count();
+    }
+
+    /**
+     * @brief Drive the target URL according to the options.
+     * @remark In fixed rate mode every request has an intended start time on a fixed schedule. When all
+     *      connections are busy the request is sent late, but its latency is still measured from the intended
+     *      start time so that stalls of the server are not hidden (coordinated omission).
+     */
+    LoadResults RunLoad(const LoadOptions& options)
+    {
+        CurlMultiWrapper multi;
+        vector<Slot> slots((size_t)options.connections);
+        vector<size_t> freeSlots;
+        unordered_map<CurlEasyWrapper*, size_t> slotByHandle;
+        for (size_t slotIndex = 0u; slotIndex < slots.size(); ++slotIndex)
+        {
+            slots[slotIndex].curl.reset(new CurlEasyWrapper());
+            slots[slotIndex].curl->Url(options.url);
+            slots[slotIndex].curl->TimeoutMSeconds(options.timeoutMs);
+            slotByHandle[slots[slotIndex].curl.get()] = slotIndex;
+            freeSlots.push_back(slotIndex);
+        }
+
+        LoadResults results;
+        results.completed = 0u;
+        results.bytesReceived = 0u;
+
+        const bool fixedRate = (options.rate > 0.0);
+        const uint64_t intervalNs = fixedRate ? (uint64_t)(1e9 / options.rate) : 0u;
+        const uint64_t startNs = NowNanoseconds();
+        const uint64_t endNs = startNs + (uint64_t)(options.durationSeconds * 1e9);
+        uint64_t nextIntendedNs = startNs;
+        size_t inFlight = 0u;
+
+        for (;;)
+        {
+            uint64_t nowNs = NowNanoseconds();
+            bool launching = fixedRate ? (nextIntendedNs < endNs) : (nowNs < endNs);
+
+            // Start the requests that are due, as far as there are free connections.
+            while (launching && !freeSlots.empty() && (!fixedRate || (nextIntendedNs <= nowNs)))
+            {
+                Slot& slot = slots[freeSlots.back()];
+                freeSlots.pop_back();
+                slot.intendedStartNs = fixedRate ? nextIntendedNs : nowNs;
+                slot.actualStartNs = nowNs;
+                multi.AddHandle(*slot.curl);
+                ++inFlight;
+                if (fixedRate)
+                {
+                    nextIntendedNs += intervalNs;
+                    launching = (nextIntendedNs < endNs);
+                }
+            }
+
+            multi.Perform();
+
+            size_t completedNow = 0u;
+            CurlEasyWrapper* easy;
+            CURLcode curlRes;
+            while (multi.ReadInfo(easy, curlRes))
+            {
+                uint64_t doneNs = NowNanoseconds();
+                size_t slotIndex = slotByHandle[easy];
+                Slot& slot = slots[slotIndex];
+                multi.RemoveHandle(*slot.curl);
+
+                results.corrected.Record(doneNs - slot.intendedStartNs);
+                results.uncorrected.Record(doneNs - slot.actualStartNs);
+                ++results.completed;
+                if (curlRes == CURLE_OK)
+                {
+                    ++results.statusCodes[slot.curl->GetResponseCode()];
+                    results.bytesReceived += slot.curl->GetReceiveBuffer().size();
+                }
+                else
+                {
+                    ++results.curlErrors[(int)curlRes];
+                }
+                slot.curl->ClearReceiveBuffer();
+
+                freeSlots.push_back(slotIndex);
+                --inFlight;
+                ++completedNow;
+            }
+
+            if (!launching && (inFlight == 0u))
+            {
+                break;
+            }
+
+            if (completedNow != 0u)
+            {
+                continue;
+            }
+
+            int timeoutMs = 100;
+            if (fixedRate && launching && !freeSlots.empty())
+            {
+                nowNs = NowNanoseconds();
+                // Rounded up: a wait shorter than a millisecond would truncate to zero and spin until it is due.
+                timeoutMs = (nextIntendedNs <= nowNs) ? 0 : (int)std::min<uint64_t>((nextIntendedNs - nowNs + 999999u) / 1000000u, 100u);
+            }
+            else if (!fixedRate && launching && !freeSlots.empty())
+            {
+                timeoutMs = 0;
+            }
+            multi.Poll(timeoutMs);
+        }
+
+        results.elapsedNs = NowNanoseconds() - startNs;
+        results.corrected.Sort();
+        results.uncorrected.Sort();
+        return results;
+    }
+
+    json LatencyToJson(const LatencySamples& samples)
+    {
+        json result;
+        for (double percentile : PERCENTILES)
+        {
+            std::ostringstream key;
+            key << "p" << percentile << "_ms";
+            result[key.str()] = samples.PercentileMs(percentile);
+        }
+        return result;
+    }
+
+    void PrintJson(const LoadOptions& options, const LoadResults& results)
+    {
+        json report;
+        report["url"] = options.url;
+        report["connections"] = options.connections;
+        report["rate"] = options.rate;
+        report["duration_s"] = options.durationSeconds;
+        report["requests"] = results.completed;
+        report["requests_per_sec"] = (double)results.completed / ((double)results.elapsedNs / 1e9);
+        report["bytes_received"] = results.bytesReceived;
+        report["latency_corrected"] = LatencyToJson(results.corrected);
+        report["latency_uncorrected"] = LatencyToJson(results.uncorrected);
+
+        json statusCodes = json::object();
+        for (const auto& entry : results.statusCodes)
+        {
+            statusCodes[std::to_string(entry.first)] = entry.second;
+        }
+        report["status_codes"] = statusCodes;
+
+        json curlErrors = json::object();
+        for (const auto& entry : results.curlErrors)
+        {
+            curlErrors[std::to_string(entry.first)] =
+            {
+                { "message", curl_easy_strerror((CURLcode)entry.first) },
+                { "count", entry.second }
+            };
+        }
+        report["curl_errors"] = curlErrors;
+
+        cout << report.dump(2) << endl;
+    }
+
+    void PrintText(const LoadOptions& options, const LoadResults& results)
+    {
+        const double elapsedSeconds = (double)results.elapsedNs / 1e9;
+        cout << "Running " << options.durationSeconds << "s test @ " << options.url << endl;
+        cout << "  " << options.connections << " connections, ";
+        if (options.rate > 0.0)
+        {
+            cout << "fixed rate of " << options.rate << " requests/sec" << endl;
+        }
+        else
+        {
+            cout << "fixed concurrency" << endl;
+        }
+
+        cout << "  Latency distribution (ms)     corrected   uncorrected" << endl;
+        cout << std::fixed << std::setprecision(3);
+        for (double percentile : PERCENTILES)
+        {
+            std::ostringstream label;
+            label << percentile << "%";
+            cout << "  " << std::setw(28) << std::left << label.str() << std::right
+                 << std::setw(10) << results.corrected.PercentileMs(percentile)
+                 << std::setw(14) << results.uncorrected.PercentileMs(percentile) << endl;
+        }
+
+        cout << "  " << results.completed << " requests in " << elapsedSeconds << "s, "
+             << (double)results.bytesReceived / (1024.0 * 1024.0) << " MB read" << endl;
+        cout << "Requests/sec: " << (double)results.completed / elapsedSeconds << endl;
+        cout << "Transfer/sec: " << ((double)results.bytesReceived / (1024.0 * 1024.0)) / elapsedSeconds << " MB" << endl;
+
+        for (const auto& entry : results.statusCodes)
+        {
+            cout << "  HTTP " << entry.first << ": " << entry.second << endl;
+        }
+        for (const auto& entry : results.curlErrors)
+        {
+            cout << "  CURLcode " << entry.first << " (" << curl_easy_strerror((CURLcode)entry.first) << "): "
+                 << entry.second << endl;
+        }
+    }
+}
+
+int main (int argc, char* argv[])
+{
+    LoadOptions options;
+    options.connections = 16;
+    options.durationSeconds = 10.0;
+    options.rate = 0.0;
+    options.timeoutMs = 5000;
+    options.jsonOutput = false;
+
+    bool showHelp = false;
+    for (int argIndex = 1; argIndex < argc; ++argIndex)
+    {
+        bool hasValue = (argIndex + 1 < argc);
+        if ((strcmp(argv[argIndex], "--help") == 0) || (strcmp(argv[argIndex], "-h") == 0))
+        {
+            showHelp = true;
+        }
+        else if ((strcmp(argv[argIndex], "--connections") == 0) && hasValue)
+        {
+            options.connections = std::max(1l, strtol(argv[++argIndex], nullptr, 10));
+        }
+        else if ((strcmp(argv[argIndex], "--duration") == 0) && hasValue)
+        {
+            options.durationSeconds = strtod(argv[++argIndex], nullptr);
+        }
+        else if ((strcmp(argv[argIndex], "--rate") == 0) && hasValue)
+        {
+            options.rate = strtod(argv[++argIndex], nullptr);
+        }
+        else if ((strcmp(argv[argIndex], "--timeout-ms") == 0) && hasValue)
+        {
+            options.timeoutMs = strtol(argv[++argIndex], nullptr, 10);
+        }
+        else if (strcmp(argv[argIndex], "--json") == 0)
+        {
+            options.jsonOutput = true;
+        }
+        else if ((argv[argIndex][0] != '-') && options.url.empty())
+        {
+            options.url = argv[argIndex];
+        }
+        else
+        {
+            showHelp = true;
+        }
+    }
+
+    if (showHelp || options.url.empty())
+    {
+        cout << endl << "USAGE: " << argv[0] << " <url> [--connections N] [--duration SECONDS] [--rate REQUESTS_PER_SECOND] [--timeout-ms MS] [--json]" << endl;
+        cout << "WHERE url         URL of the server to load." << endl;
+        cout << "      connections Maximum number of requests in flight (default 16)." << endl;
+        cout << "      duration    Length of the run in seconds (default 10)." << endl;
+        cout << "      rate        Send requests on a fixed schedule. Without it every connection sends its next" << endl;
+        cout << "                  request as soon as the previous one completes." << endl;
+        cout << "      timeout-ms  Timeout of a single request (default 5000)." << endl;
+        cout << "      json        Print the report as JSON." << endl << endl;
+        return 0;
+    }
+
+    int exitCode = 0;
+    curl_global_init(CURL_GLOBAL_ALL);
+
+    try
+    {
+        LoadResults results = RunLoad(options);
+        if (options.jsonOutput)
+        {
+            PrintJson(options, results);
+        }
+        else
+        {
+            PrintText(options, results);
+        }
+    }
+    catch (CurlException& ex)
+    {
+        cerr << ex.what() << endl;
+        exitCode = 1;
+    }
+    catch (exception& ex)
+    {
+        cerr << ex.what() << endl;
+        exitCode = 1;
+    }
+    catch (...)
+    {
+        cerr << "An unknown exception was caught" << endl;
+        exitCode = 1;
+    }
+
+    curl_global_cleanup();
+    return exitCode;
+}
@@ -3,8 +3,8 @@
 #include <stdio.h>
 #include <string>
 #include <iostream>
-#include <json.hpp>
 #include <CurlEasyWrapper.hpp>
+#include <CurlJsonExtractor.hpp>
 
 using std::cout;
 using std::cerr;
@@ -13,7 +13,7 @@ using std::exception;
 using std::string;
 using AbcdEFramework::Web::CurlException;
 using AbcdEFramework::Web::CurlEasyWrapper;
-using json = nlohmann::json;
+using AbcdEFramework::Web::CurlJsonExtractor;
 
 int main (int argc, char* argv[])
 {
@@ -47,16 +47,18 @@ int main (int argc, char* argv[])
         curl.Upload(false);
         curl.Url(argv[1]);
         curl.Execute();
-        string receivedData(curl.GetReceiveBuffer().begin(), curl.GetReceiveBuffer().end());
 
-        json js = json::parse(receivedData);
-        if (js["errorMessage"].is_null())
+        // Only two fields are needed, so they are picked out of the receive buffer instead of parsing the body.
+        CurlJsonExtractor extractor({ "/inputValue", "/errorMessage" });
+        extractor.Extract(curl.GetReceiveBuffer());
+        if (extractor[1].IsNull())
         {
-            cout << "Previous value was [" << js["inputValue"] << "]" << endl;
+            // A missing member prints as null, as json.hpp printed it.
+            cout << "Previous value was [" << (extractor[0].IsFound() ? extractor[0].GetRaw().ToString() : string("null")) << "]" << endl;
         }
         else
         {
-            cout << "Server reported an error: "  << js["errorMessage"] << endl;
+            cout << "Server reported an error: "  << extractor[1].GetRaw().ToString() << endl;
         }
     }
     catch (CurlException& ex)
@@ -3,7 +3,6 @@
 #include <stdexcept>
 #include <stdio.h>
 #include <string>
-#include <sstream>
 #include <iostream>
 #include <json.hpp>
 #include <CurlEasyWrapper.hpp>
@@ -13,11 +12,10 @@ using std::cerr;
 using std::endl;
 using std::exception;
 using std::string;
-using std::stringstream;
-using std::unique_ptr;
+using std::shared_ptr;
 using AbcdEFramework::Web::CurlException;
 using AbcdEFramework::Web::CurlEasyWrapper;
-using AbcdEFramework::Web::CurlSList;
+using AbcdEFramework::Web::CurlHeaderList;
 using json = nlohmann::json;
 
 int main (int argc, char* argv[])
@@ -57,9 +55,9 @@ int main (int argc, char* argv[])
 
         CurlEasyWrapper curl;
 
-        unique_ptr<CurlSList> sListPtr
+        shared_ptr<const CurlHeaderList> headers
         (
-            new CurlSList
+            CurlHeaderList::Intern
             (
                 {
                     "Accept: application/json",
@@ -74,17 +72,12 @@ int main (int argc, char* argv[])
             { "UploadValue", argv[2] }
         };
 
-        stringstream ss;
-        ss << "UploadValue=" << uploadValue;
-        string jsonString(ss.str());
-
         curl.Url(argv[1]);
         curl.TimeoutSeconds(30);
         curl.Upload(false);
         curl.Post();
-        curl.PostFields(jsonString);
-        curl.PostFieldSize(jsonString.size());
-        curl.HttpHeader(sListPtr);
+        curl.PostJson(uploadValue, "UploadValue=");
+        curl.HttpHeader(headers);
         curl.Execute();
     }
     catch (CurlException& ex)
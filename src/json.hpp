@@ -57,6 +57,11 @@ SOFTWARE.
 #include <utility> // declval, forward, make_pair, move, pair, swap
 #include <vector> // vector
 
+// shortest round-trip printing and Eisel-Lemire parsing of numbers, see CurlJsonNumbers.hpp
+#if defined(AEF_JSON_FAST_NUMBERS)
+    #include <CurlJsonNumbers.hpp> // CurlJsonNumbers
+#endif
+
 // exclude unsupported compilers
 #if defined(__clang__)
     #if (__clang_major__ * 10000 + __clang_minor__ * 100 + __clang_patchlevel__) < 30400
@@ -8272,6 +8277,13 @@ class basic_json
         template<typename NumberType>
         void x_write(NumberType x, /*is_integral=*/std::true_type)
         {
+#if defined(AEF_JSON_FAST_NUMBERS)
+            if (AbcdEFramework::Web::CurlJsonNumbers::TryFormat(x, m_buf.data()))
+            {
+                return;
+            }
+#endif
+
             // special case for "0"
             if (x == 0)
             {
@@ -8306,6 +8318,14 @@ class basic_json
         template<typename NumberType>
         void x_write(NumberType x, /*is_integral=*/std::false_type)
         {
+#if defined(AEF_JSON_FAST_NUMBERS)
+            // shortest digits that read back as the same value
+            if (AbcdEFramework::Web::CurlJsonNumbers::TryFormat(x, m_buf.data()))
+            {
+                return;
+            }
+#endif
+
             // special case for 0.0 and -0.0
             if (x == 0)
             {
@@ -11142,6 +11162,14 @@ basic_json_parser_74:
             template<typename T>
             bool parse(T& value, /*is_integral=*/std::false_type) const
             {
+#if defined(AEF_JSON_FAST_NUMBERS)
+                // falls back to strtod when the rounding cannot be decided
+                if (AbcdEFramework::Web::CurlJsonNumbers::TryParse(m_start, m_end, value))
+                {
+                    return true;
+                }
+#endif
+
                 // replace decimal separator with locale-specific version,
                 // when necessary; data will point to either the original
                 // string, or buf, or tempstr containing the fixed string.
@@ -11219,6 +11247,13 @@ basic_json_parser_74:
             template<typename T>
             bool parse(T& value, /*is_integral=*/std::true_type) const
             {
+#if defined(AEF_JSON_FAST_NUMBERS)
+                if (AbcdEFramework::Web::CurlJsonNumbers::TryParse(m_start, m_end, value))
+                {
+                    return true;
+                }
+#endif
+
                 char* endptr = nullptr;
                 errno = 0; // these are thread-local
                 const auto x = parse_integral(&endptr, std::is_signed<T>());
@@ -0,0 +1,110 @@
+/**
+ * @file
+ * @brief Definition of the CurlArena methods.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] Reset() keeps the largest block, which is not the newest one after a large allocation.
+ */
+
+#include <algorithm>
+#include "CurlArena.hpp"
+#include "CurlGlobal.hpp"
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        thread_local CurlArena* CurlArena::_current = nullptr;
+
+        CurlArena::Scope::Scope(CurlArena& arena)
+            :   _previous(CurlArena::_current)
+        {
+            CurlArena::_current = &arena;
+        }
+
+        CurlArena::Scope::~Scope()
+        {
+            CurlArena::_current = this->_previous;
+        }
+
+        CurlArena::CurlArena(size_t initialBlockSize)
+            :   _block(nullptr),
+                _next(nullptr),
+                _end(nullptr),
+                _nextBlockSize(std::max(initialBlockSize, (size_t)1024u)),
+                _bytesReserved(0u)
+        {
+        }
+
+        CurlArena::~CurlArena()
+        {
+            while (this->_block != nullptr)
+            {
+                Block* previous = this->_block->previous;
+                ::operator delete(this->_block);
+                this->_block = previous;
+            }
+        }
+
+        void CurlArena::Reset()
+        {
+            if (nullptr == this->_block)
+            {
+                return;
+            }
+
+            // Keep the largest block and free the others. That is usually the newest one, but not if a single
+            // allocation was larger than the next block size; the block made for it comes before smaller ones.
+            Block* keep = this->_block;
+            for (Block* block = keep->previous; block != nullptr; block = block->previous)
+            {
+                if (block->sizeBytes > keep->sizeBytes)
+                {
+                    keep = block;
+                }
+            }
+
+            Block* block = this->_block;
+            while (block != nullptr)
+            {
+                Block* previous = block->previous;
+                if (block != keep)
+                {
+                    ::operator delete(block);
+                }
+                block = previous;
+            }
+
+            keep->previous = nullptr;
+            this->_block = keep;
+            this->_bytesReserved = keep->sizeBytes;
+            this->_end = reinterpret_cast<char*>(keep) + keep->sizeBytes;
+            this->_next = reinterpret_cast<char*>(keep + 1);
+        }
+
+        void* CurlArena::AllocateFromNewBlock(size_t sizeBytes, size_t alignment)
+        {
+            // A block always has room for the allocation, however large it is.
+            size_t minimumSize = sizeof(Block) + sizeBytes + alignment;
+            if (minimumSize < sizeBytes)
+            {
+                throw std::bad_alloc();
+            }
+            size_t blockSize = std::max(this->_nextBlockSize, minimumSize);
+
+            Block* block = static_cast<Block*>(::operator new(blockSize));
+            CurlGlobal::RecordAllocation(CURL_ALLOC_ARENA, blockSize);
+            block->previous = this->_block;
+            block->sizeBytes = blockSize;
+            this->_block = block;
+            this->_next = reinterpret_cast<char*>(block + 1);
+            this->_end = reinterpret_cast<char*>(block) + blockSize;
+            this->_bytesReserved += blockSize;
+            if (this->_nextBlockSize < MaxBlockSize)
+            {
+                this->_nextBlockSize *= 2u;
+            }
+
+            return Allocate(sizeBytes, alignment);
+        }
+    } // namespace Web
+} // namespace AbcdEFramework
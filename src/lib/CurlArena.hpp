@@ -0,0 +1,265 @@
+/**
+ * @file
+ * @brief Declaration of the CurlArena class and the CurlArenaAllocator class template.
+ * @date 2026-10-19 [JFDR] Created.
+ */
+#if !defined CURL_ARENA_E4B90C17A3F2486D9B5E0A21C6D73F48
+#define CURL_ARENA_E4B90C17A3F2486D9B5E0A21C6D73F48 1
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        /**
+         * @brief Monotonic memory arena for the data of one request, e.g. a parsed JSON response.
+         * @remark Memory is handed out from large blocks by bumping a pointer and is never freed one allocation at
+         *      a time; \c Reset() and the destructor release all of it at once. Containers reach the arena through
+         *      \c CurlArenaAllocator, which allocates from the arena that a \c Scope made current on the calling
+         *      thread. The arena is not thread safe; use one arena per request or per thread.
+         */
+        class CurlArena
+        {
+            public:
+                /**
+                 * @brief Makes an arena the current arena of the thread for its lifetime.
+                 * @remark Scopes nest; the destructor makes the previous arena current again.
+                 */
+                class Scope
+                {
+                    private:
+                        CurlArena* _previous; ///< The arena that was current before.
+
+                    public:
+                        /**
+                         * @brief Make \c arena the current arena of the thread.
+                         */
+                        explicit Scope(CurlArena& arena);
+
+                        /**
+                         * @brief Make the previous arena current again.
+                         */
+                        ~Scope();
+
+                        Scope(const Scope&) = delete;
+                        Scope& operator=(const Scope&) = delete;
+                };
+
+            private:
+                /**
+                 * @brief Header in front of every block. The memory handed out follows it.
+                 */
+                struct Block
+                {
+                    Block* previous; ///< The block that was allocated before this one.
+                    size_t sizeBytes; ///< Size of the block, including the header.
+                };
+
+                static const size_t MaxBlockSize = 16u * 1024u * 1024u; ///< Blocks stop doubling at this size.
+
+            private:
+                Block* _block; ///< The newest block, or \c nullptr.
+                char* _next; ///< Next free byte in the newest block.
+                char* _end; ///< End of the newest block.
+                size_t _nextBlockSize; ///< Size of the next block that is allocated.
+                size_t _bytesReserved; ///< Total size of the blocks.
+
+                static thread_local CurlArena* _current; ///< The current arena of the thread.
+
+            public:
+                /**
+                 * @brief Constructor. No memory is allocated until the first allocation.
+                 * @param initialBlockSize Size of the first block; each following block is twice as large.
+                 */
+                explicit CurlArena(size_t initialBlockSize = 64u * 1024u);
+
+                /**
+                 * @brief Destructor. Releases all memory without running destructors.
+                 */
+                ~CurlArena();
+
+                CurlArena(const CurlArena&) = delete;
+                CurlArena& operator=(const CurlArena&) = delete;
+
+            public:
+                /**
+                 * @brief Allocate \c sizeBytes bytes aligned to \c alignment, which must be a power of two.
+                 */
+                inline void* Allocate(size_t sizeBytes, size_t alignment);
+
+                /**
+                 * @brief Construct an object in the arena.
+                 * @remark The destructor of the object is never called; the memory goes when the arena is reset or
+                 *      destroyed. Use it only for objects whose own memory comes from the same arena, such as an
+                 *      \c arena_json value, so that releasing a parsed response does not walk the tree.
+                 */
+                template <typename T, typename... Args>
+                inline T* New(Args&&... args);
+
+                /**
+                 * @brief Release everything that was allocated.
+                 * @remark The largest block is kept, so an arena that is reused for similar requests stops
+                 *      allocating after the first one. Objects in the arena must not be used afterwards.
+                 */
+                void Reset();
+
+                /**
+                 * @brief Get the total size of the blocks that the arena holds.
+                 */
+                inline size_t GetBytesReserved() const;
+
+                /**
+                 * @brief Get the current arena of the calling thread, or \c nullptr if no \c Scope is active.
+                 */
+                static inline CurlArena* Current();
+
+            private:
+                /**
+                 * @brief Allocate a new block that has room for the allocation and allocate from it.
+                 */
+                void* AllocateFromNewBlock(size_t sizeBytes, size_t alignment);
+        };
+
+        /**
+         * @brief Standard allocator that allocates from the current \c CurlArena of the thread.
+         * @remark It is stateless, as the containers of \c json.hpp require. \c deallocate() does nothing; the
+         *      memory is released with the arena. Allocating without a current arena throws
+         *      \c std::bad_alloc.
+         */
+        template <typename T>
+        class CurlArenaAllocator
+        {
+            public:
+                typedef T value_type;
+
+                template <typename U>
+                struct rebind
+                {
+                    typedef CurlArenaAllocator<U> other;
+                };
+
+            public:
+                /**
+                 * @brief Constructor.
+                 */
+                inline CurlArenaAllocator() noexcept;
+
+                /**
+                 * @brief Converting constructor, used by containers to allocate their nodes.
+                 */
+                template <typename U>
+                inline CurlArenaAllocator(const CurlArenaAllocator<U>&) noexcept;
+
+            public:
+                /**
+                 * @brief Allocate room for \c count objects from the current arena.
+                 */
+                inline T* allocate(size_t count);
+
+                /**
+                 * @brief Does nothing; the memory is released with the arena.
+                 */
+                inline void deallocate(T* pointer, size_t count) noexcept;
+
+                /**
+                 * @brief Construct an object in allocated memory. \c json.hpp calls it directly.
+                 */
+                template <typename U, typename... Args>
+                inline void construct(U* pointer, Args&&... args);
+
+                /**
+                 * @brief Destroy an object without releasing its memory. \c json.hpp calls it directly.
+                 */
+                template <typename U>
+                inline void destroy(U* pointer);
+        };
+
+        template <typename T, typename U>
+        inline bool operator==(const CurlArenaAllocator<T>&, const CurlArenaAllocator<U>&) noexcept
+        {
+            return true;
+        }
+
+        template <typename T, typename U>
+        inline bool operator!=(const CurlArenaAllocator<T>&, const CurlArenaAllocator<U>&) noexcept
+        {
+            return false;
+        }
+
+        inline void* CurlArena::Allocate(size_t sizeBytes, size_t alignment)
+        {
+            uintptr_t start = ((uintptr_t)this->_next + (alignment - 1u)) & ~(uintptr_t)(alignment - 1u);
+            if ((start >= (uintptr_t)this->_next) && (sizeBytes <= (uintptr_t)this->_end - start))
+            {
+                this->_next = reinterpret_cast<char*>(start + sizeBytes);
+                return reinterpret_cast<void*>(start);
+            }
+
+            return AllocateFromNewBlock(sizeBytes, alignment);
+        }
+
+        template <typename T, typename... Args>
+        inline T* CurlArena::New(Args&&... args)
+        {
+            return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        }
+
+        inline size_t CurlArena::GetBytesReserved() const
+        {
+            return this->_bytesReserved;
+        }
+
+        inline CurlArena* CurlArena::Current()
+        {
+            return _current;
+        }
+
+        template <typename T>
+        inline CurlArenaAllocator<T>::CurlArenaAllocator() noexcept
+        {
+        }
+
+        template <typename T>
+        template <typename U>
+        inline CurlArenaAllocator<T>::CurlArenaAllocator(const CurlArenaAllocator<U>&) noexcept
+        {
+        }
+
+        template <typename T>
+        inline T* CurlArenaAllocator<T>::allocate(size_t count)
+        {
+            CurlArena* arena = CurlArena::Current();
+            if ((nullptr == arena) || (count > SIZE_MAX / sizeof(T)))
+            {
+                throw std::bad_alloc();
+            }
+
+            return static_cast<T*>(arena->Allocate(count * sizeof(T), alignof(T)));
+        }
+
+        template <typename T>
+        inline void CurlArenaAllocator<T>::deallocate(T*, size_t) noexcept
+        {
+        }
+
+        template <typename T>
+        template <typename U, typename... Args>
+        inline void CurlArenaAllocator<T>::construct(U* pointer, Args&&... args)
+        {
+            ::new ((void*)pointer) U(std::forward<Args>(args)...);
+        }
+
+        template <typename T>
+        template <typename U>
+        inline void CurlArenaAllocator<T>::destroy(U* pointer)
+        {
+            pointer->~U();
+        }
+    } // namespace Web
+} // namespace AbcdEFramework
+
+#endif // CURL_ARENA_E4B90C17A3F2486D9B5E0A21C6D73F48
@@ -0,0 +1,58 @@
+/**
+ * @file
+ * @brief Declaration of the arena_json type: a nlohmann::basic_json whose memory comes from a CurlArena.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] The example reuses the sink across CurlArena::Reset().
+ */
+#if !defined CURL_ARENA_JSON_71C5A9E3D04B4F28B6E1F9A2D3C85B0E
+#define CURL_ARENA_JSON_71C5A9E3D04B4F28B6E1F9A2D3C85B0E 1
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+#include <json.hpp>
+#include "CurlArena.hpp"
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        /**
+         * @brief String type of \c arena_json.
+         */
+        typedef std::basic_string<char, std::char_traits<char>, CurlArenaAllocator<char>> arena_string;
+
+        /**
+         * @brief JSON value whose strings, objects and arrays are all allocated from the current \c CurlArena.
+         * @remark Parse or build it while a \c CurlArena::Scope is active, and keep the root in the arena with
+         *      \c CurlArena::New() so that no destructor runs: the whole document is then released by
+         *      \c CurlArena::Reset() or the destructor of the arena, in one step per block instead of one per value.
+         *      A sink keeps its buffers on the heap, so one sink can parse one response after the other while the
+         *      arena is reset in between. Reset the sink first: a value that was only partly parsed lives in the arena.
+         *      <pre>
+         *      CurlArena arena;
+         *      CurlJsonSink<arena_json> sink;
+         *      curl.ReceiveSink(&sink);
+         *      for (const std::string& url : urls)
+         *      {
+         *          CurlArena::Scope scope(arena);
+         *          curl.Url(url);
+         *          curl.TryExecute();
+         *          arena_json& js(*arena.New<arena_json>(sink.TakeValue()));
+         *          ...
+         *          sink.Reset();
+         *          arena.Reset();
+         *      }
+         *      </pre>
+         *      The \c parse() and \c dump() functions of \c json.hpp 2.1.1 only compile for \c std::string; parse
+         *      with \c CurlJsonSink or \c CurlJsonPushParser and serialise with \c operator<<. Strings are
+         *      \c arena_string; read them with \c get_ref<const arena_string&>(). A value that is not kept in the
+         *      arena must be destroyed before the arena is reset.
+         */
+        typedef nlohmann::basic_json<std::map, std::vector, arena_string, bool, std::int64_t, std::uint64_t, double,
+            CurlArenaAllocator> arena_json;
+    } // namespace Web
+} // namespace AbcdEFramework
+
+#endif // CURL_ARENA_JSON_71C5A9E3D04B4F28B6E1F9A2D3C85B0E
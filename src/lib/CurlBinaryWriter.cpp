@@ -0,0 +1,179 @@
+/**
+ * @file
+ * @brief Definition of the CurlBinaryWriter methods.
+ * @date 2026-10-19 [JFDR] Created.
+ */
+
+#include <cstring>
+#include <stdexcept>
+#include "CurlBinaryWriter.hpp"
+
+namespace
+{
+    /**
+     * @brief Append a code byte followed by the lowest \c sizeBytes bytes of \c value, most significant first.
+     */
+    inline void AppendBigEndian(std::string& data, unsigned char code, uint64_t value, size_t sizeBytes)
+    {
+        char bytes[9];
+        bytes[0] = (char)code;
+        for (size_t index = sizeBytes; index > 0u; --index)
+        {
+            bytes[index] = (char)(value & 0xFFu);
+            value >>= 8;
+        }
+        data.append(bytes, sizeBytes + 1u);
+    }
+
+    /**
+     * @brief Get the bits of a double.
+     */
+    inline uint64_t DoubleBits(double value)
+    {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+}
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        void CurlBinaryWriter::AppendCborHead(std::string& data, unsigned majorType, uint64_t value)
+        {
+            // Values up to 23 are stored in the head byte; larger ones follow it in 1, 2, 4 or 8 bytes.
+            const unsigned char major = (unsigned char)(majorType << 5);
+            if (value <= 23u)
+            {
+                data += (char)(major | value);
+            }
+            else if (value <= 0xFFu)
+            {
+                AppendBigEndian(data, major | 24u, value, 1u);
+            }
+            else if (value <= 0xFFFFu)
+            {
+                AppendBigEndian(data, major | 25u, value, 2u);
+            }
+            else if (value <= 0xFFFFFFFFu)
+            {
+                AppendBigEndian(data, major | 26u, value, 4u);
+            }
+            else
+            {
+                AppendBigEndian(data, major | 27u, value, 8u);
+            }
+        }
+
+        void CurlBinaryWriter::AppendCborDouble(std::string& data, double value)
+        {
+            AppendBigEndian(data, 0xFBu, DoubleBits(value), 8u);
+        }
+
+        void CurlBinaryWriter::AppendMsgPackInteger(std::string& data, int64_t value)
+        {
+            if (value >= 0)
+            {
+                AppendMsgPackUnsigned(data, (uint64_t)value);
+            }
+            else if (value >= -32)
+            {
+                // Negative fixint
+                data += (char)(unsigned char)value;
+            }
+            else if (value >= INT8_MIN)
+            {
+                AppendBigEndian(data, 0xD0u, (uint64_t)value, 1u);
+            }
+            else if (value >= INT16_MIN)
+            {
+                AppendBigEndian(data, 0xD1u, (uint64_t)value, 2u);
+            }
+            else if (value >= INT32_MIN)
+            {
+                AppendBigEndian(data, 0xD2u, (uint64_t)value, 4u);
+            }
+            else
+            {
+                AppendBigEndian(data, 0xD3u, (uint64_t)value, 8u);
+            }
+        }
+
+        void CurlBinaryWriter::AppendMsgPackUnsigned(std::string& data, uint64_t value)
+        {
+            if (value < 128u)
+            {
+                // Positive fixint
+                data += (char)value;
+            }
+            else if (value <= 0xFFu)
+            {
+                AppendBigEndian(data, 0xCCu, value, 1u);
+            }
+            else if (value <= 0xFFFFu)
+            {
+                AppendBigEndian(data, 0xCDu, value, 2u);
+            }
+            else if (value <= 0xFFFFFFFFu)
+            {
+                AppendBigEndian(data, 0xCEu, value, 4u);
+            }
+            else
+            {
+                AppendBigEndian(data, 0xCFu, value, 8u);
+            }
+        }
+
+        void CurlBinaryWriter::AppendMsgPackDouble(std::string& data, double value)
+        {
+            AppendBigEndian(data, 0xCBu, DoubleBits(value), 8u);
+        }
+
+        void CurlBinaryWriter::AppendMsgPackString(std::string& data, const char* text, size_t sizeBytes)
+        {
+            if (sizeBytes <= 31u)
+            {
+                // Fixstr
+                data += (char)(0xA0u | sizeBytes);
+            }
+            else if (sizeBytes <= 0xFFu)
+            {
+                AppendBigEndian(data, 0xD9u, sizeBytes, 1u);
+            }
+            else if (sizeBytes <= 0xFFFFu)
+            {
+                AppendBigEndian(data, 0xDAu, sizeBytes, 2u);
+            }
+            else if (sizeBytes <= 0xFFFFFFFFu)
+            {
+                AppendBigEndian(data, 0xDBu, sizeBytes, 4u);
+            }
+            else
+            {
+                throw std::length_error("string too long for MessagePack");
+            }
+            data.append(text, sizeBytes);
+        }
+
+        void CurlBinaryWriter::AppendMsgPackContainerHead(std::string& data, unsigned char fixCode, unsigned char code16, size_t size)
+        {
+            if (size <= 15u)
+            {
+                data += (char)(fixCode | size);
+            }
+            else if (size <= 0xFFFFu)
+            {
+                AppendBigEndian(data, code16, size, 2u);
+            }
+            else if (size <= 0xFFFFFFFFu)
+            {
+                AppendBigEndian(data, code16 + 1u, size, 4u);
+            }
+            else
+            {
+                throw std::length_error("array or object too large for MessagePack");
+            }
+        }
+    } // namespace Web
+} // namespace AbcdEFramework
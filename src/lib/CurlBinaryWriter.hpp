@@ -0,0 +1,199 @@
+/**
+ * @file
+ * @brief Declaration of the CurlBinaryWriter class.
+ * @date 2026-10-19 [JFDR] Created.
+ */
+#if !defined CURL_BINARY_WRITER_7A2E94C1D05B4F3C9E68B1A4F0D3C275
+#define CURL_BINARY_WRITER_7A2E94C1D05B4F3C9E68B1A4F0D3C275 1
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        /**
+         * @brief Encodes a JSON value as CBOR or MessagePack by appending the bytes to a string.
+         * @remark The bytes are the same as those of \c to_cbor() and \c to_msgpack() of \c json.hpp, but they are
+         *      written straight into the string instead of a new vector that is filled a byte at a time, so a
+         *      string that is reused does not allocate for a body of a size that was seen before.
+         *
+         *      \c JsonType is a \c nlohmann::basic_json type; include \c json.hpp before calling the methods.
+         */
+        class CurlBinaryWriter
+        {
+            public:
+                /**
+                 * @brief Append the CBOR encoding (RFC 7049) of a value.
+                 */
+                template <typename JsonType>
+                static inline void AppendCbor(std::string& data, const JsonType& value);
+
+                /**
+                 * @brief Append the MessagePack encoding of a value.
+                 * @remark Throws \c std::length_error for a string, array or object with 4G or more elements, which
+                 *      MessagePack cannot encode.
+                 */
+                template <typename JsonType>
+                static inline void AppendMsgPack(std::string& data, const JsonType& value);
+
+            private:
+                /**
+                 * @brief Append the head of a CBOR item: the major type and a number in the fewest bytes.
+                 */
+                static void AppendCborHead(std::string& data, unsigned majorType, uint64_t value);
+
+                /**
+                 * @brief Append a double as a CBOR item.
+                 */
+                static void AppendCborDouble(std::string& data, double value);
+
+                /**
+                 * @brief Append a signed integer as a MessagePack item in the fewest bytes.
+                 */
+                static void AppendMsgPackInteger(std::string& data, int64_t value);
+
+                /**
+                 * @brief Append an unsigned integer as a MessagePack item in the fewest bytes.
+                 */
+                static void AppendMsgPackUnsigned(std::string& data, uint64_t value);
+
+                /**
+                 * @brief Append a double as a MessagePack item.
+                 */
+                static void AppendMsgPackDouble(std::string& data, double value);
+
+                /**
+                 * @brief Append a string as a MessagePack item.
+                 */
+                static void AppendMsgPackString(std::string& data, const char* text, size_t sizeBytes);
+
+                /**
+                 * @brief Append the head of a MessagePack array or map.
+                 * @param fixCode The code of the fixed size form, which holds up to 15 elements.
+                 * @param code16 The code of the form with a 16 bit size; the one with a 32 bit size follows it.
+                 */
+                static void AppendMsgPackContainerHead(std::string& data, unsigned char fixCode, unsigned char code16, size_t size);
+        };
+
+        template <typename JsonType>
+        inline void CurlBinaryWriter::AppendCbor(std::string& data, const JsonType& value)
+        {
+            typedef typename JsonType::value_t ValueType;
+            switch (value.type())
+            {
+                case ValueType::object:
+                    AppendCborHead(data, 5u, value.size());
+                    for (typename JsonType::const_iterator member = value.cbegin(); member != value.cend(); ++member)
+                    {
+                        AppendCborHead(data, 3u, member.key().size());
+                        data.append(member.key().data(), member.key().size());
+                        AppendCbor(data, member.value());
+                    }
+                    break;
+
+                case ValueType::array:
+                    AppendCborHead(data, 4u, value.size());
+                    for (typename JsonType::const_iterator element = value.cbegin(); element != value.cend(); ++element)
+                    {
+                        AppendCbor(data, *element);
+                    }
+                    break;
+
+                case ValueType::string:
+                {
+                    const typename JsonType::string_t& stringValue(*value.template get_ptr<const typename JsonType::string_t*>());
+                    AppendCborHead(data, 3u, stringValue.size());
+                    data.append(stringValue.data(), stringValue.size());
+                    break;
+                }
+
+                case ValueType::boolean:
+                    data += *value.template get_ptr<const typename JsonType::boolean_t*>() ? '\xF5' : '\xF4';
+                    break;
+
+                case ValueType::number_integer:
+                {
+                    // Negative numbers are major type 1 and store -1 - n.
+                    const int64_t number = (int64_t)*value.template get_ptr<const typename JsonType::number_integer_t*>();
+                    AppendCborHead(data, (number < 0) ? 1u : 0u, (number < 0) ? (uint64_t)(-1 - number) : (uint64_t)number);
+                    break;
+                }
+
+                case ValueType::number_unsigned:
+                    AppendCborHead(data, 0u, (uint64_t)*value.template get_ptr<const typename JsonType::number_unsigned_t*>());
+                    break;
+
+                case ValueType::number_float:
+                    AppendCborDouble(data, (double)*value.template get_ptr<const typename JsonType::number_float_t*>());
+                    break;
+
+                case ValueType::null:
+                    data += '\xF6';
+                    break;
+
+                case ValueType::discarded:
+                    break;
+            }
+        }
+
+        template <typename JsonType>
+        inline void CurlBinaryWriter::AppendMsgPack(std::string& data, const JsonType& value)
+        {
+            typedef typename JsonType::value_t ValueType;
+            switch (value.type())
+            {
+                case ValueType::object:
+                    AppendMsgPackContainerHead(data, 0x80u, 0xDEu, value.size());
+                    for (typename JsonType::const_iterator member = value.cbegin(); member != value.cend(); ++member)
+                    {
+                        AppendMsgPackString(data, member.key().data(), member.key().size());
+                        AppendMsgPack(data, member.value());
+                    }
+                    break;
+
+                case ValueType::array:
+                    AppendMsgPackContainerHead(data, 0x90u, 0xDCu, value.size());
+                    for (typename JsonType::const_iterator element = value.cbegin(); element != value.cend(); ++element)
+                    {
+                        AppendMsgPack(data, *element);
+                    }
+                    break;
+
+                case ValueType::string:
+                {
+                    const typename JsonType::string_t& stringValue(*value.template get_ptr<const typename JsonType::string_t*>());
+                    AppendMsgPackString(data, stringValue.data(), stringValue.size());
+                    break;
+                }
+
+                case ValueType::boolean:
+                    data += *value.template get_ptr<const typename JsonType::boolean_t*>() ? '\xC3' : '\xC2';
+                    break;
+
+                case ValueType::number_integer:
+                    AppendMsgPackInteger(data, (int64_t)*value.template get_ptr<const typename JsonType::number_integer_t*>());
+                    break;
+
+                case ValueType::number_unsigned:
+                    AppendMsgPackUnsigned(data, (uint64_t)*value.template get_ptr<const typename JsonType::number_unsigned_t*>());
+                    break;
+
+                case ValueType::number_float:
+                    AppendMsgPackDouble(data, (double)*value.template get_ptr<const typename JsonType::number_float_t*>());
+                    break;
+
+                case ValueType::null:
+                    data += '\xC0';
+                    break;
+
+                case ValueType::discarded:
+                    break;
+            }
+        }
+    } // namespace Web
+} // namespace AbcdEFramework
+
+#endif // CURL_BINARY_WRITER_7A2E94C1D05B4F3C9E68B1A4F0D3C275
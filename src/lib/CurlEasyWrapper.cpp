@@ -3,11 +3,35 @@
  * @brief Definition of the CurlEasyWrapper methods.
  * @date 2017-01-07 [JFDR] Created.
  * @date 2017-01-09 [JFDR] Must set the CURLOPT_NOSIGNAL option otherwise the program aborts with "longjmp causes uninitialized stack frame".
+ * @date 2026-10-19 [JFDR] CurlSList kept the head pointer it started with instead of the one returned by curl_slist_append().
+ * @date 2026-10-19 [JFDR] Count the growth of the receive buffer, the POST data and the CurlSList nodes.
+ * @date 2026-10-19 [JFDR] Options are set through Set<>(). HttpHeader() passed the list to the bool overload of SetOpt().
+ * @date 2026-10-19 [JFDR] Execute() is built on TryExecute(). The error buffer was reserved but had a size of zero.
+ * @date 2026-10-19 [JFDR] Exceptions with an error code are thrown without building a message string.
+ * @date 2026-10-19 [JFDR] Skip options whose value did not change. Added Snapshot() and Restore().
+ * @date 2026-10-19 [JFDR] Reset() re-applies the constructor options through ApplyBaseline(). Added ResetToBaseline().
+ * @date 2026-10-19 [JFDR] Added the move operations and Clone().
+ * @date 2026-10-19 [JFDR] Added ApplyOptions() and UrlWithQuery() for CurlPreparedRequest.
+ * @date 2026-10-19 [JFDR] Added the CurlHeaderList overload of HttpHeader().
+ * @date 2026-10-19 [JFDR] The response headers are collected by CurlResponseHeaders.
+ * @date 2026-10-19 [JFDR] Added ReceiveSink().
+ * @date 2026-10-19 [JFDR] Added CommitPostData() for PostJson().
+ * @date 2026-10-19 [JFDR] The size of the POST data is set with the data, so that binary bodies may hold NUL bytes.
+ * @date 2026-10-19 [JFDR] The sink callback receives the wrapper, so that a full sink can pause the transfer.
+ * @date 2026-10-19 [JFDR] The options that the wrapper tracks are set with SetTracked<>().
+ * @date 2026-10-19 [JFDR] RepointHandleData() sets the request method options again after CURLOPT_POSTFIELDS.
+ * @date 2026-10-19 [JFDR] Added ApplyLongOptions(), which resets the options of the previous prepared request.
+ * @date 2026-10-19 [JFDR] Added ContentType(), Accept(), RemoveBodyFormatContentType() and CheckResponseFormat().
+ * @date 2026-10-19 [JFDR] A full sink fails the transfer with CURLE_WRITE_ERROR if the handle is not attached to a multi stack.
+ * @date 2026-10-19 [JFDR] ApplyOptions() switches back to GET after a request method option was set.
+ * @date 2026-10-19 [JFDR] ApplyOptions() sets the request method options of the state, so that Restore() restores the method.
+ * @date 2026-10-19 [JFDR] PostFields() no longer skips data that is unchanged when PostFieldSize() set another size.
  */
 
 #include <iostream>
 #include <algorithm>
 #include <stdexcept>
+#include <stdio.h>
 #include <string.h>
 #include "CurlEasyWrapper.hpp"
 
@@ -19,6 +43,39 @@
     #error "C++ compiler signature not recognised."
 #endif
 
+namespace
+{
+    using AbcdEFramework::Web::CurlBodyFormat;
+    using AbcdEFramework::Web::CurlHeaderList;
+    using AbcdEFramework::Web::CurlStringView;
+
+    /**
+     * @brief Get the body format whose media type a \c Content-Type value names, ignoring parameters such as
+     *      \c "; charset=utf-8".
+     * @return \c false if it names none of them, or the view is null.
+     */
+    bool TryGetBodyFormat(const CurlStringView& contentType, CurlBodyFormat& format)
+    {
+        const char* typeEnd = std::find(contentType.begin(), contentType.end(), ';');
+        while ((typeEnd != contentType.begin()) && (' ' == typeEnd[-1]))
+        {
+            --typeEnd;
+        }
+        const CurlStringView mediaType(contentType.Data(), (size_t)(typeEnd - contentType.begin()));
+
+        const CurlBodyFormat formats[] = { AbcdEFramework::Web::CURL_BODY_JSON, AbcdEFramework::Web::CURL_BODY_CBOR, AbcdEFramework::Web::CURL_BODY_MSGPACK };
+        for (CurlBodyFormat candidate : formats)
+        {
+            if (mediaType.EqualsIgnoreCase(CurlHeaderList::GetMediaType(candidate)))
+            {
+                format = candidate;
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
 namespace AbcdEFramework
 {
     namespace Web
@@ -29,8 +86,30 @@ namespace AbcdEFramework
         using std::string;
         using std::vector;
 
+        /**
+         * @brief User agent that the wrapper sets, because some servers don't like requests without one.
+         */
+        const char* const CurlEasyWrapper::DefaultUserAgent = "libcurl-agent/1.0";
+
+        CurlOptionState::CurlOptionState()
+            :   timeoutMilliseconds(0l),
+                failOnErrors(false),
+                verbose(false),
+                hasPostData(false),
+                postDataSize(-1)
+        {
+        }
+
+        CurlMethodChanges::CurlMethodChanges()
+            :   count(0u)
+        {
+        }
+
         CurlEasyWrapper::CurlEasyWrapper()
-            :   _curlHandle(curl_easy_init())
+            :   _curlHandle(curl_easy_init()),
+                _receiveSink(nullptr),
+                _receivePaused(false),
+                _attachedToMulti(false)
         {
             if (nullptr == _curlHandle)
             {
@@ -38,65 +117,291 @@ namespace AbcdEFramework
             }
 
             // Set the size of the error message buffer.
-            this->_errorMsgBuffer.reserve((size_t)CURL_ERROR_SIZE);
+            this->_errorMsgBuffer.resize((size_t)CURL_ERROR_SIZE);
 
-            // Return code from calls to cURL
-            CURLcode curlRes;
+            ApplyBaseline();
+        }
 
+        void CurlEasyWrapper::ApplyBaseline()
+        {
             ClearErrorMessageBuffer();
-            if (CURLE_OK != (curlRes = curl_easy_setopt(this->_curlHandle, CURLOPT_NOSIGNAL, 1)))
-            {
-                throw CurlException(string(AEF_METHOD_NAME) + "curl_easy_setopt(CURLOPT_NOSIGNAL)", curlRes, "");
-            }
+            Set<CURLOPT_NOSIGNAL>(1l);
 
             // Point the error buffer to our local buffer so that we can get error messages.
-            ClearErrorMessageBuffer();
-            if (CURLE_OK != (curlRes = curl_easy_setopt(this->_curlHandle, CURLOPT_ERRORBUFFER, this->_errorMsgBuffer.data())))
+            SetTracked<CURLOPT_ERRORBUFFER>(this->_errorMsgBuffer.data());
+
+            // Some servers don't like requests that are made without a user-agent, so we provide one.
+            SetTracked<CURLOPT_USERAGENT>(DefaultUserAgent);
+            this->_options.userAgent = DefaultUserAgent;
+
+            // Change the default behaviour so that data will be written to our receive buffer.
+            this->_receiveSink = nullptr;
+            this->_receivePaused = false;
+            SetTracked<CURLOPT_WRITEFUNCTION>(CurlEasyWrapper::CurlWriteDataProc);
+            SetTracked<CURLOPT_WRITEDATA>((void*)&(this->_receiveBuffer));
+
+            // Collect the response headers; they are only parsed when they are read.
+            SetTracked<CURLOPT_HEADERFUNCTION>(CurlResponseHeaders::CurlHeaderDataProc);
+            SetTracked<CURLOPT_HEADERDATA>((void*)&(this->_responseHeaders));
+
+            // Remember the owner of the handle so that it can be found again from the multi interface.
+            SetTracked<CURLOPT_PRIVATE>((void*)this);
+
+            this->_options.methodChanges.count = 0u;
+        }
+
+        CurlEasyWrapper::CurlEasyWrapper(CURL* curlHandle, const CurlOptionState& options)
+            :   _curlHandle(curlHandle),
+                _errorMsgBuffer((size_t)CURL_ERROR_SIZE, '\0'),
+                _receiveSink(nullptr),
+                _receivePaused(false),
+                _attachedToMulti(false),
+                _options(options)
+        {
+            RepointHandleData();
+        }
+
+        CurlEasyWrapper::CurlEasyWrapper(CurlEasyWrapper&& src) noexcept
+            :   _curlHandle(src._curlHandle),
+                _errorMsgBuffer(std::move(src._errorMsgBuffer)),
+                _receiveBuffer(std::move(src._receiveBuffer)),
+                _responseHeaders(std::move(src._responseHeaders)),
+                _receiveSink(src._receiveSink),
+                _receivePaused(src._receivePaused),
+                _attachedToMulti(src._attachedToMulti),
+                _options(std::move(src._options))
+        {
+            src._curlHandle = nullptr;
+            RepointHandleData();
+        }
+
+        CurlEasyWrapper::~CurlEasyWrapper()
+        {
+            if (_curlHandle != nullptr)
             {
-                throw CurlException(string(AEF_METHOD_NAME) + "curl_easy_setopt(CURLOPT_ERRORBUFFER)", curlRes, "");
+                curl_easy_cleanup(this->_curlHandle);
+                this->_curlHandle = nullptr;
             }
+        }
 
-            // Some servers don't like requests that are made without a user-agent, so we provide one.
-            ClearErrorMessageBuffer();
-            if (CURLE_OK != (curlRes = curl_easy_setopt(this->_curlHandle, CURLOPT_USERAGENT, "libcurl-agent/1.0")))
+        CurlEasyWrapper& CurlEasyWrapper::operator=(CurlEasyWrapper&& src) noexcept
+        {
+            if (this != &src)
             {
-                throw CurlException(string(AEF_METHOD_NAME) + "curl_easy_setopt(CURLOPT_USERAGENT)", curlRes, RetrieveErrorMessage(curlRes));
+                // Clean up the handle first; it may refer to the header list and the POST data.
+                if (this->_curlHandle != nullptr)
+                {
+                    curl_easy_cleanup(this->_curlHandle);
+                }
+
+                this->_curlHandle = src._curlHandle;
+                src._curlHandle = nullptr;
+                this->_errorMsgBuffer = std::move(src._errorMsgBuffer);
+                this->_receiveBuffer = std::move(src._receiveBuffer);
+                this->_responseHeaders = std::move(src._responseHeaders);
+                this->_receiveSink = src._receiveSink;
+                this->_receivePaused = src._receivePaused;
+                this->_attachedToMulti = src._attachedToMulti;
+                this->_options = std::move(src._options);
+                RepointHandleData();
             }
 
-            // Change the default behaviour so that data will be written to our receive buffer.
-            ClearErrorMessageBuffer();
-            if (CURLE_OK != (curlRes = curl_easy_setopt(this->_curlHandle, CURLOPT_WRITEFUNCTION, CurlEasyWrapper::CurlWriteDataProc)))
+            return *this;
+        }
+
+        CurlEasyWrapper CurlEasyWrapper::Clone() const
+        {
+            CURL* duplicateHandle = curl_easy_duphandle(this->_curlHandle);
+            if (nullptr == duplicateHandle)
             {
-                throw CurlException(string(AEF_METHOD_NAME) + "curl_easy_setopt(CURLOPT_WRITEFUNCTION)", curlRes, RetrieveErrorMessage(curlRes));
+                throw runtime_error(AEF_METHOD_NAME);
             }
 
-            ClearErrorMessageBuffer();
-            if (CURLE_OK != (curlRes = curl_easy_setopt(this->_curlHandle, CURLOPT_WRITEDATA, (void*)&(this->_receiveBuffer))))
+            try
             {
-                throw CurlException(string(AEF_METHOD_NAME) + "curl_easy_setopt(CURLOPT_WRITEDATA)", curlRes, RetrieveErrorMessage(curlRes));
+                return CurlEasyWrapper(duplicateHandle, this->_options);
+            }
+            catch (...)
+            {
+                curl_easy_cleanup(duplicateHandle);
+                throw;
             }
         }
 
-        CurlEasyWrapper::~CurlEasyWrapper()
+        void CurlEasyWrapper::RepointHandleData() noexcept
         {
-            if (_curlHandle != nullptr)
+            if (nullptr == this->_curlHandle)
             {
-                curl_easy_cleanup(this->_curlHandle);
-                this->_curlHandle = nullptr;
+                return;
+            }
+
+            curl_easy_setopt(this->_curlHandle, CURLOPT_ERRORBUFFER, this->_errorMsgBuffer.data());
+            if (this->_receiveSink != nullptr)
+            {
+                curl_easy_setopt(this->_curlHandle, CURLOPT_WRITEFUNCTION, CurlEasyWrapper::CurlSinkDataProc);
+                curl_easy_setopt(this->_curlHandle, CURLOPT_WRITEDATA, (void*)this);
+            }
+            else
+            {
+                // A duplicated handle still calls the sink of the original, so the function is set as well.
+                curl_easy_setopt(this->_curlHandle, CURLOPT_WRITEFUNCTION, CurlEasyWrapper::CurlWriteDataProc);
+                curl_easy_setopt(this->_curlHandle, CURLOPT_WRITEDATA, (void*)&(this->_receiveBuffer));
+            }
+            curl_easy_setopt(this->_curlHandle, CURLOPT_HEADERDATA, (void*)&(this->_responseHeaders));
+            curl_easy_setopt(this->_curlHandle, CURLOPT_PRIVATE, (void*)this);
+
+            // A short string keeps its characters inside the object, so the POST data may have moved as well.
+            // Setting it selects POST again, so the method options that were set after it are set again too.
+            if (this->_options.hasPostData)
+            {
+                curl_easy_setopt(this->_curlHandle, CURLOPT_POSTFIELDS, this->_options.postData.c_str());
+                for (size_t index = 0u; index < this->_options.methodChanges.count; ++index)
+                {
+                    curl_easy_setopt(this->_curlHandle, this->_options.methodChanges.options[index], this->_options.methodChanges.values[index]);
+                }
             }
         }
 
         void CurlEasyWrapper::PostFields(const std::string& fieldData)
         {
-            this->_postData = fieldData;
-            SetOpt(CURLOPT_POSTFIELDS, this->_postData);
+            if (this->_options.hasPostData && (0u == this->_options.methodChanges.count) && (this->_options.postDataSize == (curl_off_t)fieldData.size())
+                && (fieldData == this->_options.postData))
+            {
+                return;
+            }
+
+            AssignCounted(this->_options.postData, fieldData, CURL_ALLOC_POST_DATA);
+
+            // cURL does not copy the POST data, so it must point to our copy. The size is set as well, so that a
+            // body with NUL bytes is sent whole and the size of earlier POST data does not apply to this one.
+            SetBorrowed<CURLOPT_POSTFIELDS>(this->_options.postData.c_str());
+            Set<CURLOPT_POSTFIELDSIZE_LARGE>((curl_off_t)this->_options.postData.size());
+            this->_options.postDataSize = (curl_off_t)this->_options.postData.size();
+            this->_options.hasPostData = true;
+            this->_options.methodChanges.count = 0u;
+        }
+
+        void CurlEasyWrapper::CommitPostData(size_t capacityBefore)
+        {
+            if (this->_options.postData.capacity() != capacityBefore)
+            {
+                CurlGlobal::RecordAllocation(CURL_ALLOC_POST_DATA, this->_options.postData.capacity() + 1u);
+            }
+
+            // The data may have moved when it grew, and CBOR and MessagePack bodies may hold NUL bytes.
+            SetBorrowed<CURLOPT_POSTFIELDS>(this->_options.postData.c_str());
+            Set<CURLOPT_POSTFIELDSIZE_LARGE>((curl_off_t)this->_options.postData.size());
+            this->_options.postDataSize = (curl_off_t)this->_options.postData.size();
+            this->_options.hasPostData = true;
+            this->_options.methodChanges.count = 0u;
         }
 
         void CurlEasyWrapper::HttpHeader(std::unique_ptr<CurlSList>& slistPtr)
         {
-            this->_slistPtr = std::move(slistPtr);
-            const curl_slist* listPtr = this->_slistPtr->operator const curl_slist*();
-            SetOpt(CURLOPT_HTTPHEADER, listPtr);
+            if (slistPtr && this->_options.headers && (*slistPtr == *this->_options.headers))
+            {
+                // Same entries as the list in use; keep the old one.
+                slistPtr.reset();
+                return;
+            }
+
+            HttpHeader(std::shared_ptr<const CurlSList>(std::move(slistPtr)));
+        }
+
+        void CurlEasyWrapper::HttpHeader(const std::shared_ptr<const CurlSList>& headers)
+        {
+            if ((headers == this->_options.headers) && !this->_options.headerList)
+            {
+                return;
+            }
+
+            if (!headers)
+            {
+                ResetHttpHeader();
+                return;
+            }
+
+            const curl_slist* listPtr = headers->operator const curl_slist*();
+            SetTracked<CURLOPT_HTTPHEADER>(const_cast<curl_slist*>(listPtr));
+            this->_options.headers = headers;
+            this->_options.headerList.reset();
+        }
+
+        void CurlEasyWrapper::HttpHeader(const std::shared_ptr<const CurlHeaderList>& headers)
+        {
+            if ((headers == this->_options.headerList) && !this->_options.headers)
+            {
+                return;
+            }
+
+            if (!headers)
+            {
+                ResetHttpHeader();
+                return;
+            }
+
+            const curl_slist* listPtr = headers->operator const curl_slist*();
+            SetTracked<CURLOPT_HTTPHEADER>(const_cast<curl_slist*>(listPtr));
+            this->_options.headerList = headers;
+            this->_options.headers.reset();
+        }
+
+        void CurlEasyWrapper::ContentType(CurlBodyFormat format)
+        {
+            SetBodyFormatHeader("Content-Type", format);
+        }
+
+        void CurlEasyWrapper::Accept(CurlBodyFormat format)
+        {
+            SetBodyFormatHeader("Accept", format);
+        }
+
+        void CurlEasyWrapper::SetBodyFormatHeader(const char* name, CurlBodyFormat format)
+        {
+            const char* mediaType = CurlHeaderList::GetMediaType(format);
+            if (this->_options.headerList && (this->_options.headerList->GetValue(name) == CurlStringView(mediaType)))
+            {
+                return;
+            }
+
+            // A header list that is set may be shared, so the header is set in a copy, which is interned so that
+            // wrappers with the same headers share one list again.
+            CurlHeaderList headers;
+            if (this->_options.headerList)
+            {
+                headers = *this->_options.headerList;
+            }
+            else if (this->_options.headers)
+            {
+                for (const curl_slist* node = *this->_options.headers; node != nullptr; node = node->next)
+                {
+                    headers.Add(node->data);
+                }
+            }
+            headers.Set(name, mediaType);
+            HttpHeader(CurlHeaderList::Intern(headers));
+        }
+
+        void CurlEasyWrapper::RemoveBodyFormatContentType()
+        {
+            CurlBodyFormat format;
+            if (this->_options.headerList && TryGetBodyFormat(this->_options.headerList->GetValue("Content-Type"), format))
+            {
+                CurlHeaderList headers(*this->_options.headerList);
+                headers.Remove("Content-Type");
+                HttpHeader(CurlHeaderList::Intern(headers));
+            }
+        }
+
+        void CurlEasyWrapper::CheckResponseFormat(CurlBodyFormat format) const
+        {
+            // A body without a Content-Type or with a generic one is decoded; one that names another format is not.
+            CurlStringView contentType(this->_responseHeaders.Find("Content-Type"));
+            CurlBodyFormat named;
+            if (TryGetBodyFormat(contentType, named) && (named != format))
+            {
+                throw std::invalid_argument(string(AEF_METHOD_NAME) + ": the response is " + contentType.ToString() + ", not " + CurlHeaderList::GetMediaType(format));
+            }
         }
 
         string CurlEasyWrapper::Escape(const std::string& inputStr)
@@ -116,130 +421,303 @@ namespace AbcdEFramework
 
         void CurlEasyWrapper::Execute()
         {
-            CURLcode curlRes;
+            TryExecute().ThrowIfFailed();
+        }
+
+        CurlResult CurlEasyWrapper::TryExecute()
+        {
             ClearErrorMessageBuffer();
-            if (CURLE_OK != (curlRes = curl_easy_perform(this->_curlHandle)))
+            this->_responseHeaders.Clear();
+            CURLcode curlRes = curl_easy_perform(this->_curlHandle);
+            if (curlRes != CURLE_OK)
             {
-                throw CurlException(__PRETTY_FUNCTION__, curlRes, RetrieveErrorMessage(curlRes));
+                return CurlResult(curlRes, AEF_METHOD_NAME, this->_errorMsgBuffer.data());
             }
+
+            return CurlResult();
         }
 
-        void CurlEasyWrapper::Reset()
+        void CurlEasyWrapper::ReceiveSink(CurlReceiveSink* sink)
         {
-            curl_easy_reset(this->_curlHandle);
-            this->_slistPtr.release();
-            this->_postData.clear();
+            if (sink != nullptr)
+            {
+                SetTracked<CURLOPT_WRITEFUNCTION>(CurlEasyWrapper::CurlSinkDataProc);
+                SetTracked<CURLOPT_WRITEDATA>((void*)this);
+            }
+            else
+            {
+                SetTracked<CURLOPT_WRITEFUNCTION>(CurlEasyWrapper::CurlWriteDataProc);
+                SetTracked<CURLOPT_WRITEDATA>((void*)&(this->_receiveBuffer));
+            }
+
+            this->_receiveSink = sink;
+            this->_receivePaused = false;
         }
 
-        std::string CurlEasyWrapper::RetrieveErrorMessage(CURLcode errorCode) const
+        bool CurlEasyWrapper::ResumeReceive()
         {
-            size_t len = min(this->_errorMsgBuffer.size(), ::strlen(this->_errorMsgBuffer.data()));
-            if (len > 0u)
+            if (!this->_receivePaused || (this->_receiveSink == nullptr) || this->_receiveSink->IsFull())
             {
-                return string(this->_errorMsgBuffer.data(), len);
+                return false;
             }
 
-            return string(curl_easy_strerror(errorCode));
+            // Cleared first: cURL passes the held back data to the sink from within curl_easy_pause(), which may
+            // pause the transfer again.
+            this->_receivePaused = false;
+            CURLcode curlRes = curl_easy_pause(this->_curlHandle, CURLPAUSE_CONT);
+            if (CURLE_OK != curlRes)
+            {
+                throw CurlException(AEF_METHOD_NAME, curlRes, RetrieveErrorMessage(curlRes));
+            }
+
+            return true;
         }
 
-        void CurlEasyWrapper::SetOpt(CURLoption option, const std::string& optionData)
+        long CurlEasyWrapper::GetResponseCode() const
         {
-            // Return code from calls to cURL
+            long responseCode = 0;
             CURLcode curlRes;
-            ClearErrorMessageBuffer();
-            if (CURLE_OK != (curlRes = curl_easy_setopt(this->_curlHandle, option, optionData.c_str())))
+            if (CURLE_OK != (curlRes = curl_easy_getinfo(this->_curlHandle, CURLINFO_RESPONSE_CODE, &responseCode)))
             {
-                throw CurlException
-                (
-                    AEF_METHOD_NAME,
-                    curlRes,
-                    RetrieveErrorMessage(curlRes)
-                );
+                throw CurlException(AEF_METHOD_NAME, curlRes, RetrieveErrorMessage(curlRes));
             }
+
+            return responseCode;
         }
 
-        void CurlEasyWrapper::SetOpt(CURLoption option, bool optionData)
+        CurlEasyWrapper* CurlEasyWrapper::FromHandle(CURL* curlHandle)
         {
-            // Return code from calls to cURL
-            CURLcode curlRes;
-            ClearErrorMessageBuffer();
-            if (CURLE_OK != (curlRes = curl_easy_setopt(this->_curlHandle, option, optionData ? (long)1 : (long)0)))
+            char* ownerPtr = nullptr;
+            if (CURLE_OK != curl_easy_getinfo(curlHandle, CURLINFO_PRIVATE, &ownerPtr))
             {
-                throw CurlException
-                (
-                    AEF_METHOD_NAME,
-                    curlRes,
-                    RetrieveErrorMessage(curlRes)
-                );
+                return nullptr;
             }
+
+            return reinterpret_cast<CurlEasyWrapper*>(ownerPtr);
         }
 
-        void CurlEasyWrapper::SetOpt(CURLoption option, long optionData)
+        void CurlEasyWrapper::Reset()
         {
-            // Return code from calls to cURL
-            CURLcode curlRes;
-            ClearErrorMessageBuffer();
-            if (CURLE_OK != (curlRes = curl_easy_setopt(this->_curlHandle, option, optionData)))
+            curl_easy_reset(this->_curlHandle);
+            this->_options = CurlOptionState();
+            this->_responseHeaders = CurlResponseHeaders();
+            ApplyBaseline();
+            ClearReceiveBuffer();
+        }
+
+        void CurlEasyWrapper::ResetToBaseline()
+        {
+            curl_easy_reset(this->_curlHandle);
+
+            // Clear the cached values in place so that the strings keep their capacity.
+            this->_options.url.clear();
+            this->_options.timeoutMilliseconds = 0l;
+            this->_options.failOnErrors = false;
+            this->_options.verbose = false;
+            this->_options.headers.reset();
+            this->_options.headerList.reset();
+            this->_options.hasPostData = false;
+            this->_options.postData.clear();
+            this->_options.postDataSize = -1;
+            this->_options.longOptions.clear();
+            ApplyBaseline();
+
+            this->_receiveBuffer.clear();
+            this->_responseHeaders.Clear();
+        }
+
+        void CurlEasyWrapper::Restore(const CurlOptionState& state)
+        {
+            ApplyOptions(state, string(), state.hasPostData ? &state.postData : nullptr);
+            if (this->_options.postDataSize != state.postDataSize)
             {
-                throw CurlException
-                (
-                    AEF_METHOD_NAME,
-                    curlRes,
-                    RetrieveErrorMessage(curlRes)
-                );
+                Set<CURLOPT_POSTFIELDSIZE_LARGE>(state.postDataSize);
+                this->_options.postDataSize = state.postDataSize;
             }
         }
 
-        void CurlEasyWrapper::SetOpt(CURLoption option, void* optionData)
+        void CurlEasyWrapper::ApplyOptions(const CurlOptionState& state, const std::string& query, const std::string* postData)
         {
-            // Return code from calls to cURL
-            CURLcode curlRes;
-            ClearErrorMessageBuffer();
-            if (CURLE_OK != (curlRes = curl_easy_setopt(this->_curlHandle, option, optionData)))
+            UrlWithQuery(state.url, query);
+            UserAgent(state.userAgent);
+            SetTimeoutMilliseconds(state.timeoutMilliseconds);
+            FailOnHttpErrors(state.failOnErrors);
+            Verbose(state.verbose);
+            if (state.headerList)
+            {
+                HttpHeader(state.headerList);
+            }
+            else
+            {
+                HttpHeader(state.headers);
+            }
+            ApplyLongOptions(state.longOptions);
+
+            // A pooled handle keeps the method of its last request. There is no way to unset CURLOPT_POSTFIELDS, and
+            // it does not clear CURLOPT_NOBODY, so the handle is switched back to GET before the POST data is set.
+            CurlMethodChanges& methodChanges = this->_options.methodChanges;
+            if (((methodChanges.count != 0u) && !(methodChanges == state.methodChanges)) || ((postData == nullptr) && this->_options.hasPostData))
+            {
+                SetTracked<CURLOPT_HTTPGET>(1l);
+                this->_options.hasPostData = false;
+                methodChanges.count = 0u;
+            }
+            if (postData != nullptr)
+            {
+                PostFields(*postData);
+            }
+
+            // The method options of the state go on top of the POST data, or of GET.
+            if (!(methodChanges == state.methodChanges))
             {
-                throw CurlException
-                (
-                    AEF_METHOD_NAME,
-                    curlRes,
-                    RetrieveErrorMessage(curlRes)
-                );
+                for (size_t index = 0u; index < state.methodChanges.count; ++index)
+                {
+                    CURLcode curlRes = curl_easy_setopt(this->_curlHandle, state.methodChanges.options[index], state.methodChanges.values[index]);
+                    if (curlRes != CURLE_OK)
+                    {
+                        ThrowOptionError(state.methodChanges.options[index], curlRes);
+                    }
+                }
+                methodChanges = state.methodChanges;
             }
         }
 
-        size_t CurlEasyWrapper::CurlWriteDataProc(void* contents, size_t size, size_t nmemb, void *userp)
+        void CurlEasyWrapper::ApplyLongOptions(const std::vector<CurlLongOption>& longOptions)
+        {
+            vector<CurlLongOption>& cached = this->_options.longOptions;
+            if (longOptions == cached)
+            {
+                return;
+            }
+
+            // An option of the previous template that this one does not set goes back to its default, so that it
+            // does not leak into this request.
+            for (const CurlLongOption& applied : cached)
+            {
+                bool isSet = std::any_of(longOptions.begin(), longOptions.end(), [&applied](const CurlLongOption& wanted) { return wanted.option == applied.option; });
+                if (!isSet && (applied.value != applied.defaultValue))
+                {
+                    CURLcode curlRes = curl_easy_setopt(this->_curlHandle, applied.option, applied.defaultValue);
+                    if (curlRes != CURLE_OK)
+                    {
+                        throw CurlException(AEF_METHOD_NAME, curlRes, curl_easy_strerror(curlRes));
+                    }
+                }
+            }
+
+            for (const CurlLongOption& wanted : longOptions)
+            {
+                if (std::find(cached.begin(), cached.end(), wanted) == cached.end())
+                {
+                    CURLcode curlRes = curl_easy_setopt(this->_curlHandle, wanted.option, wanted.value);
+                    if (curlRes != CURLE_OK)
+                    {
+                        throw CurlException(AEF_METHOD_NAME, curlRes, curl_easy_strerror(curlRes));
+                    }
+                }
+            }
+
+            // The cache is only changed once every option was set, so a failure leaves the old values to compare with.
+            cached = longOptions;
+        }
+
+        void CurlEasyWrapper::UrlWithQuery(const std::string& prefix, const std::string& query)
+        {
+            string& cachedUrl = this->_options.url;
+            if ((cachedUrl.size() == prefix.size() + query.size())
+                && (cachedUrl.compare(0u, prefix.size(), prefix) == 0)
+                && (cachedUrl.compare(prefix.size(), string::npos, query) == 0))
+            {
+                return;
+            }
+
+            // Build the URL in the cache, where it keeps its capacity from one request to the next.
+            size_t capacityBefore = cachedUrl.capacity();
+            cachedUrl.assign(prefix).append(query);
+            if (cachedUrl.capacity() != capacityBefore)
+            {
+                CurlGlobal::RecordAllocation(CURL_ALLOC_OPTION_STRINGS, cachedUrl.capacity() + 1u);
+            }
+
+            CURLcode curlRes = curl_easy_setopt(this->_curlHandle, CURLOPT_URL, cachedUrl.c_str());
+            if (curlRes != CURLE_OK)
+            {
+                // cURL still has the previous URL, which is no longer known.
+                cachedUrl.clear();
+                ThrowOptionError(CURLOPT_URL, curlRes);
+            }
+        }
+
+        const char* CurlEasyWrapper::RetrieveErrorMessage(CURLcode errorCode) const
+        {
+            if (::strnlen(this->_errorMsgBuffer.data(), this->_errorMsgBuffer.size()) > 0u)
+            {
+                return this->_errorMsgBuffer.data();
+            }
+
+            return curl_easy_strerror(errorCode);
+        }
+
+        void CurlEasyWrapper::ThrowOptionError(CURLoption option, CURLcode errorCode) const
+        {
+            // Put the option in front of the message without going through the heap.
+            char detail[CURL_ERROR_SIZE];
+            ::snprintf(detail, sizeof(detail), "option %d: %s", (int)option, RetrieveErrorMessage(errorCode));
+            throw CurlException(AEF_METHOD_NAME, errorCode, detail);
+        }
+
+        size_t CurlEasyWrapper::CurlWriteDataProc(char* contents, size_t size, size_t nmemb, void *userp)
         {
             size_t processedSizeBytes = (size * nmemb);
 
             vector<unsigned char>* bufferPtr = reinterpret_cast<vector<unsigned char>*>(userp);
             unsigned char* sourcePtr = reinterpret_cast<unsigned char*>(contents);
+            size_t capacityBefore = bufferPtr->capacity();
             bufferPtr->insert(bufferPtr->end(), sourcePtr, sourcePtr + processedSizeBytes);
+            if (bufferPtr->capacity() != capacityBefore)
+            {
+                CurlGlobal::RecordAllocation(CURL_ALLOC_RECEIVE_BUFFER, bufferPtr->capacity());
+            }
 
             return processedSizeBytes;
         }
 
-        void CurlEasyWrapper::PostFieldSize(size_t postSize)
+        size_t CurlEasyWrapper::CurlSinkDataProc(char* contents, size_t size, size_t nmemb, void *userp)
         {
-            if (postSize <= ((size_t)2 * (size_t)(1024 * 1024 * 1024)))
-            {
-                SetOpt(CURLOPT_POSTFIELDSIZE, (long)postSize);
-            }
-            else
+            size_t processedSizeBytes = (size * nmemb);
+
+            // A full sink pauses the transfer; cURL keeps the chunk and passes it again when it is resumed. Only the
+            // loop of a multi stack can resume it, so without one the transfer fails instead of hanging.
+            CurlEasyWrapper* wrapper = reinterpret_cast<CurlEasyWrapper*>(userp);
+            CurlReceiveSink* sink = wrapper->_receiveSink;
+            if (sink->IsFull())
             {
-                SetOpt(CURLOPT_POSTFIELDSIZE_LARGE, (curl_off_t)postSize);
+                if (!wrapper->_attachedToMulti)
+                {
+                    return 0u;
+                }
+                wrapper->_receivePaused = true;
+                return CURL_WRITEFUNC_PAUSE;
             }
+
+            // Returning a different count makes cURL abort the transfer with CURLE_WRITE_ERROR.
+            return sink->Write(contents, processedSizeBytes) ? processedSizeBytes : 0u;
+        }
+
+        void CurlEasyWrapper::PostFieldSize(size_t postSize)
+        {
+            // Cached, so that PostFields() with the same data sets its size again.
+            Set<CURLOPT_POSTFIELDSIZE_LARGE>((curl_off_t)postSize);
+            this->_options.postDataSize = (curl_off_t)postSize;
         }
 
         ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // CurlSList
         ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         CurlSList::CurlSList()
-            :   mSList(curl_slist_append(mSList, nullptr))
+            :   mSList(nullptr)
         {
-            // Check if the list was initialised
-            if (mSList == nullptr)
-            {
-                throw CurlException(AEF_METHOD_NAME);
-            }
+            // An empty curl_slist is represented by a null pointer.
         }
 
         CurlSList::CurlSList(CurlSList&& src)
@@ -252,11 +730,8 @@ namespace AbcdEFramework
             :   mSList(nullptr)
         {
             // Attempt to add a new element
-            if (nullptr == ::curl_slist_append(mSList, listEntry.c_str()))
+            if (nullptr == (mSList = AppendEntry(mSList, listEntry)))
             {
-                // Failed. Free the list and raise an exception.
-                curl_slist_free_all(mSList);
-                mSList = nullptr;
                 throw CurlException(AEF_METHOD_NAME);
             }
         }
@@ -264,17 +739,11 @@ namespace AbcdEFramework
         CurlSList::CurlSList(std::initializer_list<std::string> listEntries)
             :   mSList(nullptr)
         {
-            //mSList = curl_slist_append(mSList, nullptr);
-            // Check if the list was initialised
-            //if (mSList == nullptr)
-            //{
-            //    throw CurlException(AEF_METHOD_NAME);
-            //}
-
             // Attempt to add elements
-            for (std::string element : listEntries)
+            for (const std::string& element : listEntries)
             {
-                if (nullptr == ::curl_slist_append(mSList, element.c_str()))
+                curl_slist* appendedList = AppendEntry(mSList, element);
+                if (nullptr == appendedList)
                 {
                     // Failed. Free the list and raise an exception.
                     if (mSList != nullptr)
@@ -284,6 +753,7 @@ namespace AbcdEFramework
                     }
                     throw CurlException(AEF_METHOD_NAME);
                 }
+                mSList = appendedList;
             }
         }
 
@@ -314,20 +784,53 @@ namespace AbcdEFramework
 
         CurlSList& CurlSList::operator+=(const std::string& listEntry)
         {
-            if (nullptr == ::curl_slist_append(mSList, listEntry.c_str()))
+            curl_slist* appendedList = AppendEntry(mSList, listEntry);
+            if (nullptr == appendedList)
             {
                 throw CurlException(AEF_METHOD_NAME);
             }
+            mSList = appendedList;
 
             return *this;
         }
 
+        curl_slist* CurlSList::AppendEntry(curl_slist* list, const std::string& listEntry)
+        {
+            curl_slist* appendedList = ::curl_slist_append(list, listEntry.c_str());
+            if (appendedList != nullptr)
+            {
+                // curl_slist_append() allocates the node and a copy of the string.
+                CurlGlobal::RecordAllocation(CURL_ALLOC_SLIST, sizeof(curl_slist));
+                CurlGlobal::RecordAllocation(CURL_ALLOC_SLIST, listEntry.size() + 1u);
+            }
+            return appendedList;
+        }
+
+        bool CurlSList::operator==(const CurlSList& rhs) const
+        {
+            const curl_slist* lhsNode = this->mSList;
+            const curl_slist* rhsNode = rhs.mSList;
+            while ((lhsNode != nullptr) && (rhsNode != nullptr))
+            {
+                if (::strcmp(lhsNode->data, rhsNode->data) != 0)
+                {
+                    return false;
+                }
+                lhsNode = lhsNode->next;
+                rhsNode = rhsNode->next;
+            }
+
+            return (lhsNode == nullptr) && (rhsNode == nullptr);
+        }
+
         void CurlSList::Append(const std::string& listEntry)
         {
-            if (nullptr == ::curl_slist_append(mSList, listEntry.c_str()))
+            curl_slist* appendedList = AppendEntry(mSList, listEntry);
+            if (nullptr == appendedList)
             {
                 throw CurlException(AEF_METHOD_NAME);
             }
+            mSList = appendedList;
         }
     } // namespace Web
 } // namespace AbcdEFramework
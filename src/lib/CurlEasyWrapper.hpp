@@ -2,6 +2,29 @@
  * @file
  * @brief Declaration of the CurlEasyWrapper class.
  * @date 2017-01-07 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] The write callback and the SetOpt() helpers are protected so that benchmarks can reach them.
+ * @date 2026-10-19 [JFDR] Growth of the wrapper's own buffers is counted by CurlGlobal.
+ * @date 2026-10-19 [JFDR] The SetOpt() overloads are replaced by Set<>(), which checks the argument type at compile time.
+ * @date 2026-10-19 [JFDR] Added TryExecute() and TrySet<>(), which return a CurlResult instead of throwing.
+ * @date 2026-10-19 [JFDR] RetrieveErrorMessage() returns a pointer instead of a string copy.
+ * @date 2026-10-19 [JFDR] The values of the options set by the wrapper are cached so that unchanged values are not set again.
+ * @date 2026-10-19 [JFDR] Added ResetToBaseline(). Reset() no longer loses the options set by the constructor.
+ * @date 2026-10-19 [JFDR] Added move support and Clone(). Copying is deleted.
+ * @date 2026-10-19 [JFDR] Restore() is built on ApplyOptions(), which CurlPreparedRequest uses as well.
+ * @date 2026-10-19 [JFDR] HttpHeader() accepts a shared CurlHeaderList.
+ * @date 2026-10-19 [JFDR] The response headers are stored and can be read with GetResponseHeaders().
+ * @date 2026-10-19 [JFDR] Added ReceiveSink() to stream the body to a CurlReceiveSink.
+ * @date 2026-10-19 [JFDR] Added ParseJsonResponse(), which parses the receive buffer in place.
+ * @date 2026-10-19 [JFDR] Added PostJson(), which serialises a JSON value straight into the POST data.
+ * @date 2026-10-19 [JFDR] Added PostCbor(), PostMsgPack(), ParseCborResponse() and ParseMsgPackResponse().
+ * @date 2026-10-19 [JFDR] A full sink pauses the transfer; added ResumeReceive().
+ * @date 2026-10-19 [JFDR] Set<>() and TrySet<>() reject the options that the wrapper tracks itself.
+ * @date 2026-10-19 [JFDR] The request method that was set after the POST data survives a move and Clone().
+ * @date 2026-10-19 [JFDR] The long options of a CurlPreparedRequest are cached in CurlOptionState::longOptions.
+ * @date 2026-10-19 [JFDR] Added ContentType() and Accept(). The Post and Parse methods of the body formats use them.
+ * @date 2026-10-19 [JFDR] A full sink fails a transfer that is not attached to a CurlMultiWrapper instead of pausing it.
+ * @date 2026-10-19 [JFDR] The request method options are part of CurlOptionState, so that Restore() restores the method.
+ * @date 2026-10-19 [JFDR] The size set by PostFieldSize() is cached, so that PostFields() does not skip the data after it.
  */
 #if !defined CURL_EASY_WRAPPER_67AC882F4E9645AC891475F9D4467B68
 #define CURL_EASY_WRAPPER_67AC882F4E9645AC891475F9D4467B68 1
@@ -9,36 +32,118 @@
 #include <initializer_list>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <vector>
 #include <curl/curl.h>
+#include "CurlBinaryWriter.hpp"
 #include "CurlException.hpp"
+#include "CurlGlobal.hpp"
+#include "CurlHeaderList.hpp"
+#include "CurlJsonWriter.hpp"
+#include "CurlOptionTraits.hpp"
+#include "CurlReceiveSink.hpp"
+#include "CurlResponseHeaders.hpp"
+#include "CurlResult.hpp"
 
 // Expands into a method declaration
 #define AEF_BOOL_METHOD_DECL(METHOD_NAME, FLAG_DEFAULT) inline void METHOD_NAME(bool flag = FLAG_DEFAULT);
 
-// Expands into a method body that calls SetOpt()
-#define AEF_BOOL_METHOD_DEF(METHOD_NAME, CURL_OPT) inline void CurlEasyWrapper::METHOD_NAME(bool flag) { SetOpt(CURL_OPT, flag ? 1l : 0l); }
+// Expands into a method body that calls SetTracked<>()
+// These options change the request method, which also decides whether the POST data is used.
+#define AEF_BOOL_METHOD_DEF(METHOD_NAME, CURL_OPT) inline void CurlEasyWrapper::METHOD_NAME(bool flag) { SetTracked<CURL_OPT>(flag ? 1l : 0l); RecordMethodChange(CURL_OPT, flag ? 1l : 0l); }
 
 
 namespace AbcdEFramework
 {
     namespace Web
     {
+        class CurlPreparedRequest;
         class CurlSList;
 
+        /**
+         * @brief Value of an option that takes a long and is set by a \c CurlPreparedRequest.
+         */
+        struct CurlLongOption
+        {
+            CURLoption option; ///< The option.
+            long value; ///< Value of the option.
+            long defaultValue; ///< Value on a new wrapper, which is set again when a later template does not set the option.
+
+            /**
+             * @brief Test whether two entries set the same option to the same value.
+             */
+            inline bool operator==(const CurlLongOption& rhs) const;
+        };
+
+        /**
+         * @brief Request method options (\c CURLOPT_POST, \c CURLOPT_NOBODY and \c CURLOPT_UPLOAD) that were set since
+         *      the handle was last switched to GET or given POST data.
+         * @remark Setting \c CURLOPT_POSTFIELDS selects POST, so they are set again after it is pointed at moved POST
+         *      data. Each option is kept once, in the order of its last change.
+         */
+        struct CurlMethodChanges
+        {
+            CURLoption options[3]; ///< The options, oldest change first.
+            long values[3]; ///< The values of the options.
+            size_t count; ///< Number of options that were set; zero if the POST data or GET selects the method.
+
+            /**
+             * @brief Construct an empty list.
+             */
+            CurlMethodChanges();
+
+            /**
+             * @brief Test whether two lists set the same options to the same values in the same order.
+             */
+            inline bool operator==(const CurlMethodChanges& rhs) const;
+        };
+
+        /**
+         * @brief Values of the options that \c CurlEasyWrapper sets on its handle.
+         * @remark Returned by \c CurlEasyWrapper::Snapshot() and passed to \c CurlEasyWrapper::Restore(). The header
+         *      list is shared between the wrapper and its snapshots, so taking a snapshot does not copy it.
+         */
+        struct CurlOptionState
+        {
+            std::string url; ///< Value of \c CURLOPT_URL.
+            std::string userAgent; ///< Value of \c CURLOPT_USERAGENT.
+            long timeoutMilliseconds; ///< Value of \c CURLOPT_TIMEOUT_MS. \c CURLOPT_TIMEOUT sets the same value.
+            bool failOnErrors; ///< Value of \c CURLOPT_FAILONERROR.
+            bool verbose; ///< Value of \c CURLOPT_VERBOSE.
+            std::shared_ptr<const CurlSList> headers; ///< Value of \c CURLOPT_HTTPHEADER if set from a \c CurlSList.
+            std::shared_ptr<const CurlHeaderList> headerList; ///< Value of \c CURLOPT_HTTPHEADER if set from a \c CurlHeaderList.
+            bool hasPostData; ///< Set if \c CURLOPT_POSTFIELDS points to \c postData.
+            std::string postData; ///< The data that \c CURLOPT_POSTFIELDS points to.
+            curl_off_t postDataSize; ///< Value of \c CURLOPT_POSTFIELDSIZE_LARGE, which \c PostFieldSize() may set to less than the size of \c postData.
+            std::vector<CurlLongOption> longOptions; ///< Other options that take a long, in the order they were set.
+            CurlMethodChanges methodChanges; ///< Request method options that were set, after \c postData if there is any.
+
+            /**
+             * @brief Construct the state of a handle on which none of the options were set.
+             */
+            CurlOptionState();
+        };
+
         /**
          * @brief Wrapper around the cURL easy interface.
          */
         class CurlEasyWrapper
         {
+            friend class CurlMultiWrapper;
+            friend class CurlPreparedRequest;
+
+            private:
+                static const char* const DefaultUserAgent; ///< User agent that the wrapper sets on a new handle.
+
             private:
                 CURL* _curlHandle; ///< Handle to the ession.
                 std::vector<char> _errorMsgBuffer; ///< Buffer where exception messages are dumped.
                 std::vector<unsigned char> _receiveBuffer; ///< Buffer where data received from cURL is stored.
-                std::string _agent; ///< Copy of the agent string;
-                std::string _url; ///< Copy of the URL
-                std::string _postData; ///< Copy of the data given to the \c PostFields() method.
-                std::unique_ptr<CurlSList> _slistPtr; ///< Pointer to an instance of \c CurlSList.
+                CurlResponseHeaders _responseHeaders; ///< Headers of the last response.
+                CurlReceiveSink* _receiveSink; ///< Receives the body instead of \c _receiveBuffer, if set.
+                bool _receivePaused; ///< Set if the transfer was paused because \c _receiveSink was full.
+                bool _attachedToMulti; ///< Set while the handle is attached to a \c CurlMultiWrapper.
+                CurlOptionState _options; ///< Values of the options that were set through the wrapper.
 
             public:
                 /**
@@ -46,12 +151,34 @@ namespace AbcdEFramework
                  */
                 CurlEasyWrapper();
 
+                /**
+                 * @brief Move constructor.
+                 * @remark The options that point back into the wrapper (\c CURLOPT_ERRORBUFFER, \c CURLOPT_WRITEDATA,
+                 *      \c CURLOPT_PRIVATE and \c CURLOPT_POSTFIELDS) are pointed at the new object. The source must
+                 *      not be used afterwards, other than to be destroyed or assigned to.
+                 */
+                CurlEasyWrapper(CurlEasyWrapper&& src) noexcept;
+
                 /**
                  * @brief Destructor.
                  */
                 ~CurlEasyWrapper();
 
             public:
+                /**
+                 * @brief Move assignment operator. Cleans up the current handle and takes over the one of \c src.
+                 */
+                CurlEasyWrapper& operator=(CurlEasyWrapper&& src) noexcept;
+
+            public:
+                /**
+                 * @brief Create a new wrapper with a copy of all options of this one.
+                 * @remark Built on \c curl_easy_duphandle(), so the options are copied in one call instead of being
+                 *      set again one by one. Use it to stamp out requests from a configured template. Connections
+                 *      and the receive buffer are not shared; the header list is.
+                 */
+                CurlEasyWrapper Clone() const;
+
                 /**
                  * @brief Clears the contents of the receive buffer.
                  */
@@ -62,6 +189,30 @@ namespace AbcdEFramework
                  */
                 void Execute();
 
+                /**
+                 * @brief Execute the command that was constructed without throwing on failure.
+                 * @return The outcome of the transfer. The error message is only built if it is asked for.
+                 */
+                CurlResult TryExecute();
+
+                /**
+                 * @brief Get the underlying cURL handle, e.g. to attach it to a multi stack.
+                 */
+                inline CURL* GetHandle() const;
+
+                /**
+                 * @brief Get the HTTP response code of the last transfer.
+                 * @return The response code, or zero if no response was received.
+                 */
+                long GetResponseCode() const;
+
+                /**
+                 * @brief Get the wrapper that owns a cURL handle.
+                 * @param curlHandle A handle that was created by a \c CurlEasyWrapper.
+                 * @return Pointer to the owning wrapper, or \c nullptr if the handle has no owner.
+                 */
+                static CurlEasyWrapper* FromHandle(CURL* curlHandle);
+
                 /**
                  * @brief Get a reference to the receive buffer.
                  * @return Returns a reference to the buffer where we write data that is received.
@@ -74,17 +225,129 @@ namespace AbcdEFramework
                  */
                 inline std::vector<unsigned char> MoveReceiveBufferData();
 
+                /**
+                 * @brief Parse the receive buffer as JSON, reading it in place instead of copying it into a string.
+                 * @remark \c JsonType is a \c nlohmann::basic_json type such as \c nlohmann::json; include
+                 *      \c json.hpp before calling it. Throws what \c JsonType::parse() throws if the body is not
+                 *      valid JSON, including an empty body. Throws \c std::invalid_argument if the \c Content-Type
+                 *      of the response is that of CBOR or MessagePack.
+                 */
+                template <typename JsonType>
+                inline JsonType ParseJsonResponse() const;
+
+                /**
+                 * @brief Decode the receive buffer as CBOR, reading it in place instead of copying it into a new vector.
+                 * @remark \c JsonType is a \c nlohmann::basic_json type; include \c json.hpp before calling it.
+                 *      Throws what \c JsonType::from_cbor() throws if the body is not valid CBOR. Call
+                 *      <tt>Accept(CURL_BODY_CBOR)</tt> before the transfer to ask for it. Throws
+                 *      \c std::invalid_argument if the \c Content-Type of the response is that of another body
+                 *      format, e.g. an error message in JSON; a response without one or with another media type is
+                 *      decoded.
+                 */
+                template <typename JsonType>
+                inline JsonType ParseCborResponse() const;
+
+                /**
+                 * @brief Decode the receive buffer as MessagePack, reading it in place instead of copying it into a
+                 *      new vector.
+                 * @remark See \c ParseCborResponse().
+                 */
+                template <typename JsonType>
+                inline JsonType ParseMsgPackResponse() const;
+
+                /**
+                 * @brief Stream the body of the following responses to a sink instead of the receive buffer.
+                 * @param sink The sink, or \c nullptr to use the receive buffer again. The wrapper does not take
+                 *      ownership; the sink must stay alive while it is set. \c Reset(), \c ResetToBaseline() and
+                 *      \c Clone() do not keep the sink.
+                 */
+                void ReceiveSink(CurlReceiveSink* sink);
+
+                /**
+                 * @brief Get the sink that receives the body.
+                 * @return The sink, or \c nullptr if the body goes to the receive buffer.
+                 */
+                inline CurlReceiveSink* GetReceiveSink() const;
+
+                /**
+                 * @brief Resume a transfer that was paused because its sink was full, if the sink has room again.
+                 * @remark Call it from the loop that drives the transfer with \c CurlMultiWrapper after the sink
+                 *      was drained. cURL may pass the held back data to the sink before this method returns. A
+                 *      transfer that is not attached to a \c CurlMultiWrapper, such as \c Execute(), is not paused
+                 *      but fails with \c CURLE_WRITE_ERROR when the sink is full, since nothing could resume it.
+                 * @return \c true if the transfer was paused and has been resumed.
+                 */
+                bool ResumeReceive();
+
+                /**
+                 * @brief Get the headers of the last response.
+                 * @remark The headers are only parsed when they are read. The views they return are valid until the
+                 *      next transfer or reset.
+                 */
+                inline const CurlResponseHeaders& GetResponseHeaders() const;
+
                 /**
                  * @brief Reset the connection to its initial state.
+                 * @remark The options are reset as by \c ResetToBaseline(), and the memory held by the receive
+                 *      buffer and the cached option values is released.
                  */
                 void Reset();
 
+                /**
+                 * @brief Reset all options to the values that the constructor set, so that the handle can be used for
+                 *      an unrelated request.
+                 * @remark Open connections and the DNS and TLS session caches are kept. The receive buffer is
+                 *      emptied but keeps its capacity, and the cached strings keep theirs. The header list is
+                 *      released; it is freed once no other wrapper or snapshot shares it. Options that were set
+                 *      directly on the handle, e.g. by a transport, must be set again.
+                 */
+                void ResetToBaseline();
+
+                /**
+                 * @brief Take a copy of the options that were set through the wrapper.
+                 * @remark Use together with \c Restore() to switch one handle between request types.
+                 */
+                inline CurlOptionState Snapshot() const;
+
+                /**
+                 * @brief Set the options to the values in a snapshot.
+                 * @param state A snapshot taken with \c Snapshot(), from this or another wrapper.
+                 * @remark Only the options whose value differs from the current one are passed to cURL. The request
+                 *      method is restored too: cURL has no way to unset \c CURLOPT_POSTFIELDS or the other method
+                 *      options, so the handle is switched to GET with \c CURLOPT_HTTPGET first, and the POST data and
+                 *      the method options of the snapshot are set after it.
+                 */
+                void Restore(const CurlOptionState& state);
+
             public:
                 /**
                  * @brief Operator to get a reference to the receive buffer;
                  */
                 inline operator const std::vector<unsigned char>&() const;
 
+            public:
+                /**
+                 * @brief Set a cURL option.
+                 * @tparam Option Option identifier. The option must be listed in \c CurlOptionTraits.
+                 * @param value Value of the option. The type is taken from \c CurlOptionTraits, so passing a value of
+                 *      the wrong type does not compile. Strings are not copied, because cURL makes its own copy.
+                 * @remark Options where cURL keeps the caller's string (\c CURLOPT_POSTFIELDS) are rejected at
+                 *      compile time; use the wrapper method that keeps a copy instead. So are the options that the
+                 *      wrapper tracks itself, such as the URL, the timeout and the request method (see
+                 *      \c CurlOptionTraits), because its methods would not know the value that was set.
+                 */
+                template <CURLoption Option>
+                inline void Set(typename CurlOptionTraits<Option>::value_type value);
+
+                /**
+                 * @brief Set a cURL option without throwing on failure.
+                 * @tparam Option Option identifier. The option must be listed in \c CurlOptionTraits.
+                 * @param value Value of the option. The same rules as for \c Set() apply.
+                 * @return The outcome of the call.
+                 */
+                template <CURLoption Option>
+                inline CurlResult TrySet(typename CurlOptionTraits<Option>::value_type value);
+
             public:
                 /**
                  * @brief Number of seconds to wait before a transfer times out.
@@ -139,16 +402,77 @@ namespace AbcdEFramework
             public:
                 /**
                  * @brief Data to be posted to the server.
-                 * @param fieldData POST data.
+                 * @param fieldData POST data. It may hold NUL bytes; the size of the POST data is set to its size.
                  */
                 void PostFields(const std::string& fieldData);
 
+                /**
+                 * @brief Serialise a JSON value into the POST data.
+                 * @param value The value, of a \c nlohmann::basic_json type; include \c json.hpp before calling it.
+                 * @param prefix Written before the value, e.g. \c UploadValue= for a form field.
+                 * @param suffix Written after the value.
+                 * @remark The text is written by \c CurlJsonWriter straight into the buffer that cURL sends, with no
+                 *      string or stream in between. The buffer keeps its capacity, so a body no larger than one
+                 *      sent before does not allocate. The size of the POST data is set to that of the text.
+                 *
+                 *      A body that is only the value is sent as \c application/json. With a prefix or a suffix it is
+                 *      something else, e.g. a form, so a \c Content-Type header that names JSON, CBOR or MessagePack
+                 *      is removed and cURL sends its default for POST data.
+                 */
+                template <typename JsonType>
+                inline void PostJson(const JsonType& value, const char* prefix = "", const char* suffix = "");
+
+                /**
+                 * @brief Encode a JSON value as CBOR into the POST data.
+                 * @param value The value, of a \c nlohmann::basic_json type; include \c json.hpp before calling it.
+                 * @remark The bytes are those of \c JsonType::to_cbor(), written by \c CurlBinaryWriter straight into
+                 *      the buffer that cURL sends, as \c PostJson() does for text. The \c Content-Type header is set
+                 *      to \c application/cbor.
+                 */
+                template <typename JsonType>
+                inline void PostCbor(const JsonType& value);
+
+                /**
+                 * @brief Encode a JSON value as MessagePack into the POST data.
+                 * @remark See \c PostCbor(). The bytes are those of \c JsonType::to_msgpack(), and the
+                 *      \c Content-Type header is set to \c application/msgpack.
+                 */
+                template <typename JsonType>
+                inline void PostMsgPack(const JsonType& value);
+
+                /**
+                 * @brief Set the \c Content-Type header to the media type of a body format.
+                 * @remark The header is set in a copy of the current header list, which is interned and set with
+                 *      \c HttpHeader(). Nothing changes if the list already has that header.
+                 */
+                void ContentType(CurlBodyFormat format);
+
+                /**
+                 * @brief Set the \c Accept header to the media type of a body format.
+                 * @remark See \c ContentType().
+                 */
+                void Accept(CurlBodyFormat format);
+
                 /**
                  * @brief Set custom HTTP headers.
-                 * @param slistPtr Pointer to an \c CurlSList instance
+                 * @param slistPtr Pointer to an \c CurlSList instance. The wrapper takes ownership. If the list has
+                 *      the same entries as the current one, it is discarded and the option is not set again.
                  */
                 void HttpHeader(std::unique_ptr<CurlSList>& slistPtr);
 
+                /**
+                 * @brief Set custom HTTP headers from a list that is shared with other wrappers.
+                 * @param headers The list. Setting the list that is already in use does nothing.
+                 */
+                void HttpHeader(const std::shared_ptr<const CurlSList>& headers);
+
+                /**
+                 * @brief Set custom HTTP headers from a header list that is shared with other wrappers.
+                 * @param headers The list, usually from \c CurlHeaderList::Intern(). It must not be changed while it
+                 *      is set. Setting the list that is already in use does nothing.
+                 */
+                void HttpHeader(const std::shared_ptr<const CurlHeaderList>& headers);
+
                 /**
                  * @brief Calls \c curl_easy_escape() to convert the input string to an escaped string.
                  */
@@ -175,46 +499,175 @@ namespace AbcdEFramework
                 inline void ClearErrorMessageBuffer();
 
                 /**
-                 * @brief Callback method to write data received from cURL when executing a call.
+                 * @brief Set the options that every handle of the wrapper needs, and record them in \c _options.
                  */
-                static size_t CurlWriteDataProc(void* contents, size_t size, size_t nmemb, void *userp);
+                void ApplyBaseline();
 
                 /**
-                 * @brief Converts the contents of the \c _errorMsgBuffer to a string.
-                 * @param errorCode The error code that was received in case a generic error message must be constructed.
-                 * @return Returns a string object with the error message harvested from the \c _errorMsgBuffer
+                 * @brief Point the options that refer to members of the wrapper at this object.
+                 * @remark Used after the handle changed owner through a move or \c curl_easy_duphandle(). Setting
+                 *      these options only stores a pointer, so failures are not possible and are not checked.
                  */
-                std::string RetrieveErrorMessage(CURLcode errorCode) const;
+                void RepointHandleData() noexcept;
 
                 /**
-                 * @brief Helper to set a cURL option.
-                 * @param option Option identifier.
-                 * @param optionData Data to set.
+                 * @brief Set a header to the media type of a body format in a copy of the header list.
                  */
-                void SetOpt(CURLoption option, const std::string& optionData);
+                void SetBodyFormatHeader(const char* name, CurlBodyFormat format);
 
                 /**
-                 * @brief Helper to set a cURL option.
-                 * @param option Option identifier.
-                 * @param optionData Data to set.
+                 * @brief Remove the \c Content-Type header from a copy of the header list if it names a body format.
                  */
-                void SetOpt(CURLoption option, bool optionData);
+                void RemoveBodyFormatContentType();
 
                 /**
-                 * @brief Helper to set a cURL option.
-                 * @param option Option identifier.
-                 * @param optionData Data to set.
+                 * @brief Throw \c std::invalid_argument if the \c Content-Type of the response is that of another
+                 *      body format than \c format.
+                 */
+                void CheckResponseFormat(CurlBodyFormat format) const;
+
+                /**
+                 * @brief Remember that a request method option was set after \c CURLOPT_POSTFIELDS.
                  */
-                void SetOpt(CURLoption option, long optionData);
+                inline void RecordMethodChange(CURLoption option, long value);
 
                 /**
-                 * @brief Helper to set a cURL option that requires a pointer to a data structure.
+                 * @brief Construct a wrapper around a handle made by \c curl_easy_duphandle().
+                 */
+                CurlEasyWrapper(CURL* curlHandle, const CurlOptionState& options);
+
+                /**
+                 * @brief Copy constructor is deleted
+                 */
+                CurlEasyWrapper(const CurlEasyWrapper& src) = delete;
+
+                /**
+                 * @brief Copy assignment operator is deleted
+                 */
+                CurlEasyWrapper& operator=(const CurlEasyWrapper& src) = delete;
+
+                /**
+                 * @brief Get the error message from the \c _errorMsgBuffer.
+                 * @param errorCode The error code that was received in case a generic error message must be used.
+                 * @return Returns the error message in the \c _errorMsgBuffer, or the generic message if the buffer
+                 *      is empty.
+                 */
+                const char* RetrieveErrorMessage(CURLcode errorCode) const;
+
+                /**
+                 * @brief Assign a string and count the allocation if the string had to grow.
+                 * @param target The string to assign to.
+                 * @param value The new value.
+                 * @param source Where the allocation is counted.
+                 */
+                static inline void AssignCounted(std::string& target, const std::string& value, CurlAllocationSource source);
+
+                /**
+                 * @brief Set the options in \c state whose value differs from the cached one.
+                 * @param state The option values. The URL is taken as a prefix.
+                 * @param query Appended to the URL in \c state.
+                 * @param postData The POST data, or \c nullptr to send a request without a body.
+                 */
+                void ApplyOptions(const CurlOptionState& state, const std::string& query, const std::string* postData);
+
+                /**
+                 * @brief Set the long options whose value differs from the cached one, and set the options that are
+                 *      cached but not in \c longOptions back to their default.
+                 */
+                void ApplyLongOptions(const std::vector<CurlLongOption>& longOptions);
+
+                /**
+                 * @brief Point \c CURLOPT_POSTFIELDS at \c _options.postData after it was written in place, and set its
+                 *      size.
+                 * @param capacityBefore Capacity of the POST data before it was written, to count its growth.
+                 */
+                void CommitPostData(size_t capacityBefore);
+
+                /**
+                 * @brief Set the URL to \c prefix followed by \c query, unless that is the cached URL already.
+                 */
+                void UrlWithQuery(const std::string& prefix, const std::string& query);
+
+                /**
+                 * @brief Set \c CURLOPT_TIMEOUT_MS if the value differs from the cached one.
+                 */
+                inline void SetTimeoutMilliseconds(long timeoutMilliseconds);
+
+                /**
+                 * @brief Set an option that the wrapper tracks, from the methods that keep track of it.
+                 */
+                template <CURLoption Option>
+                inline void SetTracked(typename CurlOptionTraits<Option>::value_type value);
+
+                /**
+                 * @brief Set a cURL option without checking whether cURL copies the value.
+                 */
+                template <CURLoption Option>
+                inline void SetBorrowed(typename CurlOptionTraits<Option>::value_type value);
+
+                /**
+                 * @brief Throw the exception for an option that could not be set.
                  * @param option Option identifier.
-                 * @param optionData Data to set.
+                 * @param errorCode Error code that was returned by \c curl_easy_setopt().
                  */
-                void SetOpt(CURLoption option, void* optionData);
+                [[noreturn]] AEF_COLD_PATH void ThrowOptionError(CURLoption option, CURLcode errorCode) const;
+
+            protected:
+                /**
+                 * @brief Callback method to write data received from cURL when executing a call.
+                 */
+                static size_t CurlWriteDataProc(char* contents, size_t size, size_t nmemb, void *userp);
+
+                /**
+                 * @brief Callback method that passes the data received from cURL to a \c CurlReceiveSink.
+                 */
+                static size_t CurlSinkDataProc(char* contents, size_t size, size_t nmemb, void *userp);
         }; // class CurlEasyWrapper
 
+        inline bool CurlLongOption::operator==(const CurlLongOption& rhs) const
+        {
+            return (this->option == rhs.option) && (this->value == rhs.value);
+        }
+
+        inline bool CurlMethodChanges::operator==(const CurlMethodChanges& rhs) const
+        {
+            if (this->count != rhs.count)
+            {
+                return false;
+            }
+            for (size_t index = 0u; index < this->count; ++index)
+            {
+                if ((this->options[index] != rhs.options[index]) || (this->values[index] != rhs.values[index]))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        inline void CurlEasyWrapper::RecordMethodChange(CURLoption option, long value)
+        {
+            CurlMethodChanges& changes(this->_options.methodChanges);
+            size_t index = 0u;
+            while ((index < changes.count) && (changes.options[index] != option))
+            {
+                ++index;
+            }
+
+            // Move the option to the end; an earlier value of the same option no longer matters.
+            for (; index + 1u < changes.count; ++index)
+            {
+                changes.options[index] = changes.options[index + 1u];
+                changes.values[index] = changes.values[index + 1u];
+            }
+            if (index == changes.count)
+            {
+                ++changes.count;
+            }
+            changes.options[changes.count - 1u] = option;
+            changes.values[changes.count - 1u] = value;
+        }
+
         inline void CurlEasyWrapper::ClearErrorMessageBuffer()
         {
             _errorMsgBuffer[0] = '\0';
@@ -226,6 +679,11 @@ namespace AbcdEFramework
             this->_receiveBuffer.shrink_to_fit();
         }
 
+        inline CURL* CurlEasyWrapper::GetHandle() const
+        {
+            return this->_curlHandle;
+        }
+
         inline CurlEasyWrapper::operator const std::vector<unsigned char>&() const
         {
             return this->_receiveBuffer;
@@ -236,51 +694,206 @@ namespace AbcdEFramework
             return this->_receiveBuffer;
         }
 
+        inline CurlReceiveSink* CurlEasyWrapper::GetReceiveSink() const
+        {
+            return this->_receiveSink;
+        }
+
+        inline const CurlResponseHeaders& CurlEasyWrapper::GetResponseHeaders() const
+        {
+            return this->_responseHeaders;
+        }
+
         inline std::vector<unsigned char> CurlEasyWrapper::MoveReceiveBufferData()
         {
             return std::move(this->_receiveBuffer);
         }
 
+        template <typename JsonType>
+        inline JsonType CurlEasyWrapper::ParseJsonResponse() const
+        {
+            CheckResponseFormat(CURL_BODY_JSON);
+
+            // The buffer is not NUL terminated, so the iterator range overload is used rather than the pointer one.
+            const unsigned char* first = this->_receiveBuffer.data();
+            return JsonType::parse(first, first + this->_receiveBuffer.size());
+        }
+
+        template <typename JsonType>
+        inline JsonType CurlEasyWrapper::ParseCborResponse() const
+        {
+            // from_cbor() takes a vector of uint8_t, which is the type of the receive buffer, so it is not copied.
+            static_assert(std::is_same<std::vector<unsigned char>, std::vector<uint8_t>>::value, "uint8_t is not unsigned char");
+            CheckResponseFormat(CURL_BODY_CBOR);
+            return JsonType::from_cbor(this->_receiveBuffer);
+        }
+
+        template <typename JsonType>
+        inline JsonType CurlEasyWrapper::ParseMsgPackResponse() const
+        {
+            static_assert(std::is_same<std::vector<unsigned char>, std::vector<uint8_t>>::value, "uint8_t is not unsigned char");
+            CheckResponseFormat(CURL_BODY_MSGPACK);
+            return JsonType::from_msgpack(this->_receiveBuffer);
+        }
+
+        template <typename JsonType>
+        inline void CurlEasyWrapper::PostJson(const JsonType& value, const char* prefix, const char* suffix)
+        {
+            std::string& postData(this->_options.postData);
+            const size_t capacityBefore = postData.capacity();
+            postData.assign(prefix);
+            CurlJsonWriter::Append(postData, value);
+            postData.append(suffix);
+            CommitPostData(capacityBefore);
+            if (('\0' == *prefix) && ('\0' == *suffix))
+            {
+                ContentType(CURL_BODY_JSON);
+            }
+            else
+            {
+                RemoveBodyFormatContentType();
+            }
+        }
+
+        template <typename JsonType>
+        inline void CurlEasyWrapper::PostCbor(const JsonType& value)
+        {
+            std::string& postData(this->_options.postData);
+            const size_t capacityBefore = postData.capacity();
+            postData.clear();
+            CurlBinaryWriter::AppendCbor(postData, value);
+            CommitPostData(capacityBefore);
+            ContentType(CURL_BODY_CBOR);
+        }
+
+        template <typename JsonType>
+        inline void CurlEasyWrapper::PostMsgPack(const JsonType& value)
+        {
+            std::string& postData(this->_options.postData);
+            const size_t capacityBefore = postData.capacity();
+            postData.clear();
+            CurlBinaryWriter::AppendMsgPack(postData, value);
+            CommitPostData(capacityBefore);
+            ContentType(CURL_BODY_MSGPACK);
+        }
+
+        inline void CurlEasyWrapper::AssignCounted(std::string& target, const std::string& value, CurlAllocationSource source)
+        {
+            size_t capacityBefore = target.capacity();
+            target = value;
+            if (target.capacity() != capacityBefore)
+            {
+                CurlGlobal::RecordAllocation(source, target.capacity() + 1u);
+            }
+        }
+
+        template <CURLoption Option>
+        inline void CurlEasyWrapper::Set(typename CurlOptionTraits<Option>::value_type value)
+        {
+            static_assert(!CurlOptionTraits<Option>::borrowsString, "cURL does not copy the value of this option");
+            static_assert(!CurlOptionTraits<Option>::tracked, "the wrapper tracks this option; use its method instead");
+            SetBorrowed<Option>(value);
+        }
+
+        template <CURLoption Option>
+        inline CurlResult CurlEasyWrapper::TrySet(typename CurlOptionTraits<Option>::value_type value)
+        {
+            static_assert(!CurlOptionTraits<Option>::borrowsString, "cURL does not copy the value of this option");
+            static_assert(!CurlOptionTraits<Option>::tracked, "the wrapper tracks this option; use its method instead");
+            return CurlResult(curl_easy_setopt(this->_curlHandle, Option, value), "CurlEasyWrapper::TrySet()", nullptr);
+        }
+
+        template <CURLoption Option>
+        inline void CurlEasyWrapper::SetTracked(typename CurlOptionTraits<Option>::value_type value)
+        {
+            static_assert(!CurlOptionTraits<Option>::borrowsString, "cURL does not copy the value of this option");
+            SetBorrowed<Option>(value);
+        }
+
+        template <CURLoption Option>
+        inline void CurlEasyWrapper::SetBorrowed(typename CurlOptionTraits<Option>::value_type value)
+        {
+            CURLcode curlRes = curl_easy_setopt(this->_curlHandle, Option, value);
+            if (curlRes != CURLE_OK)
+            {
+                ThrowOptionError(Option, curlRes);
+            }
+        }
+
+        inline CurlOptionState CurlEasyWrapper::Snapshot() const
+        {
+            return this->_options;
+        }
+
         inline void CurlEasyWrapper::Url(const std::string& url)
         {
-            this->_url = url;
-            SetOpt(CURLOPT_URL, this->_url);
+            if (url != this->_options.url)
+            {
+                SetTracked<CURLOPT_URL>(url.c_str());
+                AssignCounted(this->_options.url, url, CURL_ALLOC_OPTION_STRINGS);
+            }
         }
 
         inline void CurlEasyWrapper::UserAgent(const std::string& agent)
         {
-            this->_agent = agent;
-            SetOpt(CURLOPT_USERAGENT, this->_agent);
+            if (agent != this->_options.userAgent)
+            {
+                SetTracked<CURLOPT_USERAGENT>(agent.c_str());
+                AssignCounted(this->_options.userAgent, agent, CURL_ALLOC_OPTION_STRINGS);
+            }
         }
 
         inline void CurlEasyWrapper::Upload(bool upload)
         {
-            SetOpt(CURLOPT_UPLOAD, upload);
+            SetTracked<CURLOPT_UPLOAD>(upload ? 1l : 0l);
+            RecordMethodChange(CURLOPT_UPLOAD, upload ? 1l : 0l);
+        }
+
+        inline void CurlEasyWrapper::SetTimeoutMilliseconds(long timeoutMilliseconds)
+        {
+            if (timeoutMilliseconds != this->_options.timeoutMilliseconds)
+            {
+                SetTracked<CURLOPT_TIMEOUT_MS>(timeoutMilliseconds);
+                this->_options.timeoutMilliseconds = timeoutMilliseconds;
+            }
         }
 
         inline void CurlEasyWrapper::TimeoutSeconds(long timeoutSeconds)
         {
-            SetOpt(CURLOPT_TIMEOUT, timeoutSeconds);
+            SetTimeoutMilliseconds(timeoutSeconds * 1000l);
         }
 
         inline void CurlEasyWrapper::TimeoutMSeconds(long timeoutMilliseconds)
         {
-            SetOpt(CURLOPT_TIMEOUT_MS, timeoutMilliseconds);
+            SetTimeoutMilliseconds(timeoutMilliseconds);
         }
 
         inline void CurlEasyWrapper::FailOnHttpErrors(bool failOnErrors)
         {
-            SetOpt(CURLOPT_FAILONERROR, failOnErrors ? 1l : 0l);
+            if (failOnErrors != this->_options.failOnErrors)
+            {
+                SetTracked<CURLOPT_FAILONERROR>(failOnErrors ? 1l : 0l);
+                this->_options.failOnErrors = failOnErrors;
+            }
         }
 
         inline void CurlEasyWrapper::Verbose(bool verboseMode)
         {
-            SetOpt(CURLOPT_VERBOSE, verboseMode ? 1l : 0l);
+            if (verboseMode != this->_options.verbose)
+            {
+                SetTracked<CURLOPT_VERBOSE>(verboseMode ? 1l : 0l);
+                this->_options.verbose = verboseMode;
+            }
         }
 
         inline void CurlEasyWrapper::ResetHttpHeader()
         {
-            SetOpt(CURLOPT_HTTPHEADER, nullptr);
+            if (this->_options.headers || this->_options.headerList)
+            {
+                SetTracked<CURLOPT_HTTPHEADER>(nullptr);
+                this->_options.headers.reset();
+                this->_options.headerList.reset();
+            }
         }
 
         AEF_BOOL_METHOD_DEF(Post, CURLOPT_POST)
@@ -341,6 +954,11 @@ namespace AbcdEFramework
                  */
                 CurlSList& operator+=(const std::string& listEntry);
 
+                /**
+                 * @brief Test whether two lists hold the same entries in the same order.
+                 */
+                bool operator==(const CurlSList& rhs) const;
+
             public:
                 /**
                  * @brief Append another item to the list.
@@ -348,6 +966,12 @@ namespace AbcdEFramework
                  void Append(const std::string& listEntry);
 
             private:
+                /**
+                 * @brief Call \c curl_slist_append() and count the allocations it made.
+                 * @return The new head of the list, or \c nullptr if the entry could not be added.
+                 */
+                static curl_slist* AppendEntry(curl_slist* list, const std::string& listEntry);
+
                 /**
                  * @brief Copy constructor is deleted
                  */
@@ -2,8 +2,10 @@
  * @file
  * @brief Definition of CurlException methods.
  * @date 2017-01-07 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] Added the constructor that does not allocate and the lazy what().
  */
 
+#include <cstring>
 #include <ios>
 #include <string>
 #include <sstream>
@@ -19,20 +21,59 @@ namespace AbcdEFramework
 
         CurlException::CurlException(const string& what_arg)
             :   runtime_error(what_arg),
-                _errorCode((CURLcode)-1)
+                _errorCode((CURLcode)-1),
+                _methodName(nullptr)
         {
+            this->_detail[0] = '\0';
         }
 
         CurlException::CurlException(const char* what_arg)
             :   runtime_error(what_arg),
-                _errorCode((CURLcode)-1)
+                _errorCode((CURLcode)-1),
+                _methodName(nullptr)
         {
+            this->_detail[0] = '\0';
         }
 
         CurlException::CurlException(const string& what_arg, CURLcode errorCode, const string& message)
             :   runtime_error(FormatErrorMessage(what_arg, errorCode, message)),
-                _errorCode(errorCode)
+                _errorCode(errorCode),
+                _methodName(nullptr)
         {
+            this->_detail[0] = '\0';
+        }
+
+        CurlException::CurlException(const char* methodName, CURLcode errorCode, const char* detail)
+            :   runtime_error(""),
+                _errorCode(errorCode),
+                _methodName(methodName)
+        {
+            // An empty runtime_error message does not allocate; the real text is built by what().
+            ::strncpy(this->_detail, (detail != nullptr) ? detail : "", sizeof(this->_detail) - 1u);
+            this->_detail[sizeof(this->_detail) - 1u] = '\0';
+        }
+
+        const char* CurlException::what() const noexcept
+        {
+            if (nullptr == this->_methodName)
+            {
+                return runtime_error::what();
+            }
+
+            if (this->_whatText.empty())
+            {
+                try
+                {
+                    this->_whatText = FormatErrorMessage(this->_methodName, this->_errorCode, this->_detail);
+                }
+                catch (...)
+                {
+                    // Out of memory; the method name is better than nothing.
+                    return this->_methodName;
+                }
+            }
+
+            return this->_whatText.c_str();
         }
 
         string CurlException::FormatErrorMessage(const string& what_arg, CURLcode errorCode, const string& message)
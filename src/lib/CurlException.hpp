@@ -2,21 +2,40 @@
  * @file
  * @brief Declaration of the CurlException class.
  * @date 2017-01-07 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] Added the AEF_COLD_PATH macro.
+ * @date 2026-10-19 [JFDR] The message of an exception with an error code is built on the first call to what().
  */
 #if !defined CURL_EXCEPTION_67AC882F4E9645AC891475F9D4467B68
 #define CURL_EXCEPTION_67AC882F4E9645AC891475F9D4467B68 1
 
 #include <stdexcept>
+#include <string>
 #include <curl/curl.h>
 
+// Marks a function that is only called when something went wrong, so that it is kept out of the hot path.
+#if defined __GNUC__
+    #define AEF_COLD_PATH __attribute__((cold, noinline))
+#else
+    #define AEF_COLD_PATH
+#endif
+
 namespace AbcdEFramework
 {
     namespace Web
     {
+        /**
+         * @brief Exception thrown when a cURL call fails.
+         * @remark The constructor that takes a method name, an error code and a detail string does not allocate:
+         *      it keeps the method name pointer and copies the detail into a fixed size buffer. The text returned by
+         *      \c what() is built on its first call.
+         */
         class CurlException : public std::runtime_error
         {
             private:
                 CURLcode _errorCode; ///< The error code that was passed to the constructor.
+                const char* _methodName; ///< Method name if the message is built lazily, otherwise \c nullptr.
+                char _detail[CURL_ERROR_SIZE]; ///< Copy of the error text that cURL returned.
+                mutable std::string _whatText; ///< Text returned by \c what(), built on its first call.
 
             public:
                 /**
@@ -39,6 +58,23 @@ namespace AbcdEFramework
                  */
                 explicit CurlException(const std::string& what_arg, CURLcode errorCode, const std::string& message);
 
+                /**
+                 * @brief Construct an object without allocating memory.
+                 * @param methodName Name of the method that failed. Must have static storage, e.g. a string literal
+                 *      or \c __PRETTY_FUNCTION__.
+                 * @param errorCode Error code that was returned.
+                 * @param detail Error message that was returned by cURL. Copied, and truncated to
+                 *      \c CURL_ERROR_SIZE - 1 characters.
+                 */
+                CurlException(const char* methodName, CURLcode errorCode, const char* detail);
+
+            public:
+                /**
+                 * @brief Get the description of the error.
+                 * @remark Not safe to call for the first time from two threads at once.
+                 */
+                const char* what() const noexcept override;
+
             public:
                 /**
                  * @brief Get the error code that was passed to the constructor.
@@ -47,6 +83,12 @@ namespace AbcdEFramework
                  */
                 inline CURLcode GetErrorCode() const;
 
+                /**
+                 * @brief Get the error text that cURL returned.
+                 * @return The text, or an empty string if the exception was not constructed from a method name.
+                 */
+                inline const char* GetDetail() const;
+
             private:
                 /**
                  * @brief Create an error message from the individual parameters passed to the constructor.
@@ -61,6 +103,11 @@ namespace AbcdEFramework
         {
             return this->_errorCode;
         }
+
+        inline const char* CurlException::GetDetail() const
+        {
+            return this->_detail;
+        }
     } // namespace Web
 } // namespace AbcdEFramework
 #endif // CURL_EXCEPTION_67AC882F4E9645AC891475F9D4467B68
@@ -0,0 +1,29 @@
+/**
+ * @file
+ * @brief Declaration of the flat_json type: a nlohmann::basic_json that stores objects in a CurlFlatMap.
+ * @date 2026-10-19 [JFDR] Created.
+ */
+#if !defined CURL_FLAT_JSON_A63E0D5B18F94C72B2D7E4091C6F5A3D
+#define CURL_FLAT_JSON_A63E0D5B18F94C72B2D7E4091C6F5A3D 1
+
+#include <json.hpp>
+#include "CurlFlatMap.hpp"
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        /**
+         * @brief JSON value whose objects are \c CurlFlatMap vectors with a hash index instead of \c std::map trees.
+         * @remark A member lookup such as <tt>js["errorMessage"]</tt> probes one contiguous table instead of
+         *      walking tree nodes, and an object costs at most two allocations instead of one per member. Members
+         *      keep the order in which they were parsed or added, so \c dump() writes them in that order rather
+         *      than sorted as \c nlohmann::json does; comparing two values ignores the order. Erasing a member is
+         *      linear in the size of the object, and iterators into an object are invalidated by inserting or
+         *      erasing members.
+         */
+        typedef nlohmann::basic_json<CurlFlatMap> flat_json;
+    } // namespace Web
+} // namespace AbcdEFramework
+
+#endif // CURL_FLAT_JSON_A63E0D5B18F94C72B2D7E4091C6F5A3D
@@ -0,0 +1,739 @@
+/**
+ * @file
+ * @brief Declaration of the CurlFlatMap class template.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] Append() keeps the index that reserve() built for a small map complete.
+ */
+#if !defined CURL_FLAT_MAP_2F8B6D13C9E04A57B1D0E7C4A5F39268
+#define CURL_FLAT_MAP_2F8B6D13C9E04A57B1D0E7C4A5F39268 1
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        /**
+         * @brief Associative container with the interface of \c std::map that keeps its entries in one vector,
+         *      indexed by an open-addressing hash table.
+         * @remark The entries are stored contiguously in the order in which they were inserted. Maps of up to
+         *      \c LinearSearchLimit entries are searched linearly and have no index at all; larger maps find a key
+         *      by probing a table of entry numbers and hashes, which is also a single contiguous array. Compared
+         *      with the node per entry of \c std::map, an object costs two allocations instead of one per member,
+         *      and a lookup touches a few cache lines instead of a chain of tree nodes.
+         *
+         *      Differences from \c std::map:
+         *      - Iteration follows the order of insertion, not the order of the keys. \c Compare is only used by
+         *        the relational operators, which order two maps as \c std::map would.
+         *      - Inserting or erasing invalidates iterators and references. Erasing moves the entries after the
+         *        erased ones and rebuilds the index, so it is linear in the size of the map.
+         *      - \c value_type is <tt>std::pair<Key, T></tt> rather than <tt>std::pair<const Key, T></tt>, so that
+         *        the entries can be moved; do not change the key of an entry through an iterator.
+         */
+        template <typename Key, typename T, typename Compare = std::less<Key>,
+            typename Allocator = std::allocator<std::pair<const Key, T>>>
+        class CurlFlatMap
+        {
+            public:
+                typedef Key key_type;
+                typedef T mapped_type;
+                typedef std::pair<Key, T> value_type;
+                typedef Compare key_compare;
+                typedef typename std::allocator_traits<Allocator>::template rebind_alloc<value_type> allocator_type;
+
+                static const size_t LinearSearchLimit = 8u; ///< Maps up to this size have no index.
+
+            private:
+                typedef std::vector<value_type, allocator_type> Storage;
+
+                /**
+                 * @brief Slot of the index.
+                 */
+                struct Slot
+                {
+                    uint32_t entry; ///< Number of the entry plus one, or zero if the slot is free.
+                    uint32_t hash; ///< Low bits of the hash of the key, compared before the key itself.
+                };
+
+                typedef std::vector<Slot, typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>> Index;
+
+            public:
+                typedef typename Storage::size_type size_type;
+                typedef typename Storage::difference_type difference_type;
+                typedef value_type& reference;
+                typedef const value_type& const_reference;
+                typedef typename Storage::iterator iterator;
+                typedef typename Storage::const_iterator const_iterator;
+                typedef typename Storage::reverse_iterator reverse_iterator;
+                typedef typename Storage::const_reverse_iterator const_reverse_iterator;
+
+            private:
+                Storage _entries; ///< The entries, in the order of insertion.
+                Index _index; ///< Open-addressing table over \c _entries; empty while the map is small.
+                Compare _compare; ///< Orders the keys for the relational operators.
+
+            public:
+                /**
+                 * @brief Construct an empty map.
+                 */
+                CurlFlatMap();
+
+                /**
+                 * @brief Construct an empty map with the given comparison and allocator.
+                 */
+                explicit CurlFlatMap(const Compare& compare, const Allocator& allocator = Allocator());
+
+                /**
+                 * @brief Construct a map from a range of entries. The first of duplicate keys is kept.
+                 */
+                template <typename InputIterator>
+                CurlFlatMap(InputIterator first, InputIterator last);
+
+                /**
+                 * @brief Construct a map from a list of entries. The first of duplicate keys is kept.
+                 */
+                CurlFlatMap(std::initializer_list<value_type> entries);
+
+            public:
+                inline iterator begin() noexcept;
+                inline const_iterator begin() const noexcept;
+                inline const_iterator cbegin() const noexcept;
+                inline iterator end() noexcept;
+                inline const_iterator end() const noexcept;
+                inline const_iterator cend() const noexcept;
+                inline reverse_iterator rbegin() noexcept;
+                inline const_reverse_iterator rbegin() const noexcept;
+                inline reverse_iterator rend() noexcept;
+                inline const_reverse_iterator rend() const noexcept;
+
+                inline bool empty() const noexcept;
+                inline size_type size() const noexcept;
+                inline size_type max_size() const noexcept;
+
+                /**
+                 * @brief Reserve room for \c count entries.
+                 */
+                void reserve(size_type count);
+
+                /**
+                 * @brief Get the value of a key, inserting a default constructed value if the key is missing.
+                 */
+                T& operator[](const key_type& key);
+
+                /**
+                 * @brief Get the value of a key, inserting a default constructed value if the key is missing.
+                 */
+                T& operator[](key_type&& key);
+
+                /**
+                 * @brief Get the value of a key. Throws \c std::out_of_range if the key is missing.
+                 */
+                T& at(const key_type& key);
+
+                /**
+                 * @brief Get the value of a key. Throws \c std::out_of_range if the key is missing.
+                 */
+                const T& at(const key_type& key) const;
+
+                /**
+                 * @brief Find the entry of a key.
+                 * @return The entry, or \c end() if the key is missing.
+                 */
+                inline iterator find(const key_type& key);
+
+                /**
+                 * @brief Find the entry of a key.
+                 * @return The entry, or \c end() if the key is missing.
+                 */
+                inline const_iterator find(const key_type& key) const;
+
+                /**
+                 * @brief Get the number of entries with the key, zero or one.
+                 */
+                inline size_type count(const key_type& key) const;
+
+                /**
+                 * @brief Insert an entry if its key is missing.
+                 * @return The entry with the key, and \c true if it was inserted.
+                 */
+                std::pair<iterator, bool> insert(const value_type& entry);
+
+                /**
+                 * @brief Insert an entry if its key is missing.
+                 * @return The entry with the key, and \c true if it was inserted.
+                 */
+                std::pair<iterator, bool> insert(value_type&& entry);
+
+                /**
+                 * @brief Insert a range of entries whose keys are missing.
+                 */
+                template <typename InputIterator>
+                void insert(InputIterator first, InputIterator last);
+
+                /**
+                 * @brief Construct an entry and insert it if its key is missing.
+                 * @return The entry with the key, and \c true if it was inserted.
+                 */
+                template <typename... Args>
+                std::pair<iterator, bool> emplace(Args&&... args);
+
+                /**
+                 * @brief Remove an entry.
+                 * @return The entry after the removed one.
+                 */
+                iterator erase(const_iterator position);
+
+                /**
+                 * @brief Remove a range of entries.
+                 * @return The entry after the removed ones.
+                 */
+                iterator erase(const_iterator first, const_iterator last);
+
+                /**
+                 * @brief Remove the entry of a key.
+                 * @return The number of entries that were removed, zero or one.
+                 */
+                size_type erase(const key_type& key);
+
+                /**
+                 * @brief Remove all entries.
+                 */
+                inline void clear() noexcept;
+
+                /**
+                 * @brief Exchange the entries with another map.
+                 */
+                inline void swap(CurlFlatMap& other);
+
+                /**
+                 * @brief Get the comparison that orders the keys.
+                 */
+                inline key_compare key_comp() const;
+
+            public:
+                /**
+                 * @brief Test whether both maps hold the same entries, in any order.
+                 */
+                bool operator==(const CurlFlatMap& rhs) const;
+
+                /**
+                 * @brief Test whether the maps hold different entries.
+                 */
+                inline bool operator!=(const CurlFlatMap& rhs) const;
+
+                /**
+                 * @brief Compare the entries in the order of their keys, as \c std::map does.
+                 */
+                bool operator<(const CurlFlatMap& rhs) const;
+
+                inline bool operator<=(const CurlFlatMap& rhs) const;
+                inline bool operator>(const CurlFlatMap& rhs) const;
+                inline bool operator>=(const CurlFlatMap& rhs) const;
+
+            private:
+                /**
+                 * @brief Get the hash of a key.
+                 */
+                static inline uint32_t Hash(const key_type& key);
+
+                /**
+                 * @brief Find the number of the entry with the key.
+                 * @return The number of the entry, or \c size() if the key is missing.
+                 */
+                size_type Locate(const key_type& key) const;
+
+                /**
+                 * @brief Append an entry whose key is known to be missing and add it to the index.
+                 */
+                template <typename Entry>
+                iterator Append(Entry&& entry);
+
+                /**
+                 * @brief Add the entry with the given number to the index.
+                 */
+                inline void AddToIndex(size_type entry, uint32_t hash);
+
+                /**
+                 * @brief Rebuild the index for the current entries, or drop it if the map is small.
+                 * @param minimumEntries The index is made large enough for this many entries.
+                 */
+                void RebuildIndex(size_type minimumEntries);
+
+                /**
+                 * @brief Get the entries ordered on their keys.
+                 */
+                std::vector<const value_type*> Sorted() const;
+        };
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        CurlFlatMap<Key, T, Compare, Allocator>::CurlFlatMap()
+        {
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        CurlFlatMap<Key, T, Compare, Allocator>::CurlFlatMap(const Compare& compare, const Allocator& allocator)
+            :   _entries(allocator_type(allocator)),
+                _compare(compare)
+        {
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        template <typename InputIterator>
+        CurlFlatMap<Key, T, Compare, Allocator>::CurlFlatMap(InputIterator first, InputIterator last)
+        {
+            insert(first, last);
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        CurlFlatMap<Key, T, Compare, Allocator>::CurlFlatMap(std::initializer_list<value_type> entries)
+        {
+            insert(entries.begin(), entries.end());
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        inline typename CurlFlatMap<Key, T, Compare, Allocator>::iterator CurlFlatMap<Key, T, Compare, Allocator>::begin() noexcept
+        {
+            return this->_entries.begin();
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        inline typename CurlFlatMap<Key, T, Compare, Allocator>::const_iterator CurlFlatMap<Key, T, Compare, Allocator>::begin() const noexcept
+        {
+            return this->_entries.begin();
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        inline typename CurlFlatMap<Key, T, Compare, Allocator>::const_iterator CurlFlatMap<Key, T, Compare, Allocator>::cbegin() const noexcept
+        {
+            return this->_entries.cbegin();
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        inline typename CurlFlatMap<Key, T, Compare, Allocator>::iterator CurlFlatMap<Key, T, Compare, Allocator>::end() noexcept
+        {
+            return this->_entries.end();
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        inline typename CurlFlatMap<Key, T, Compare, Allocator>::const_iterator CurlFlatMap<Key, T, Compare, Allocator>::end() const noexcept
+        {
+            return this->_entries.end();
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        inline typename CurlFlatMap<Key, T, Compare, Allocator>::const_iterator CurlFlatMap<Key, T, Compare, Allocator>::cend() const noexcept
+        {
+            return this->_entries.cend();
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        inline typename CurlFlatMap<Key, T, Compare, Allocator>::reverse_iterator CurlFlatMap<Key, T, Compare, Allocator>::rbegin() noexcept
+        {
+            return this->_entries.rbegin();
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        inline typename CurlFlatMap<Key, T, Compare, Allocator>::const_reverse_iterator CurlFlatMap<Key, T, Compare, Allocator>::rbegin() const noexcept
+        {
+            return this->_entries.rbegin();
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        inline typename CurlFlatMap<Key, T, Compare, Allocator>::reverse_iterator CurlFlatMap<Key, T, Compare, Allocator>::rend() noexcept
+        {
+            return this->_entries.rend();
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        inline typename CurlFlatMap<Key, T, Compare, Allocator>::const_reverse_iterator CurlFlatMap<Key, T, Compare, Allocator>::rend() const noexcept
+        {
+            return this->_entries.rend();
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        inline bool CurlFlatMap<Key, T, Compare, Allocator>::empty() const noexcept
+        {
+            return this->_entries.empty();
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        inline typename CurlFlatMap<Key, T, Compare, Allocator>::size_type CurlFlatMap<Key, T, Compare, Allocator>::size() const noexcept
+        {
+            return this->_entries.size();
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        inline typename CurlFlatMap<Key, T, Compare, Allocator>::size_type CurlFlatMap<Key, T, Compare, Allocator>::max_size() const noexcept
+        {
+            return std::min(this->_entries.max_size(), (size_type)UINT32_MAX - 1u);
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        void CurlFlatMap<Key, T, Compare, Allocator>::reserve(size_type count)
+        {
+            this->_entries.reserve(count);
+            if (count > LinearSearchLimit)
+            {
+                RebuildIndex(count);
+            }
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        T& CurlFlatMap<Key, T, Compare, Allocator>::operator[](const key_type& key)
+        {
+            size_type entry = Locate(key);
+            if (entry < this->_entries.size())
+            {
+                return this->_entries[entry].second;
+            }
+            return Append(value_type(key, T()))->second;
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        T& CurlFlatMap<Key, T, Compare, Allocator>::operator[](key_type&& key)
+        {
+            size_type entry = Locate(key);
+            if (entry < this->_entries.size())
+            {
+                return this->_entries[entry].second;
+            }
+            return Append(value_type(std::move(key), T()))->second;
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        T& CurlFlatMap<Key, T, Compare, Allocator>::at(const key_type& key)
+        {
+            size_type entry = Locate(key);
+            if (entry >= this->_entries.size())
+            {
+                throw std::out_of_range("CurlFlatMap::at()");
+            }
+            return this->_entries[entry].second;
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        const T& CurlFlatMap<Key, T, Compare, Allocator>::at(const key_type& key) const
+        {
+            size_type entry = Locate(key);
+            if (entry >= this->_entries.size())
+            {
+                throw std::out_of_range("CurlFlatMap::at()");
+            }
+            return this->_entries[entry].second;
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        inline typename CurlFlatMap<Key, T, Compare, Allocator>::iterator CurlFlatMap<Key, T, Compare, Allocator>::find(const key_type& key)
+        {
+            return this->_entries.begin() + Locate(key);
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        inline typename CurlFlatMap<Key, T, Compare, Allocator>::const_iterator CurlFlatMap<Key, T, Compare, Allocator>::find(const key_type& key) const
+        {
+            return this->_entries.begin() + Locate(key);
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        inline typename CurlFlatMap<Key, T, Compare, Allocator>::size_type CurlFlatMap<Key, T, Compare, Allocator>::count(const key_type& key) const
+        {
+            return (Locate(key) < this->_entries.size()) ? 1u : 0u;
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        std::pair<typename CurlFlatMap<Key, T, Compare, Allocator>::iterator, bool> CurlFlatMap<Key, T, Compare, Allocator>::insert(const value_type& entry)
+        {
+            size_type existing = Locate(entry.first);
+            if (existing < this->_entries.size())
+            {
+                return std::make_pair(this->_entries.begin() + existing, false);
+            }
+            return std::make_pair(Append(entry), true);
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        std::pair<typename CurlFlatMap<Key, T, Compare, Allocator>::iterator, bool> CurlFlatMap<Key, T, Compare, Allocator>::insert(value_type&& entry)
+        {
+            size_type existing = Locate(entry.first);
+            if (existing < this->_entries.size())
+            {
+                return std::make_pair(this->_entries.begin() + existing, false);
+            }
+            return std::make_pair(Append(std::move(entry)), true);
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        template <typename InputIterator>
+        void CurlFlatMap<Key, T, Compare, Allocator>::insert(InputIterator first, InputIterator last)
+        {
+            for (; first != last; ++first)
+            {
+                insert(value_type(first->first, first->second));
+            }
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        template <typename... Args>
+        std::pair<typename CurlFlatMap<Key, T, Compare, Allocator>::iterator, bool> CurlFlatMap<Key, T, Compare, Allocator>::emplace(Args&&... args)
+        {
+            return insert(value_type(std::forward<Args>(args)...));
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        typename CurlFlatMap<Key, T, Compare, Allocator>::iterator CurlFlatMap<Key, T, Compare, Allocator>::erase(const_iterator position)
+        {
+            return erase(position, position + 1);
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        typename CurlFlatMap<Key, T, Compare, Allocator>::iterator CurlFlatMap<Key, T, Compare, Allocator>::erase(const_iterator first, const_iterator last)
+        {
+            // The entries after the erased ones move down, so all of their numbers in the index change.
+            difference_type offset = first - this->_entries.cbegin();
+            this->_entries.erase(first, last);
+            RebuildIndex(this->_entries.size());
+            return this->_entries.begin() + offset;
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        typename CurlFlatMap<Key, T, Compare, Allocator>::size_type CurlFlatMap<Key, T, Compare, Allocator>::erase(const key_type& key)
+        {
+            size_type entry = Locate(key);
+            if (entry >= this->_entries.size())
+            {
+                return 0u;
+            }
+            erase(this->_entries.cbegin() + entry);
+            return 1u;
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        inline void CurlFlatMap<Key, T, Compare, Allocator>::clear() noexcept
+        {
+            this->_entries.clear();
+            this->_index.clear();
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        inline void CurlFlatMap<Key, T, Compare, Allocator>::swap(CurlFlatMap& other)
+        {
+            this->_entries.swap(other._entries);
+            this->_index.swap(other._index);
+            std::swap(this->_compare, other._compare);
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        inline typename CurlFlatMap<Key, T, Compare, Allocator>::key_compare CurlFlatMap<Key, T, Compare, Allocator>::key_comp() const
+        {
+            return this->_compare;
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        bool CurlFlatMap<Key, T, Compare, Allocator>::operator==(const CurlFlatMap& rhs) const
+        {
+            if (this->_entries.size() != rhs._entries.size())
+            {
+                return false;
+            }
+
+            for (const value_type& entry : this->_entries)
+            {
+                size_type other = rhs.Locate(entry.first);
+                if ((other >= rhs._entries.size()) || !(entry.second == rhs._entries[other].second))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        inline bool CurlFlatMap<Key, T, Compare, Allocator>::operator!=(const CurlFlatMap& rhs) const
+        {
+            return !(*this == rhs);
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        bool CurlFlatMap<Key, T, Compare, Allocator>::operator<(const CurlFlatMap& rhs) const
+        {
+            std::vector<const value_type*> left(Sorted());
+            std::vector<const value_type*> right(rhs.Sorted());
+            const Compare& compare(this->_compare);
+            return std::lexicographical_compare
+            (
+                left.begin(),
+                left.end(),
+                right.begin(),
+                right.end(),
+                [&compare](const value_type* lhs, const value_type* rhs)
+                {
+                    if (compare(lhs->first, rhs->first))
+                    {
+                        return true;
+                    }
+                    return !compare(rhs->first, lhs->first) && (lhs->second < rhs->second);
+                }
+            );
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        inline bool CurlFlatMap<Key, T, Compare, Allocator>::operator<=(const CurlFlatMap& rhs) const
+        {
+            return !(rhs < *this);
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        inline bool CurlFlatMap<Key, T, Compare, Allocator>::operator>(const CurlFlatMap& rhs) const
+        {
+            return rhs < *this;
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        inline bool CurlFlatMap<Key, T, Compare, Allocator>::operator>=(const CurlFlatMap& rhs) const
+        {
+            return !(*this < rhs);
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        inline uint32_t CurlFlatMap<Key, T, Compare, Allocator>::Hash(const key_type& key)
+        {
+            return (uint32_t)std::hash<Key>()(key);
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        typename CurlFlatMap<Key, T, Compare, Allocator>::size_type CurlFlatMap<Key, T, Compare, Allocator>::Locate(const key_type& key) const
+        {
+            const size_type count = this->_entries.size();
+            if (this->_index.empty())
+            {
+                for (size_type entry = 0u; entry < count; ++entry)
+                {
+                    if (this->_entries[entry].first == key)
+                    {
+                        return entry;
+                    }
+                }
+                return count;
+            }
+
+            // Linear probing; the table is at most half full, so a free slot ends every search.
+            const uint32_t hash = Hash(key);
+            const size_type mask = this->_index.size() - 1u;
+            for (size_type slot = hash & mask; ; slot = (slot + 1u) & mask)
+            {
+                const Slot& candidate(this->_index[slot]);
+                if (0u == candidate.entry)
+                {
+                    return count;
+                }
+                if ((candidate.hash == hash) && (this->_entries[candidate.entry - 1u].first == key))
+                {
+                    return candidate.entry - 1u;
+                }
+            }
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        template <typename Entry>
+        typename CurlFlatMap<Key, T, Compare, Allocator>::iterator CurlFlatMap<Key, T, Compare, Allocator>::Append(Entry&& entry)
+        {
+            if (this->_entries.size() >= max_size())
+            {
+                throw std::length_error("CurlFlatMap is full");
+            }
+
+            this->_entries.push_back(std::forward<Entry>(entry));
+            const size_type count = this->_entries.size();
+
+            // reserve() may have built the index before the map outgrew the linear search; keep it complete.
+            if (!this->_index.empty() || (count > LinearSearchLimit))
+            {
+                if (this->_index.size() < 2u * count)
+                {
+                    RebuildIndex(count);
+                }
+                else
+                {
+                    AddToIndex(count - 1u, Hash(this->_entries.back().first));
+                }
+            }
+            return this->_entries.end() - 1;
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        inline void CurlFlatMap<Key, T, Compare, Allocator>::AddToIndex(size_type entry, uint32_t hash)
+        {
+            const size_type mask = this->_index.size() - 1u;
+            size_type slot = hash & mask;
+            while (this->_index[slot].entry != 0u)
+            {
+                slot = (slot + 1u) & mask;
+            }
+            this->_index[slot].entry = (uint32_t)(entry + 1u);
+            this->_index[slot].hash = hash;
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        void CurlFlatMap<Key, T, Compare, Allocator>::RebuildIndex(size_type minimumEntries)
+        {
+            const size_type count = this->_entries.size();
+            if (count <= LinearSearchLimit)
+            {
+                if (minimumEntries <= LinearSearchLimit)
+                {
+                    Index().swap(this->_index);
+                    return;
+                }
+            }
+
+            // A power of two of at least twice the entries, so that the table is never more than half full.
+            size_type slots = 16u;
+            while (slots < 2u * std::max(count, minimumEntries))
+            {
+                slots *= 2u;
+            }
+
+            if (slots > this->_index.size())
+            {
+                this->_index.assign(slots, Slot());
+            }
+            else
+            {
+                std::fill(this->_index.begin(), this->_index.end(), Slot());
+            }
+            for (size_type entry = 0u; entry < count; ++entry)
+            {
+                AddToIndex(entry, Hash(this->_entries[entry].first));
+            }
+        }
+
+        template <typename Key, typename T, typename Compare, typename Allocator>
+        std::vector<const typename CurlFlatMap<Key, T, Compare, Allocator>::value_type*> CurlFlatMap<Key, T, Compare, Allocator>::Sorted() const
+        {
+            std::vector<const value_type*> sorted;
+            sorted.reserve(this->_entries.size());
+            for (const value_type& entry : this->_entries)
+            {
+                sorted.push_back(&entry);
+            }
+
+            const Compare& compare(this->_compare);
+            std::sort
+            (
+                sorted.begin(),
+                sorted.end(),
+                [&compare](const value_type* lhs, const value_type* rhs) { return compare(lhs->first, rhs->first); }
+            );
+            return sorted;
+        }
+    } // namespace Web
+} // namespace AbcdEFramework
+
+#endif // CURL_FLAT_MAP_2F8B6D13C9E04A57B1D0E7C4A5F39268
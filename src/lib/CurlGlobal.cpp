@@ -0,0 +1,183 @@
+/**
+ * @file
+ * @brief Definition of the CurlGlobal methods and the counting allocators.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] The wrapper totals include CURL_ALLOC_HEADER_LIST.
+ * @date 2026-10-19 [JFDR] The wrapper totals include CURL_ALLOC_RESPONSE_HEADERS.
+ * @date 2026-10-19 [JFDR] The wrapper totals include CURL_ALLOC_ARENA.
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include "CurlException.hpp"
+#include "CurlGlobal.hpp"
+
+#ifdef __GNUC__
+    #define AEF_METHOD_NAME __PRETTY_FUNCTION__
+#elif _MSC_VER
+    #define AEF_METHOD_NAME __FUNCSIG__
+#else
+    #error "C++ compiler signature not recognised."
+#endif
+
+namespace
+{
+    using AbcdEFramework::Web::CURL_ALLOC_LIBCURL;
+    using AbcdEFramework::Web::CurlGlobal;
+
+    /**
+     * @brief Size of the header that the counting allocators put in front of every block.
+     * @remark The header holds the size of the block and is large enough to keep the block aligned for any type.
+     */
+    const size_t AllocationHeaderSize = 16u;
+
+    /**
+     * @brief Write the size header and return the pointer that is handed to libcurl.
+     */
+    inline void* CompleteAllocation(void* blockPtr, size_t sizeBytes)
+    {
+        *reinterpret_cast<size_t*>(blockPtr) = sizeBytes;
+        CurlGlobal::RecordAllocation(CURL_ALLOC_LIBCURL, sizeBytes);
+        return reinterpret_cast<char*>(blockPtr) + AllocationHeaderSize;
+    }
+
+    /**
+     * @brief Get the start of the block from a pointer that was handed to libcurl.
+     */
+    inline void* BlockStart(void* ptr)
+    {
+        return reinterpret_cast<char*>(ptr) - AllocationHeaderSize;
+    }
+
+    void* CountingMalloc(size_t sizeBytes)
+    {
+        void* blockPtr = ::malloc(sizeBytes + AllocationHeaderSize);
+        return (blockPtr != nullptr) ? CompleteAllocation(blockPtr, sizeBytes) : nullptr;
+    }
+
+    void CountingFree(void* ptr)
+    {
+        if (ptr != nullptr)
+        {
+            ::free(BlockStart(ptr));
+        }
+    }
+
+    void* CountingRealloc(void* ptr, size_t sizeBytes)
+    {
+        if (nullptr == ptr)
+        {
+            return CountingMalloc(sizeBytes);
+        }
+
+        void* blockPtr = ::realloc(BlockStart(ptr), sizeBytes + AllocationHeaderSize);
+        return (blockPtr != nullptr) ? CompleteAllocation(blockPtr, sizeBytes) : nullptr;
+    }
+
+    char* CountingStrdup(const char* str)
+    {
+        size_t sizeBytes = ::strlen(str) + 1u;
+        void* ptr = CountingMalloc(sizeBytes);
+        if (ptr != nullptr)
+        {
+            ::memcpy(ptr, str, sizeBytes);
+        }
+        return reinterpret_cast<char*>(ptr);
+    }
+
+    void* CountingCalloc(size_t count, size_t sizeBytes)
+    {
+        if ((sizeBytes != 0u) && (count > ((size_t)-1 - AllocationHeaderSize) / sizeBytes))
+        {
+            return nullptr;
+        }
+
+        void* blockPtr = ::calloc(1u, (count * sizeBytes) + AllocationHeaderSize);
+        return (blockPtr != nullptr) ? CompleteAllocation(blockPtr, count * sizeBytes) : nullptr;
+    }
+}
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        std::atomic<uint64_t> CurlGlobal::_allocationCounts[CURL_ALLOC_SOURCE_COUNT];
+        std::atomic<uint64_t> CurlGlobal::_allocationBytes[CURL_ALLOC_SOURCE_COUNT];
+
+        CurlAllocationStats CurlAllocationStats::operator-(const CurlAllocationStats& rhs) const
+        {
+            CurlAllocationStats result;
+            for (int source = 0; source < CURL_ALLOC_SOURCE_COUNT; ++source)
+            {
+                result.allocations[source] = this->allocations[source] - rhs.allocations[source];
+                result.bytes[source] = this->bytes[source] - rhs.bytes[source];
+            }
+            return result;
+        }
+
+        uint64_t CurlAllocationStats::WrapperAllocations() const
+        {
+            return this->allocations[CURL_ALLOC_RECEIVE_BUFFER]
+                + this->allocations[CURL_ALLOC_POST_DATA]
+                + this->allocations[CURL_ALLOC_OPTION_STRINGS]
+                + this->allocations[CURL_ALLOC_SLIST]
+                + this->allocations[CURL_ALLOC_HEADER_LIST]
+                + this->allocations[CURL_ALLOC_RESPONSE_HEADERS]
+                + this->allocations[CURL_ALLOC_ARENA];
+        }
+
+        uint64_t CurlAllocationStats::WrapperBytes() const
+        {
+            return this->bytes[CURL_ALLOC_RECEIVE_BUFFER]
+                + this->bytes[CURL_ALLOC_POST_DATA]
+                + this->bytes[CURL_ALLOC_OPTION_STRINGS]
+                + this->bytes[CURL_ALLOC_SLIST]
+                + this->bytes[CURL_ALLOC_HEADER_LIST]
+                + this->bytes[CURL_ALLOC_RESPONSE_HEADERS]
+                + this->bytes[CURL_ALLOC_ARENA];
+        }
+
+        CurlGlobal::CurlGlobal(long flags, bool countLibcurlAllocations)
+        {
+            CURLcode curlRes;
+            if (countLibcurlAllocations)
+            {
+                curlRes = curl_global_init_mem
+                (
+                    flags,
+                    CountingMalloc,
+                    CountingFree,
+                    CountingRealloc,
+                    CountingStrdup,
+                    CountingCalloc
+                );
+            }
+            else
+            {
+                curlRes = curl_global_init(flags);
+            }
+
+            if (curlRes != CURLE_OK)
+            {
+                throw CurlException(AEF_METHOD_NAME, curlRes, curl_easy_strerror(curlRes));
+            }
+        }
+
+        CurlGlobal::~CurlGlobal()
+        {
+            curl_global_cleanup();
+        }
+
+        CurlAllocationStats CurlGlobal::GetAllocationStats()
+        {
+            CurlAllocationStats result;
+            for (int source = 0; source < CURL_ALLOC_SOURCE_COUNT; ++source)
+            {
+                result.allocations[source] = _allocationCounts[source].load(std::memory_order_relaxed);
+                result.bytes[source] = _allocationBytes[source].load(std::memory_order_relaxed);
+            }
+            return result;
+        }
+    } // namespace Web
+} // namespace AbcdEFramework
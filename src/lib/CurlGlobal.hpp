@@ -0,0 +1,115 @@
+/**
+ * @file
+ * @brief Declaration of the CurlGlobal class and the allocation accounting types.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] Added CURL_ALLOC_HEADER_LIST.
+ * @date 2026-10-19 [JFDR] Added CURL_ALLOC_RESPONSE_HEADERS.
+ * @date 2026-10-19 [JFDR] Added CURL_ALLOC_ARENA.
+ */
+#if !defined CURL_GLOBAL_DB8B4323BFC84F8CBCF71CA1C03BAAF8
+#define CURL_GLOBAL_DB8B4323BFC84F8CBCF71CA1C03BAAF8 1
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <curl/curl.h>
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        /**
+         * @brief Where a counted heap allocation was made.
+         */
+        enum CurlAllocationSource
+        {
+            CURL_ALLOC_LIBCURL = 0, ///< Memory that libcurl allocated. Only counted if \c CurlGlobal installed its allocators.
+            CURL_ALLOC_RECEIVE_BUFFER, ///< Growth of the receive buffer of a \c CurlEasyWrapper.
+            CURL_ALLOC_POST_DATA, ///< Growth of the copy of the POST data of a \c CurlEasyWrapper.
+            CURL_ALLOC_OPTION_STRINGS, ///< Growth of the cached URL and user agent of a \c CurlEasyWrapper.
+            CURL_ALLOC_SLIST, ///< Nodes appended to a \c CurlSList. These are also counted as \c CURL_ALLOC_LIBCURL.
+            CURL_ALLOC_HEADER_LIST, ///< Growth of the line buffer and nodes of a \c CurlHeaderList.
+            CURL_ALLOC_RESPONSE_HEADERS, ///< Growth of the response header buffer of a \c CurlEasyWrapper.
+            CURL_ALLOC_ARENA, ///< Blocks allocated by a \c CurlArena.
+            CURL_ALLOC_SOURCE_COUNT ///< Number of allocation sources.
+        };
+
+        /**
+         * @brief Snapshot of the allocation counters.
+         * @remark Take a snapshot before and after a transfer and subtract them to get the allocations of that
+         *      transfer. The counters are process wide, so transfers on other threads are included.
+         */
+        struct CurlAllocationStats
+        {
+            uint64_t allocations[CURL_ALLOC_SOURCE_COUNT]; ///< Number of allocations per source.
+            uint64_t bytes[CURL_ALLOC_SOURCE_COUNT]; ///< Number of bytes allocated per source.
+
+            /**
+             * @brief Get the difference between two snapshots.
+             */
+            CurlAllocationStats operator-(const CurlAllocationStats& rhs) const;
+
+            /**
+             * @brief Get the number of allocations that the wrapper made in its own buffers.
+             */
+            uint64_t WrapperAllocations() const;
+
+            /**
+             * @brief Get the number of bytes that the wrapper allocated for its own buffers.
+             */
+            uint64_t WrapperBytes() const;
+        };
+
+        /**
+         * @brief Calls \c curl_global_init() on construction and \c curl_global_cleanup() on destruction.
+         * @remark Create one instance at the start of \c main(), before any other cURL function is called. When
+         *      \c countLibcurlAllocations is set, libcurl is initialised with \c curl_global_init_mem() and
+         *      allocators that count every allocation in \c CURL_ALLOC_LIBCURL. The allocations that the
+         *      wrapper makes in its own buffers are always counted.
+         */
+        class CurlGlobal
+        {
+            private:
+                static std::atomic<uint64_t> _allocationCounts[CURL_ALLOC_SOURCE_COUNT]; ///< Number of allocations per source.
+                static std::atomic<uint64_t> _allocationBytes[CURL_ALLOC_SOURCE_COUNT]; ///< Number of bytes allocated per source.
+
+            public:
+                /**
+                 * @brief Initialise libcurl.
+                 * @param flags Flags for \c curl_global_init().
+                 * @param countLibcurlAllocations If \c true then the allocations made by libcurl are counted.
+                 */
+                explicit CurlGlobal(long flags = CURL_GLOBAL_ALL, bool countLibcurlAllocations = false);
+
+                /**
+                 * @brief Destructor. Calls \c curl_global_cleanup().
+                 */
+                ~CurlGlobal();
+
+            public:
+                /**
+                 * @brief Take a snapshot of the allocation counters.
+                 */
+                static CurlAllocationStats GetAllocationStats();
+
+                /**
+                 * @brief Count an allocation.
+                 * @param source Where the allocation was made.
+                 * @param sizeBytes Size of the allocation.
+                 */
+                static inline void RecordAllocation(CurlAllocationSource source, size_t sizeBytes);
+
+            private:
+                CurlGlobal(const CurlGlobal&) = delete;
+                CurlGlobal& operator=(const CurlGlobal&) = delete;
+        };
+
+        inline void CurlGlobal::RecordAllocation(CurlAllocationSource source, size_t sizeBytes)
+        {
+            _allocationCounts[source].fetch_add(1u, std::memory_order_relaxed);
+            _allocationBytes[source].fetch_add(sizeBytes, std::memory_order_relaxed);
+        }
+    } // namespace Web
+} // namespace AbcdEFramework
+
+#endif // CURL_GLOBAL_DB8B4323BFC84F8CBCF71CA1C03BAAF8
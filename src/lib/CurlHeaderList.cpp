@@ -0,0 +1,322 @@
+/**
+ * @file
+ * @brief Definition of the CurlHeaderList methods.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] Header names are compared with CurlTextScan::EqualsIgnoreCase().
+ * @date 2026-10-19 [JFDR] Added SetContentType() and SetAccept() for the body formats.
+ * @date 2026-10-19 [JFDR] Added GetValue().
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include "CurlGlobal.hpp"
+#include "CurlHeaderList.hpp"
+#include "CurlTextScan.hpp"
+
+#ifdef __GNUC__
+    #define AEF_METHOD_NAME __PRETTY_FUNCTION__
+#elif _MSC_VER
+    #define AEF_METHOD_NAME __FUNCSIG__
+#else
+    #error "C++ compiler signature not recognised."
+#endif
+
+namespace
+{
+    using AbcdEFramework::Web::CURL_ALLOC_HEADER_LIST;
+    using AbcdEFramework::Web::CurlGlobal;
+    using AbcdEFramework::Web::CurlHeaderList;
+
+    /**
+     * @brief Lists returned by \c CurlHeaderList::Intern(), by their lines.
+     */
+    struct InternTable
+    {
+        std::mutex mutex; ///< Guards the table.
+        std::unordered_map<std::string, std::weak_ptr<const CurlHeaderList>> lists; ///< The interned lists.
+        size_t sweepSize = 64u; ///< Size of the table at which lists that are no longer used are removed.
+    };
+
+    /**
+     * @brief Get the process wide intern table.
+     */
+    InternTable& GetInternTable()
+    {
+        static InternTable table;
+        return table;
+    }
+
+    /**
+     * @brief Count the allocation if a container grew.
+     */
+    template <typename Container>
+    inline void RecordGrowth(const Container& container, size_t capacityBefore)
+    {
+        if (container.capacity() != capacityBefore)
+        {
+            CurlGlobal::RecordAllocation(CURL_ALLOC_HEADER_LIST, container.capacity() * sizeof(typename Container::value_type));
+        }
+    }
+}
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        CurlHeaderList::CurlHeaderList()
+            :   _nodesStale(false)
+        {
+        }
+
+        CurlHeaderList::CurlHeaderList(std::initializer_list<std::string> headerLines)
+            :   _nodesStale(true)
+        {
+            // Size the buffers once instead of growing them line by line.
+            size_t linesLength = 0u;
+            for (const std::string& headerLine : headerLines)
+            {
+                linesLength += headerLine.size() + 1u;
+            }
+            this->_lines.reserve(linesLength);
+            this->_entries.reserve(headerLines.size());
+            RecordGrowth(this->_lines, 0u);
+            RecordGrowth(this->_entries, 0u);
+
+            for (const std::string& headerLine : headerLines)
+            {
+                Add(headerLine);
+            }
+        }
+
+        CurlHeaderList::CurlHeaderList(const CurlHeaderList& src)
+            :   _lines(src._lines),
+                _entries(src._entries),
+                _nodesStale(true)
+        {
+        }
+
+        CurlHeaderList::CurlHeaderList(CurlHeaderList&& src)
+            :   _lines(std::move(src._lines)),
+                _entries(std::move(src._entries)),
+                _nodesStale(true)
+        {
+            src.Clear();
+        }
+
+        CurlHeaderList& CurlHeaderList::operator=(const CurlHeaderList& src)
+        {
+            if (this != &src)
+            {
+                this->_lines = src._lines;
+                this->_entries = src._entries;
+                this->_nodesStale = true;
+            }
+            return *this;
+        }
+
+        CurlHeaderList& CurlHeaderList::operator=(CurlHeaderList&& src)
+        {
+            if (this != &src)
+            {
+                this->_lines = std::move(src._lines);
+                this->_entries = std::move(src._entries);
+                this->_nodesStale = true;
+                src.Clear();
+            }
+            return *this;
+        }
+
+        bool CurlHeaderList::operator==(const CurlHeaderList& rhs) const
+        {
+            // The lines are stored back to back in the order they are sent, so equal buffers mean equal lists.
+            return this->_lines == rhs._lines;
+        }
+
+        CurlHeaderList& CurlHeaderList::Add(const std::string& headerLine)
+        {
+            size_t nameLength = headerLine.find_first_of(":;");
+            if ((0u == nameLength) || (std::string::npos == nameLength))
+            {
+                throw std::invalid_argument(AEF_METHOD_NAME);
+            }
+
+            StoreLine(headerLine.data(), nameLength, "", headerLine.data() + nameLength, headerLine.size() - nameLength);
+            return *this;
+        }
+
+        CurlHeaderList& CurlHeaderList::Set(const std::string& name, const std::string& value)
+        {
+            if (name.empty() || (name.find_first_of(":;") != std::string::npos))
+            {
+                throw std::invalid_argument(AEF_METHOD_NAME);
+            }
+
+            StoreLine(name.data(), name.size(), ": ", value.data(), value.size());
+            return *this;
+        }
+
+        CurlHeaderList& CurlHeaderList::SetContentType(CurlBodyFormat format)
+        {
+            return Set("Content-Type", GetMediaType(format));
+        }
+
+        CurlHeaderList& CurlHeaderList::SetAccept(CurlBodyFormat format)
+        {
+            return Set("Accept", GetMediaType(format));
+        }
+
+        CurlStringView CurlHeaderList::GetValue(const std::string& name) const
+        {
+            size_t index = Find(name.c_str(), name.size());
+            if (index == this->_entries.size())
+            {
+                return CurlStringView();
+            }
+
+            // Skip the ':' or ';' after the name and the spaces before the value.
+            const Entry& entry(this->_entries[index]);
+            size_t valueOffset = std::min(entry.nameLength + 1u, entry.length);
+            while ((valueOffset < entry.length) && (' ' == this->_lines[entry.offset + valueOffset]))
+            {
+                ++valueOffset;
+            }
+            return CurlStringView(this->_lines.data() + entry.offset + valueOffset, entry.length - valueOffset);
+        }
+
+        bool CurlHeaderList::Remove(const std::string& name)
+        {
+            size_t index = Find(name.c_str(), name.size());
+            if (index == this->_entries.size())
+            {
+                return false;
+            }
+
+            const Entry removed(this->_entries[index]);
+            this->_lines.erase(removed.offset, removed.length + 1u);
+            this->_entries.erase(this->_entries.begin() + index);
+            for (size_t later = index; later < this->_entries.size(); ++later)
+            {
+                this->_entries[later].offset -= removed.length + 1u;
+            }
+
+            this->_nodesStale = true;
+            return true;
+        }
+
+        void CurlHeaderList::Clear()
+        {
+            this->_lines.clear();
+            this->_entries.clear();
+            this->_nodesStale = true;
+        }
+
+        std::shared_ptr<const CurlHeaderList> CurlHeaderList::Intern(const CurlHeaderList& headers)
+        {
+            InternTable& table(GetInternTable());
+            std::lock_guard<std::mutex> lock(table.mutex);
+
+            std::weak_ptr<const CurlHeaderList>& slot(table.lists[headers._lines]);
+            std::shared_ptr<const CurlHeaderList> shared(slot.lock());
+            if (shared)
+            {
+                return shared;
+            }
+
+            // Build the nodes before the list is shared, so that no thread changes it afterwards.
+            std::shared_ptr<CurlHeaderList> created(std::make_shared<CurlHeaderList>(headers));
+            created->BuildNodes();
+            slot = created;
+
+            if (table.lists.size() >= table.sweepSize)
+            {
+                for (auto iter = table.lists.begin(); iter != table.lists.end(); )
+                {
+                    iter = iter->second.expired() ? table.lists.erase(iter) : std::next(iter);
+                }
+                table.sweepSize = std::max<size_t>(64u, table.lists.size() * 2u);
+            }
+
+            return created;
+        }
+
+        const char* CurlHeaderList::GetMediaType(CurlBodyFormat format)
+        {
+            switch (format)
+            {
+                case CURL_BODY_JSON: return "application/json";
+                case CURL_BODY_CBOR: return "application/cbor";
+                case CURL_BODY_MSGPACK: return "application/msgpack";
+            }
+
+            throw std::invalid_argument(AEF_METHOD_NAME);
+        }
+
+        size_t CurlHeaderList::Find(const char* name, size_t nameLength) const
+        {
+            for (size_t index = 0u; index < this->_entries.size(); ++index)
+            {
+                const Entry& entry(this->_entries[index]);
+                if ((entry.nameLength == nameLength) && CurlTextScan::EqualsIgnoreCase(&this->_lines[entry.offset], name, nameLength))
+                {
+                    return index;
+                }
+            }
+            return this->_entries.size();
+        }
+
+        void CurlHeaderList::StoreLine(const char* name, size_t nameLength, const char* separator, const char* value, size_t valueLength)
+        {
+            size_t linesCapacity = this->_lines.capacity();
+            size_t entriesCapacity = this->_entries.capacity();
+            size_t separatorLength = ::strlen(separator);
+            size_t lineLength = nameLength + separatorLength + valueLength;
+
+            // Make room for the line, either in place of the line with the same name or at the end.
+            size_t index = Find(name, nameLength);
+            if (index == this->_entries.size())
+            {
+                Entry entry = { this->_lines.size(), nameLength, lineLength };
+                this->_lines.append(lineLength, ' ').push_back('\0');
+                this->_entries.push_back(entry);
+            }
+            else
+            {
+                Entry& entry(this->_entries[index]);
+                size_t oldLength = entry.length;
+                this->_lines.replace(entry.offset, oldLength, lineLength, ' ');
+                entry.length = lineLength;
+                for (size_t later = index + 1u; later < this->_entries.size(); ++later)
+                {
+                    this->_entries[later].offset = this->_entries[later].offset - oldLength + lineLength;
+                }
+            }
+
+            char* linePtr = &this->_lines[this->_entries[index].offset];
+            ::memcpy(linePtr, name, nameLength);
+            ::memcpy(linePtr + nameLength, separator, separatorLength);
+            ::memcpy(linePtr + nameLength + separatorLength, value, valueLength);
+
+            RecordGrowth(this->_lines, linesCapacity);
+            RecordGrowth(this->_entries, entriesCapacity);
+            this->_nodesStale = true;
+        }
+
+        void CurlHeaderList::BuildNodes() const
+        {
+            size_t nodesCapacity = this->_nodes.capacity();
+            this->_nodes.resize(this->_entries.size());
+            for (size_t index = 0u; index < this->_entries.size(); ++index)
+            {
+                this->_nodes[index].data = const_cast<char*>(this->_lines.data() + this->_entries[index].offset);
+                this->_nodes[index].next = (index + 1u < this->_nodes.size()) ? &this->_nodes[index + 1u] : nullptr;
+            }
+
+            RecordGrowth(this->_nodes, nodesCapacity);
+            this->_nodesStale = false;
+        }
+    } // namespace Web
+} // namespace AbcdEFramework
@@ -0,0 +1,214 @@
+/**
+ * @file
+ * @brief Declaration of the CurlHeaderList class.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] Added SetContentType() and SetAccept() for the body formats.
+ * @date 2026-10-19 [JFDR] Added GetValue().
+ */
+#if !defined CURL_HEADER_LIST_5C0B7A9E3F8D4E21A6B4D07C92E1F358
+#define CURL_HEADER_LIST_5C0B7A9E3F8D4E21A6B4D07C92E1F358 1
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <vector>
+#include <curl/curl.h>
+#include "CurlStringView.hpp"
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        /**
+         * @brief Format of a request or response body.
+         */
+        enum CurlBodyFormat
+        {
+            CURL_BODY_JSON = 0, ///< JSON text, \c application/json.
+            CURL_BODY_CBOR, ///< CBOR (RFC 7049), \c application/cbor.
+            CURL_BODY_MSGPACK ///< MessagePack, \c application/msgpack.
+        };
+
+        /**
+         * @brief List of HTTP headers for \c CURLOPT_HTTPHEADER that keeps all header lines in one buffer.
+         * @remark Unlike \c CurlSList, adding a header does not allocate a node and a copy of the string. The lines
+         *      are stored one after the other, each terminated by a NUL character, and a header with the same name
+         *      (compared without regard to case) replaces the previous one in place. The \c curl_slist that cURL
+         *      reads is an array of nodes that point into that buffer. It is built on the first conversion and kept
+         *      until the list is changed.
+         *
+         *      Lists with the same headers can be shared with \c Intern(). A list that is shared between threads
+         *      must not be changed, and its \c curl_slist must have been built before it was shared; \c Intern()
+         *      takes care of that.
+         */
+        class CurlHeaderList
+        {
+            private:
+                /**
+                 * @brief Position of one header line in the buffer.
+                 */
+                struct Entry
+                {
+                    size_t offset; ///< Offset of the first character of the line.
+                    size_t nameLength; ///< Number of characters in the header name.
+                    size_t length; ///< Number of characters in the line, excluding the terminating NUL.
+                };
+
+            private:
+                std::string _lines; ///< All header lines, each followed by a NUL character.
+                std::vector<Entry> _entries; ///< One entry per header line, in the order they are sent.
+                mutable std::vector<curl_slist> _nodes; ///< The list that is handed to cURL.
+                mutable bool _nodesStale; ///< Set if \c _nodes does not describe the current lines.
+
+            public:
+                /**
+                 * @brief Construct an empty list.
+                 */
+                CurlHeaderList();
+
+                /**
+                 * @brief Construct a list from header lines.
+                 * @param headerLines Lines such as \c "Accept: application/json". See \c Add().
+                 */
+                CurlHeaderList(std::initializer_list<std::string> headerLines);
+
+                /**
+                 * @brief Copy constructor. The \c curl_slist is not copied; it is built again when needed.
+                 */
+                CurlHeaderList(const CurlHeaderList& src);
+
+                /**
+                 * @brief Move constructor. The \c curl_slist is built again when needed.
+                 */
+                CurlHeaderList(CurlHeaderList&& src);
+
+            public:
+                /**
+                 * @brief Copy assignment operator.
+                 */
+                CurlHeaderList& operator=(const CurlHeaderList& src);
+
+                /**
+                 * @brief Move assignment operator.
+                 */
+                CurlHeaderList& operator=(CurlHeaderList&& src);
+
+                /**
+                 * @brief Return the list in the form that \c CURLOPT_HTTPHEADER expects.
+                 * @return A pointer that stays valid until the list is changed or destroyed, or \c nullptr if the
+                 *      list is empty.
+                 */
+                inline operator const curl_slist*() const;
+
+                /**
+                 * @brief Test whether two lists hold the same lines in the same order.
+                 */
+                bool operator==(const CurlHeaderList& rhs) const;
+
+            public:
+                /**
+                 * @brief Add a header line, or replace the line with the same header name.
+                 * @param headerLine A line of the form \c "Name: value". cURL also accepts \c "Name:" to remove one
+                 *      of its own headers and \c "Name;" to send a header without a value.
+                 */
+                CurlHeaderList& Add(const std::string& headerLine);
+
+                /**
+                 * @brief Set a header, replacing the line with the same header name.
+                 */
+                CurlHeaderList& Set(const std::string& name, const std::string& value);
+
+                /**
+                 * @brief Set the \c Content-Type header to the media type of a body format.
+                 */
+                CurlHeaderList& SetContentType(CurlBodyFormat format);
+
+                /**
+                 * @brief Set the \c Accept header to the media type of a body format.
+                 */
+                CurlHeaderList& SetAccept(CurlBodyFormat format);
+
+                /**
+                 * @brief Get the value of a header, ignoring the case of the name.
+                 * @return The value, or a null view if the list has no such header. It is valid until the list
+                 *      is changed.
+                 */
+                CurlStringView GetValue(const std::string& name) const;
+
+                /**
+                 * @brief Remove the header with the given name.
+                 * @return \c true if the list held the header.
+                 */
+                bool Remove(const std::string& name);
+
+                /**
+                 * @brief Remove all headers.
+                 */
+                void Clear();
+
+                /**
+                 * @brief Get the number of header lines.
+                 */
+                inline size_t Size() const;
+
+                /**
+                 * @brief Get the header line at \c index, without the terminating NUL.
+                 */
+                inline std::string GetLine(size_t index) const;
+
+                /**
+                 * @brief Get a shared list with the same lines as \c headers.
+                 * @remark Lists are interned process wide: as long as a list returned by this method is in use, the
+                 *      same list is returned for a list with the same lines, so requests with the same headers share
+                 *      one copy and the wrapper recognises it as the list that is already set.
+                 */
+                static std::shared_ptr<const CurlHeaderList> Intern(const CurlHeaderList& headers);
+
+                /**
+                 * @brief Get the media type of a body format, e.g. \c "application/cbor".
+                 */
+                static const char* GetMediaType(CurlBodyFormat format);
+
+            private:
+                /**
+                 * @brief Find the line for a header name, ignoring case.
+                 * @return The index in \c _entries, or \c _entries.size() if there is no such line.
+                 */
+                size_t Find(const char* name, size_t nameLength) const;
+
+                /**
+                 * @brief Store the line \c name \c separator \c value, replacing the one with the same header name.
+                 */
+                void StoreLine(const char* name, size_t nameLength, const char* separator, const char* value, size_t valueLength);
+
+                /**
+                 * @brief Build the \c curl_slist nodes.
+                 */
+                void BuildNodes() const;
+        };
+
+        inline CurlHeaderList::operator const curl_slist*() const
+        {
+            if (this->_nodesStale)
+            {
+                BuildNodes();
+            }
+
+            return this->_nodes.empty() ? nullptr : &this->_nodes.front();
+        }
+
+        inline size_t CurlHeaderList::Size() const
+        {
+            return this->_entries.size();
+        }
+
+        inline std::string CurlHeaderList::GetLine(size_t index) const
+        {
+            const Entry& entry(this->_entries.at(index));
+            return this->_lines.substr(entry.offset, entry.length);
+        }
+    } // namespace Web
+} // namespace AbcdEFramework
+
+#endif // CURL_HEADER_LIST_5C0B7A9E3F8D4E21A6B4D07C92E1F358
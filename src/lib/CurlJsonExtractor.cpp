@@ -0,0 +1,942 @@
+/**
+ * @file
+ * @brief Definition of the CurlJsonField and CurlJsonExtractor methods.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] Added extraction from a CurlJsonIndex.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include "CurlJsonExtractor.hpp"
+
+namespace
+{
+    /**
+     * @brief Get the value of a hexadecimal digit, or -1.
+     */
+    inline int HexValue(char ch)
+    {
+        if ((ch >= '0') && (ch <= '9'))
+        {
+            return ch - '0';
+        }
+        if ((ch >= 'a') && (ch <= 'f'))
+        {
+            return ch - 'a' + 10;
+        }
+        if ((ch >= 'A') && (ch <= 'F'))
+        {
+            return ch - 'A' + 10;
+        }
+        return -1;
+    }
+
+    /**
+     * @brief Read the four hexadecimal digits of a \c \\u escape.
+     * @return \c false if there are not four digits.
+     */
+    bool ReadCodeUnit(const char*& pos, const char* end, unsigned& codeUnit)
+    {
+        if (end - pos < 4)
+        {
+            return false;
+        }
+
+        codeUnit = 0u;
+        for (int digit = 0; digit < 4; ++digit)
+        {
+            int value = HexValue(pos[digit]);
+            if (value < 0)
+            {
+                return false;
+            }
+            codeUnit = (codeUnit << 4) | (unsigned)value;
+        }
+        pos += 4;
+        return true;
+    }
+
+    /**
+     * @brief Decode the next character of the text of a JSON string into UTF-8.
+     * @param pos Start of the character; moved past it.
+     * @param out Receives up to four bytes.
+     * @return The number of bytes in \c out, or 0 for an invalid escape sequence.
+     */
+    size_t DecodeNext(const char*& pos, const char* end, char out[4])
+    {
+        if (*pos != '\\')
+        {
+            out[0] = *pos++;
+            return 1u;
+        }
+        if (end - pos < 2)
+        {
+            return 0u;
+        }
+
+        char escape = pos[1];
+        pos += 2;
+        switch (escape)
+        {
+            case '"': out[0] = '"'; return 1u;
+            case '\\': out[0] = '\\'; return 1u;
+            case '/': out[0] = '/'; return 1u;
+            case 'b': out[0] = '\b'; return 1u;
+            case 'f': out[0] = '\f'; return 1u;
+            case 'n': out[0] = '\n'; return 1u;
+            case 'r': out[0] = '\r'; return 1u;
+            case 't': out[0] = '\t'; return 1u;
+            case 'u': break;
+            default: return 0u;
+        }
+
+        unsigned codePoint;
+        if (!ReadCodeUnit(pos, end, codePoint) || ((codePoint >= 0xDC00u) && (codePoint <= 0xDFFFu)))
+        {
+            return 0u;
+        }
+        if ((codePoint >= 0xD800u) && (codePoint <= 0xDBFFu))
+        {
+            unsigned low;
+            if ((end - pos < 2) || (pos[0] != '\\') || (pos[1] != 'u'))
+            {
+                return 0u;
+            }
+            pos += 2;
+            if (!ReadCodeUnit(pos, end, low) || (low < 0xDC00u) || (low > 0xDFFFu))
+            {
+                return 0u;
+            }
+            codePoint = 0x10000u + ((codePoint - 0xD800u) << 10) + (low - 0xDC00u);
+        }
+
+        if (codePoint < 0x80u)
+        {
+            out[0] = (char)codePoint;
+            return 1u;
+        }
+        if (codePoint < 0x800u)
+        {
+            out[0] = (char)(0xC0u | (codePoint >> 6));
+            out[1] = (char)(0x80u | (codePoint & 0x3Fu));
+            return 2u;
+        }
+        if (codePoint < 0x10000u)
+        {
+            out[0] = (char)(0xE0u | (codePoint >> 12));
+            out[1] = (char)(0x80u | ((codePoint >> 6) & 0x3Fu));
+            out[2] = (char)(0x80u | (codePoint & 0x3Fu));
+            return 3u;
+        }
+        out[0] = (char)(0xF0u | (codePoint >> 18));
+        out[1] = (char)(0x80u | ((codePoint >> 12) & 0x3Fu));
+        out[2] = (char)(0x80u | ((codePoint >> 6) & 0x3Fu));
+        out[3] = (char)(0x80u | (codePoint & 0x3Fu));
+        return 4u;
+    }
+
+    /**
+     * @brief Test whether the text of a JSON string, with escapes, decodes to \c name. Nothing is allocated.
+     */
+    bool EscapedEquals(const char* text, size_t textSize, const std::string& name)
+    {
+        const char* pos = text;
+        const char* end = text + textSize;
+        size_t matched = 0u;
+        while (pos < end)
+        {
+            char decoded[4];
+            size_t count = DecodeNext(pos, end, decoded);
+            if ((0u == count) || (count > name.size() - matched) || (std::memcmp(decoded, name.data() + matched, count) != 0))
+            {
+                return false;
+            }
+            matched += count;
+        }
+        return matched == name.size();
+    }
+
+    /**
+     * @brief Get a path token as an array index.
+     * @return The index, or \c SIZE_MAX if the token is not a decimal number without leading zeros.
+     */
+    size_t ArrayIndex(const std::string& token)
+    {
+        if (token.empty() || (token.size() > 18u) || ((token[0] == '0') && (token.size() > 1u)))
+        {
+            return SIZE_MAX;
+        }
+
+        size_t index = 0u;
+        for (char ch : token)
+        {
+            if ((ch < '0') || (ch > '9'))
+            {
+                return SIZE_MAX;
+            }
+            index = index * 10u + (size_t)(ch - '0');
+        }
+        return index;
+    }
+}
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        CurlJsonField::CurlJsonField()
+            :   _type(MISSING),
+                _escaped(false)
+        {
+        }
+
+        CurlJsonField::CurlJsonField(Type type, CurlStringView raw, bool escaped)
+            :   _type(type),
+                _raw(raw),
+                _escaped(escaped)
+        {
+        }
+
+        CurlStringView CurlJsonField::GetRawString() const
+        {
+            if (this->_type != STRING)
+            {
+                throw std::invalid_argument("JSON value is not a string");
+            }
+            return CurlStringView(this->_raw.Data() + 1, this->_raw.Size() - 2u);
+        }
+
+        std::string CurlJsonField::GetString() const
+        {
+            CurlStringView text(GetRawString());
+            if (!this->_escaped)
+            {
+                return text.ToString();
+            }
+
+            std::string result;
+            result.reserve(text.Size());
+            const char* pos = text.begin();
+            while (pos < text.end())
+            {
+                char decoded[4];
+                size_t count = DecodeNext(pos, text.end(), decoded);
+                if (0u == count)
+                {
+                    throw std::invalid_argument("JSON string has an invalid escape sequence");
+                }
+                result.append(decoded, count);
+            }
+            return result;
+        }
+
+        bool CurlJsonField::GetBool() const
+        {
+            if (this->_type != BOOLEAN)
+            {
+                throw std::invalid_argument("JSON value is not a boolean");
+            }
+            return this->_raw.Data()[0] == 't';
+        }
+
+        int64_t CurlJsonField::GetInt64() const
+        {
+            if (this->_type != NUMBER)
+            {
+                throw std::invalid_argument("JSON value is not a number");
+            }
+
+            const char* pos = this->_raw.begin();
+            const char* end = this->_raw.end();
+            bool negative = (*pos == '-');
+            if (negative)
+            {
+                ++pos;
+            }
+            if (pos == end)
+            {
+                throw std::invalid_argument("JSON value is not an integer");
+            }
+
+            // The magnitude of INT64_MIN is one more than INT64_MAX.
+            const uint64_t limit = negative ? (uint64_t)INT64_MAX + 1u : (uint64_t)INT64_MAX;
+            uint64_t magnitude = 0u;
+            for (; pos < end; ++pos)
+            {
+                if ((*pos < '0') || (*pos > '9'))
+                {
+                    throw std::invalid_argument("JSON value is not an integer");
+                }
+                uint64_t digit = (uint64_t)(*pos - '0');
+                if (magnitude > (limit - digit) / 10u)
+                {
+                    throw std::invalid_argument("JSON integer does not fit in 64 bits");
+                }
+                magnitude = magnitude * 10u + digit;
+            }
+
+            return negative ? (int64_t)(0u - magnitude) : (int64_t)magnitude;
+        }
+
+        double CurlJsonField::GetDouble() const
+        {
+            if (this->_type != NUMBER)
+            {
+                throw std::invalid_argument("JSON value is not a number");
+            }
+
+            // strtod() needs a terminated string; numbers of normal length are copied to the stack.
+            char buffer[64];
+            std::string longNumber;
+            const char* text = buffer;
+            if (this->_raw.Size() < sizeof(buffer))
+            {
+                std::memcpy(buffer, this->_raw.Data(), this->_raw.Size());
+                buffer[this->_raw.Size()] = '\0';
+            }
+            else
+            {
+                longNumber = this->_raw.ToString();
+                text = longNumber.c_str();
+            }
+
+            char* parsedEnd = nullptr;
+            double value = std::strtod(text, &parsedEnd);
+            if (parsedEnd != text + this->_raw.Size())
+            {
+                throw std::invalid_argument("JSON value is not a valid number");
+            }
+            return value;
+        }
+
+        CurlJsonExtractor::CurlJsonExtractor(const std::vector<std::string>& pointers)
+            :   _remaining(0u),
+                _begin(nullptr),
+                _end(nullptr),
+                _index(nullptr)
+        {
+            this->_nodes.push_back(Node{ std::string(), SIZE_MAX, 0u, 0u, SIZE_MAX });
+            for (size_t field = 0u; field < pointers.size(); ++field)
+            {
+                const std::string& pointer(pointers[field]);
+                if (!pointer.empty() && (pointer[0] != '/'))
+                {
+                    throw std::invalid_argument("JSON pointer does not start with '/': " + pointer);
+                }
+
+                size_t node = 0u;
+                size_t start = 1u;
+                while (start <= pointer.size())
+                {
+                    size_t slash = pointer.find('/', start);
+                    if (std::string::npos == slash)
+                    {
+                        slash = pointer.size();
+                    }
+
+                    // "~1" stands for '/' and "~0" for '~'.
+                    std::string token;
+                    for (size_t pos = start; pos < slash; ++pos)
+                    {
+                        if (pointer[pos] != '~')
+                        {
+                            token.push_back(pointer[pos]);
+                        }
+                        else if ((pos + 1u < slash) && ((pointer[pos + 1u] == '0') || (pointer[pos + 1u] == '1')))
+                        {
+                            token.push_back((pointer[++pos] == '0') ? '~' : '/');
+                        }
+                        else
+                        {
+                            throw std::invalid_argument("JSON pointer has an invalid escape: " + pointer);
+                        }
+                    }
+
+                    size_t child = this->_nodes[node].firstChild;
+                    while ((child != 0u) && (this->_nodes[child].name != token))
+                    {
+                        child = this->_nodes[child].nextSibling;
+                    }
+                    if (0u == child)
+                    {
+                        child = this->_nodes.size();
+                        size_t index = ArrayIndex(token);
+                        this->_nodes.push_back(Node{ std::move(token), index, 0u, this->_nodes[node].firstChild, SIZE_MAX });
+                        this->_nodes[node].firstChild = child;
+                    }
+
+                    node = child;
+                    start = slash + 1u;
+                }
+
+                if (SIZE_MAX == this->_nodes[node].field)
+                {
+                    this->_nodes[node].field = field;
+                }
+                else
+                {
+                    this->_duplicates.push_back(std::make_pair(field, this->_nodes[node].field));
+                }
+            }
+
+            this->_fields.resize(pointers.size());
+        }
+
+        size_t CurlJsonExtractor::Extract(const char* data, size_t sizeBytes)
+        {
+            StartExtract(data, sizeBytes);
+            const char* pos = SkipSpace(data);
+            if (pos == this->_end)
+            {
+                ThrowSyntaxError(pos, "empty document");
+            }
+            pos = ScanValue(pos, 0u);
+            if (this->_remaining != 0u)
+            {
+                // The whole document was scanned, so it must not have anything after the value.
+                if (SkipSpace(pos) != this->_end)
+                {
+                    ThrowSyntaxError(SkipSpace(pos), "unexpected data after the document");
+                }
+            }
+            return FinishExtract();
+        }
+
+        size_t CurlJsonExtractor::Extract(const CurlJsonIndex& index)
+        {
+            StartExtract(index.GetData(), index.GetSize());
+            this->_index = &index;
+            if (0u == index.GetTokenCount())
+            {
+                ThrowSyntaxError(this->_end, "empty document");
+            }
+            size_t token = ScanIndexedValue(0u, 0u);
+            if ((this->_remaining != 0u) && (token < index.GetTokenCount()))
+            {
+                ThrowSyntaxError(this->_begin + index.GetToken(token).offset, "unexpected data after the document");
+            }
+            return FinishExtract();
+        }
+
+        void CurlJsonExtractor::StartExtract(const char* data, size_t sizeBytes)
+        {
+            for (CurlJsonField& field : this->_fields)
+            {
+                field = CurlJsonField();
+            }
+            this->_remaining = this->_fields.size() - this->_duplicates.size();
+            this->_begin = data;
+            this->_end = data + sizeBytes;
+            this->_index = nullptr;
+        }
+
+        size_t CurlJsonExtractor::FinishExtract()
+        {
+            for (const std::pair<size_t, size_t>& duplicate : this->_duplicates)
+            {
+                this->_fields[duplicate.first] = this->_fields[duplicate.second];
+            }
+
+            size_t found = 0u;
+            for (const CurlJsonField& field : this->_fields)
+            {
+                if (field.IsFound())
+                {
+                    ++found;
+                }
+            }
+            return found;
+        }
+
+        const char* CurlJsonExtractor::ScanValue(const char* pos, size_t node)
+        {
+            if (pos == this->_end)
+            {
+                ThrowSyntaxError(pos, "unexpected end of document");
+            }
+
+            const char* start = pos;
+            const bool hasChildren = (this->_nodes[node].firstChild != 0u);
+            bool escaped = false;
+            CurlJsonField::Type type;
+            switch (*pos)
+            {
+                case '{':
+                    type = CurlJsonField::OBJECT;
+                    pos = hasChildren ? ScanObject(pos + 1, node) : SkipValue(pos);
+                    break;
+
+                case '[':
+                    type = CurlJsonField::ARRAY;
+                    pos = hasChildren ? ScanArray(pos + 1, node) : SkipValue(pos);
+                    break;
+
+                case '"':
+                    type = CurlJsonField::STRING;
+                    pos = SkipString(pos + 1, escaped);
+                    break;
+
+                case 't':
+                case 'f':
+                    type = CurlJsonField::BOOLEAN;
+                    pos = SkipValue(pos);
+                    break;
+
+                case 'n':
+                    type = CurlJsonField::NULL_VALUE;
+                    pos = SkipValue(pos);
+                    break;
+
+                default:
+                    type = CurlJsonField::NUMBER;
+                    pos = SkipValue(pos);
+                    break;
+            }
+
+            size_t field = this->_nodes[node].field;
+            if ((field != SIZE_MAX) && !this->_fields[field].IsFound())
+            {
+                this->_fields[field] = CurlJsonField(type, CurlStringView(start, (size_t)(pos - start)), escaped);
+                --this->_remaining;
+            }
+            return pos;
+        }
+
+        const char* CurlJsonExtractor::ScanObject(const char* pos, size_t node)
+        {
+            pos = SkipSpace(pos);
+            if ((pos < this->_end) && (*pos == '}'))
+            {
+                return pos + 1;
+            }
+
+            for (;;)
+            {
+                if ((pos == this->_end) || (*pos != '"'))
+                {
+                    ThrowSyntaxError(pos, "expected a member name");
+                }
+                const char* name = pos + 1;
+                bool escaped = false;
+                pos = SkipString(name, escaped);
+                size_t child = FindMember(node, name, (size_t)(pos - 1 - name), escaped);
+
+                pos = SkipSpace(pos);
+                if ((pos == this->_end) || (*pos != ':'))
+                {
+                    ThrowSyntaxError(pos, "expected ':'");
+                }
+                pos = SkipSpace(pos + 1);
+
+                if (child != 0u)
+                {
+                    pos = ScanValue(pos, child);
+                    if (0u == this->_remaining)
+                    {
+                        return pos;
+                    }
+                }
+                else
+                {
+                    pos = SkipValue(pos);
+                }
+
+                pos = SkipSpace(pos);
+                if (pos == this->_end)
+                {
+                    ThrowSyntaxError(pos, "unexpected end of document");
+                }
+                if (*pos == '}')
+                {
+                    return pos + 1;
+                }
+                if (*pos != ',')
+                {
+                    ThrowSyntaxError(pos, "expected ',' or '}'");
+                }
+                pos = SkipSpace(pos + 1);
+            }
+        }
+
+        const char* CurlJsonExtractor::ScanArray(const char* pos, size_t node)
+        {
+            pos = SkipSpace(pos);
+            if ((pos < this->_end) && (*pos == ']'))
+            {
+                return pos + 1;
+            }
+
+            for (size_t index = 0u; ; ++index)
+            {
+                size_t child = this->_nodes[node].firstChild;
+                while ((child != 0u) && (this->_nodes[child].index != index))
+                {
+                    child = this->_nodes[child].nextSibling;
+                }
+
+                if (child != 0u)
+                {
+                    pos = ScanValue(pos, child);
+                    if (0u == this->_remaining)
+                    {
+                        return pos;
+                    }
+                }
+                else
+                {
+                    pos = SkipValue(pos);
+                }
+
+                pos = SkipSpace(pos);
+                if (pos == this->_end)
+                {
+                    ThrowSyntaxError(pos, "unexpected end of document");
+                }
+                if (*pos == ']')
+                {
+                    return pos + 1;
+                }
+                if (*pos != ',')
+                {
+                    ThrowSyntaxError(pos, "expected ',' or ']'");
+                }
+                pos = SkipSpace(pos + 1);
+            }
+        }
+
+        const char* CurlJsonExtractor::SkipValue(const char* pos)
+        {
+            if (pos == this->_end)
+            {
+                ThrowSyntaxError(pos, "unexpected end of document");
+            }
+
+            bool escaped = false;
+            switch (*pos)
+            {
+                case '"':
+                    return SkipString(pos + 1, escaped);
+
+                case '{':
+                case '[':
+                {
+                    // Only brackets outside strings count; which kind of bracket closes which is not checked.
+                    size_t depth = 0u;
+                    while (pos < this->_end)
+                    {
+                        switch (*pos)
+                        {
+                            case '"':
+                                pos = SkipString(pos + 1, escaped);
+                                continue;
+
+                            case '{':
+                            case '[':
+                                ++depth;
+                                break;
+
+                            case '}':
+                            case ']':
+                                if (0u == --depth)
+                                {
+                                    return pos + 1;
+                                }
+                                break;
+
+                            default:
+                                break;
+                        }
+                        ++pos;
+                    }
+                    ThrowSyntaxError(pos, "unexpected end of document");
+                }
+
+                case 't':
+                case 'f':
+                case 'n':
+                {
+                    const char* literal = (*pos == 't') ? "true" : ((*pos == 'f') ? "false" : "null");
+                    size_t length = std::strlen(literal);
+                    if (((size_t)(this->_end - pos) < length) || (std::memcmp(pos, literal, length) != 0))
+                    {
+                        ThrowSyntaxError(pos, "invalid literal");
+                    }
+                    return pos + length;
+                }
+
+                default:
+                {
+                    // The number is checked when it is converted.
+                    const char* start = pos;
+                    while ((pos < this->_end) && (((*pos >= '0') && (*pos <= '9')) || (*pos == '-') || (*pos == '+') || (*pos == '.') || (*pos == 'e') || (*pos == 'E')))
+                    {
+                        ++pos;
+                    }
+                    if (pos == start)
+                    {
+                        ThrowSyntaxError(pos, "unexpected character");
+                    }
+                    return pos;
+                }
+            }
+        }
+
+        const char* CurlJsonExtractor::SkipString(const char* pos, bool& escaped)
+        {
+            for (;;)
+            {
+                const char* quote = static_cast<const char*>(std::memchr(pos, '"', (size_t)(this->_end - pos)));
+                if (nullptr == quote)
+                {
+                    ThrowSyntaxError(this->_end, "unterminated string");
+                }
+                if (!escaped && (std::memchr(pos, '\\', (size_t)(quote - pos)) != nullptr))
+                {
+                    escaped = true;
+                }
+
+                // The quote ends the string unless it follows an odd number of backslashes.
+                const char* backslash = quote;
+                while ((backslash > pos) && (backslash[-1] == '\\'))
+                {
+                    --backslash;
+                }
+                if (0 == ((quote - backslash) & 1))
+                {
+                    return quote + 1;
+                }
+                pos = quote + 1;
+            }
+        }
+
+        size_t CurlJsonExtractor::ScanIndexedValue(size_t token, size_t node)
+        {
+            const char* start = this->_begin + ((token < this->_index->GetTokenCount()) ? this->_index->GetToken(token).offset : this->_end - this->_begin);
+            const bool hasChildren = (this->_nodes[node].firstChild != 0u);
+            const char* end = start;
+            size_t next = token + 1u;
+            bool escaped = false;
+            CurlJsonField::Type type = CurlJsonField::MISSING;
+            switch (IndexedChar(token))
+            {
+                case '{':
+                case '[':
+                    type = ('{' == *start) ? CurlJsonField::OBJECT : CurlJsonField::ARRAY;
+                    end = this->_begin + this->_index->GetToken(this->_index->GetToken(token).match).offset + 1;
+                    if (!hasChildren)
+                    {
+                        next = this->_index->GetToken(token).match + 1u;
+                    }
+                    else
+                    {
+                        next = (CurlJsonField::OBJECT == type) ? ScanIndexedObject(token, node) : ScanIndexedArray(token, node);
+                    }
+                    break;
+
+                case '"':
+                    type = CurlJsonField::STRING;
+                    end = IndexedScalarEnd(token);
+                    if ((end - start < 2) || (end[-1] != '"'))
+                    {
+                        ThrowSyntaxError(start, "invalid string");
+                    }
+                    escaped = (std::memchr(start + 1, '\\', (size_t)(end - start - 2)) != nullptr);
+                    next = token + 1u;
+                    break;
+
+                case 't':
+                case 'f':
+                case 'n':
+                {
+                    type = ('n' == *start) ? CurlJsonField::NULL_VALUE : CurlJsonField::BOOLEAN;
+                    end = IndexedScalarEnd(token);
+                    const char* literal = ('t' == *start) ? "true" : (('f' == *start) ? "false" : "null");
+                    if (((size_t)(end - start) != std::strlen(literal)) || (std::memcmp(start, literal, (size_t)(end - start)) != 0))
+                    {
+                        ThrowSyntaxError(start, "invalid literal");
+                    }
+                    next = token + 1u;
+                    break;
+                }
+
+                case '-':
+                case '0':
+                case '1':
+                case '2':
+                case '3':
+                case '4':
+                case '5':
+                case '6':
+                case '7':
+                case '8':
+                case '9':
+                    // The number is checked when it is converted.
+                    type = CurlJsonField::NUMBER;
+                    end = IndexedScalarEnd(token);
+                    next = token + 1u;
+                    break;
+
+                case '\0':
+                    ThrowSyntaxError(start, "unexpected end of document");
+
+                default:
+                    ThrowSyntaxError(start, "expected a value");
+            }
+
+            size_t field = this->_nodes[node].field;
+            if ((field != SIZE_MAX) && !this->_fields[field].IsFound())
+            {
+                this->_fields[field] = CurlJsonField(type, CurlStringView(start, (size_t)(end - start)), escaped);
+                --this->_remaining;
+            }
+            return next;
+        }
+
+        size_t CurlJsonExtractor::ScanIndexedObject(size_t token, size_t node)
+        {
+            const size_t close = this->_index->GetToken(token).match;
+            for (size_t member = token + 1u; member != close; )
+            {
+                if (IndexedChar(member) != '"')
+                {
+                    ThrowSyntaxError(this->_begin + this->_index->GetToken(member).offset, "expected a member name");
+                }
+                const char* name = this->_begin + this->_index->GetToken(member).offset + 1;
+                const char* nameEnd = IndexedScalarEnd(member) - 1;
+                size_t child = FindMember(node, name, (size_t)(nameEnd - name), std::memchr(name, '\\', (size_t)(nameEnd - name)) != nullptr);
+
+                if (IndexedChar(member + 1u) != ':')
+                {
+                    ThrowSyntaxError(nameEnd + 1, "expected ':'");
+                }
+
+                size_t next;
+                if (child != 0u)
+                {
+                    next = ScanIndexedValue(member + 2u, child);
+                    if (0u == this->_remaining)
+                    {
+                        return next;
+                    }
+                }
+                else
+                {
+                    next = SkipIndexedValue(member + 2u);
+                }
+
+                if (next == close)
+                {
+                    break;
+                }
+                if (IndexedChar(next) != ',')
+                {
+                    ThrowSyntaxError(this->_begin + this->_index->GetToken(next).offset, "expected ',' or '}'");
+                }
+                member = next + 1u;
+                if (member == close)
+                {
+                    ThrowSyntaxError(this->_begin + this->_index->GetToken(close).offset, "expected a member name");
+                }
+            }
+            return close + 1u;
+        }
+
+        size_t CurlJsonExtractor::ScanIndexedArray(size_t token, size_t node)
+        {
+            const size_t close = this->_index->GetToken(token).match;
+            size_t index = 0u;
+            for (size_t element = token + 1u; element != close; ++index)
+            {
+                size_t child = this->_nodes[node].firstChild;
+                while ((child != 0u) && (this->_nodes[child].index != index))
+                {
+                    child = this->_nodes[child].nextSibling;
+                }
+
+                size_t next;
+                if (child != 0u)
+                {
+                    next = ScanIndexedValue(element, child);
+                    if (0u == this->_remaining)
+                    {
+                        return next;
+                    }
+                }
+                else
+                {
+                    next = SkipIndexedValue(element);
+                }
+
+                if (next == close)
+                {
+                    break;
+                }
+                if (IndexedChar(next) != ',')
+                {
+                    ThrowSyntaxError(this->_begin + this->_index->GetToken(next).offset, "expected ',' or ']'");
+                }
+                element = next + 1u;
+                if (element == close)
+                {
+                    ThrowSyntaxError(this->_begin + this->_index->GetToken(close).offset, "expected a value");
+                }
+            }
+            return close + 1u;
+        }
+
+        size_t CurlJsonExtractor::SkipIndexedValue(size_t token) const
+        {
+            switch (IndexedChar(token))
+            {
+                case '{':
+                case '[':
+                    return this->_index->GetToken(token).match + 1u;
+
+                case '\0':
+                    ThrowSyntaxError(this->_end, "unexpected end of document");
+
+                case ':':
+                case ',':
+                case '}':
+                case ']':
+                    ThrowSyntaxError(this->_begin + this->_index->GetToken(token).offset, "expected a value");
+
+                default:
+                    return token + 1u;
+            }
+        }
+
+        const char* CurlJsonExtractor::IndexedScalarEnd(size_t token) const
+        {
+            // The text runs up to the next token, less the white space before it.
+            const char* end = (token + 1u < this->_index->GetTokenCount()) ? this->_begin + this->_index->GetToken(token + 1u).offset : this->_end;
+            while ((*(end - 1) == ' ') || (*(end - 1) == '\n') || (*(end - 1) == '\r') || (*(end - 1) == '\t'))
+            {
+                --end;
+            }
+            return end;
+        }
+
+        size_t CurlJsonExtractor::FindMember(size_t node, const char* name, size_t nameSize, bool escaped) const
+        {
+            for (size_t child = this->_nodes[node].firstChild; child != 0u; child = this->_nodes[child].nextSibling)
+            {
+                const std::string& token(this->_nodes[child].name);
+                if (escaped ? EscapedEquals(name, nameSize, token) : ((token.size() == nameSize) && (std::memcmp(token.data(), name, nameSize) == 0)))
+                {
+                    return child;
+                }
+            }
+            return 0u;
+        }
+
+        void CurlJsonExtractor::ThrowSyntaxError(const char* pos, const char* message) const
+        {
+            char text[128];
+            std::snprintf(text, sizeof(text), "JSON syntax error at byte %lu: %s", (unsigned long)(pos - this->_begin), message);
+            throw std::invalid_argument(text);
+        }
+    } // namespace Web
+} // namespace AbcdEFramework
@@ -0,0 +1,359 @@
+/**
+ * @file
+ * @brief Declaration of the CurlJsonField and CurlJsonExtractor classes.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] Added extraction from a CurlJsonIndex.
+ */
+#if !defined CURL_JSON_EXTRACTOR_5D2C8E71A04F4B96A3E6F0B7C19D2E84
+#define CURL_JSON_EXTRACTOR_5D2C8E71A04F4B96A3E6F0B7C19D2E84 1
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include "CurlJsonIndex.hpp"
+#include "CurlStringView.hpp"
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        /**
+         * @brief A value that \c CurlJsonExtractor found in a JSON document.
+         * @remark The field refers to the text of the value in the scanned buffer and is valid as long as that
+         *      buffer is. Nothing is converted until one of the getters is called.
+         */
+        class CurlJsonField
+        {
+            public:
+                /**
+                 * @brief Type of a JSON value.
+                 */
+                enum Type
+                {
+                    MISSING, ///< The document has no value at the path.
+                    NULL_VALUE, ///< \c null
+                    BOOLEAN, ///< \c true or \c false
+                    NUMBER, ///< A number.
+                    STRING, ///< A string.
+                    ARRAY, ///< An array.
+                    OBJECT ///< An object.
+                };
+
+            private:
+                Type _type; ///< Type of the value.
+                CurlStringView _raw; ///< The JSON text of the value.
+                bool _escaped; ///< Set if the value is a string that has escape sequences.
+
+            public:
+                /**
+                 * @brief Construct a missing field.
+                 */
+                CurlJsonField();
+
+                /**
+                 * @brief Construct a field for the JSON text of a value.
+                 */
+                CurlJsonField(Type type, CurlStringView raw, bool escaped);
+
+            public:
+                /**
+                 * @brief Test whether the document has a value at the path.
+                 */
+                inline bool IsFound() const;
+
+                /**
+                 * @brief Test whether the value is missing or \c null.
+                 */
+                inline bool IsNull() const;
+
+                /**
+                 * @brief Get the type of the value.
+                 */
+                inline Type GetType() const;
+
+                /**
+                 * @brief Get the JSON text of the value, e.g. \c "abc" with the quotes or <tt>{"a":1}</tt>.
+                 * @return The text, or a null view if the field is missing.
+                 */
+                inline CurlStringView GetRaw() const;
+
+                /**
+                 * @brief Get the characters of a string value without the quotes and without decoding escapes.
+                 * @remark This is the text of the string itself if \c HasEscapes() is \c false. Throws
+                 *      \c std::invalid_argument if the value is not a string.
+                 */
+                CurlStringView GetRawString() const;
+
+                /**
+                 * @brief Test whether the value is a string that has escape sequences.
+                 */
+                inline bool HasEscapes() const;
+
+                /**
+                 * @brief Get a string value with its escape sequences decoded.
+                 * @remark Throws \c std::invalid_argument if the value is not a string.
+                 */
+                std::string GetString() const;
+
+                /**
+                 * @brief Get a boolean value. Throws \c std::invalid_argument if the value is not a boolean.
+                 */
+                bool GetBool() const;
+
+                /**
+                 * @brief Get a number as an integer.
+                 * @remark Throws \c std::invalid_argument if the value is not a number without a fraction or an
+                 *      exponent, or does not fit.
+                 */
+                int64_t GetInt64() const;
+
+                /**
+                 * @brief Get a number as a double. Throws \c std::invalid_argument if the value is not a number.
+                 */
+                double GetDouble() const;
+        };
+
+        /**
+         * @brief Extracts the values at a fixed set of JSON pointers from a document without parsing all of it.
+         * @remark The paths are JSON pointers (RFC 6901) such as \c /errorMessage or \c /items/0/id, compiled once
+         *      by the constructor. \c Extract() scans the document once; it descends only into the members and
+         *      elements that lead to a path and skips everything else by matching brackets and quotes, and it
+         *      stops as soon as every path has been found. No memory is allocated while extracting and the
+         *      values are not converted, so reading two fields from a large response costs little more than
+         *      reading the bytes up to them.
+         *
+         *      Only the parts that are scanned are checked for syntax errors, and skipped values are checked
+         *      loosely. If a member appears twice in an object, the first one is used. Use a full parser when the
+         *      whole document must be valid. The extractor is not thread safe.
+         *
+         *      Given a \c CurlJsonIndex, the extractor walks its tokens instead of the text and steps over an
+         *      object or array that no path leads into in one step. Building the index reads the whole document, so
+         *      this pays off when the paths are far into a large document or some are missing, and costs more when
+         *      they are near the start.
+         *      <pre>
+         *      CurlJsonExtractor extractor({ "/inputValue", "/errorMessage" });
+         *      curl.Execute();
+         *      extractor.Extract(curl.GetReceiveBuffer());
+         *      if (extractor[1].IsNull()) ... extractor[0].GetRaw() ...
+         *      </pre>
+         */
+        class CurlJsonExtractor
+        {
+            private:
+                /**
+                 * @brief Node of the tree of paths. The root is the whole document.
+                 */
+                struct Node
+                {
+                    std::string name; ///< Member name or array index that leads to the node from its parent.
+                    size_t index; ///< The name as an array index, or \c SIZE_MAX if it is not one.
+                    size_t firstChild; ///< Index of the first child node, or 0 if there is none.
+                    size_t nextSibling; ///< Index of the next node with the same parent, or 0 if there is none.
+                    size_t field; ///< Index of the field that receives the value, or \c SIZE_MAX.
+                };
+
+            private:
+                std::vector<Node> _nodes; ///< The tree of paths; the root is the first node.
+                std::vector<CurlJsonField> _fields; ///< The values, in the order of the paths.
+                std::vector<std::pair<size_t, size_t>> _duplicates; ///< Paths given more than once: field, first field.
+                size_t _remaining; ///< Number of paths that were not found yet during a scan.
+                const char* _begin; ///< Start of the document being scanned.
+                const char* _end; ///< End of the document being scanned.
+                const CurlJsonIndex* _index; ///< The index being walked, if any.
+
+            public:
+                /**
+                 * @brief Compile a set of JSON pointers.
+                 * @remark Throws \c std::invalid_argument if a pointer is not empty and does not start with a slash,
+                 *      or has an escape other than \c ~0 and \c ~1.
+                 */
+                explicit CurlJsonExtractor(const std::vector<std::string>& pointers);
+
+            public:
+                /**
+                 * @brief Extract the values at the paths from a document.
+                 * @return The number of paths that have a value.
+                 * @remark Throws \c std::invalid_argument for syntax errors in the scanned part of the document.
+                 *      The fields refer to the document and are valid until it changes or the next extraction.
+                 */
+                size_t Extract(const char* data, size_t sizeBytes);
+
+                /**
+                 * @brief Extract the values at the paths from a receive buffer.
+                 */
+                inline size_t Extract(const std::vector<unsigned char>& body);
+
+                /**
+                 * @brief Extract the values at the paths from a document that was indexed with \c CurlJsonIndex.
+                 * @return The number of paths that have a value.
+                 * @remark Throws \c std::invalid_argument for syntax errors in the scanned part of the document.
+                 *      The fields refer to the document and are valid until it changes or the next extraction.
+                 */
+                size_t Extract(const CurlJsonIndex& index);
+
+                /**
+                 * @brief Get the number of paths.
+                 */
+                inline size_t GetFieldCount() const;
+
+                /**
+                 * @brief Get the value at a path, by the position of the path in the list given to the constructor.
+                 */
+                inline const CurlJsonField& GetField(size_t index) const;
+
+                /**
+                 * @brief Get the value at a path, by the position of the path in the list given to the constructor.
+                 */
+                inline const CurlJsonField& operator[](size_t index) const;
+
+            private:
+                /**
+                 * @brief Forget the values of the previous extraction and start on a document.
+                 */
+                void StartExtract(const char* data, size_t sizeBytes);
+
+                /**
+                 * @brief Fill in the duplicate paths and count the values that were found.
+                 */
+                size_t FinishExtract();
+
+                /**
+                 * @brief Scan a value that leads to or is one of the paths.
+                 */
+                const char* ScanValue(const char* pos, size_t node);
+
+                /**
+                 * @brief Scan an object whose members lead to paths.
+                 */
+                const char* ScanObject(const char* pos, size_t node);
+
+                /**
+                 * @brief Scan an array whose elements lead to paths.
+                 */
+                const char* ScanArray(const char* pos, size_t node);
+
+                /**
+                 * @brief Skip a value that has nothing to do with the paths.
+                 */
+                const char* SkipValue(const char* pos);
+
+                /**
+                 * @brief Skip a string. \c pos is after the opening quote; returns the position after the closing
+                 *      quote.
+                 * @param escaped Set if the string has escape sequences.
+                 */
+                const char* SkipString(const char* pos, bool& escaped);
+
+                /**
+                 * @brief Scan the value at a token of the index that leads to or is one of the paths.
+                 * @return The token after the value.
+                 */
+                size_t ScanIndexedValue(size_t token, size_t node);
+
+                /**
+                 * @brief Scan an object of the index whose members lead to paths.
+                 */
+                size_t ScanIndexedObject(size_t token, size_t node);
+
+                /**
+                 * @brief Scan an array of the index whose elements lead to paths.
+                 */
+                size_t ScanIndexedArray(size_t token, size_t node);
+
+                /**
+                 * @brief Skip the value at a token of the index.
+                 * @return The token after the value.
+                 */
+                size_t SkipIndexedValue(size_t token) const;
+
+                /**
+                 * @brief Get the end of the text of a string, number or literal token of the index.
+                 */
+                const char* IndexedScalarEnd(size_t token) const;
+
+                /**
+                 * @brief Get the first character of a token of the index, or a NUL character past the last token.
+                 */
+                inline char IndexedChar(size_t token) const;
+
+                /**
+                 * @brief Find the child of a node for a member name as it appears in the document.
+                 * @return The index of the child, or 0 if no path continues with the name.
+                 */
+                size_t FindMember(size_t node, const char* name, size_t nameSize, bool escaped) const;
+
+                /**
+                 * @brief Skip white space.
+                 */
+                inline const char* SkipSpace(const char* pos) const;
+
+                /**
+                 * @brief Throw a \c std::invalid_argument for a syntax error at \c pos.
+                 */
+                void ThrowSyntaxError(const char* pos, const char* message) const;
+        };
+
+        inline bool CurlJsonField::IsFound() const
+        {
+            return this->_type != MISSING;
+        }
+
+        inline bool CurlJsonField::IsNull() const
+        {
+            return (this->_type == MISSING) || (this->_type == NULL_VALUE);
+        }
+
+        inline CurlJsonField::Type CurlJsonField::GetType() const
+        {
+            return this->_type;
+        }
+
+        inline CurlStringView CurlJsonField::GetRaw() const
+        {
+            return this->_raw;
+        }
+
+        inline bool CurlJsonField::HasEscapes() const
+        {
+            return this->_escaped;
+        }
+
+        inline size_t CurlJsonExtractor::Extract(const std::vector<unsigned char>& body)
+        {
+            return Extract(reinterpret_cast<const char*>(body.data()), body.size());
+        }
+
+        inline size_t CurlJsonExtractor::GetFieldCount() const
+        {
+            return this->_fields.size();
+        }
+
+        inline const CurlJsonField& CurlJsonExtractor::GetField(size_t index) const
+        {
+            return this->_fields.at(index);
+        }
+
+        inline const CurlJsonField& CurlJsonExtractor::operator[](size_t index) const
+        {
+            return this->_fields[index];
+        }
+
+        inline char CurlJsonExtractor::IndexedChar(size_t token) const
+        {
+            return (token < this->_index->GetTokenCount()) ? this->_begin[this->_index->GetToken(token).offset] : '\0';
+        }
+
+        inline const char* CurlJsonExtractor::SkipSpace(const char* pos) const
+        {
+            while ((pos < this->_end) && ((*pos == ' ') || (*pos == '\n') || (*pos == '\r') || (*pos == '\t')))
+            {
+                ++pos;
+            }
+            return pos;
+        }
+    } // namespace Web
+} // namespace AbcdEFramework
+
+#endif // CURL_JSON_EXTRACTOR_5D2C8E71A04F4B96A3E6F0B7C19D2E84
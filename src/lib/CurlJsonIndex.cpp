@@ -0,0 +1,233 @@
+/**
+ * @file
+ * @brief Definition of the CurlJsonIndex methods.
+ * @date 2026-10-19 [JFDR] Created.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include "CurlJsonIndex.hpp"
+#include "CurlTextScan.hpp"
+
+namespace
+{
+    using AbcdEFramework::Web::CurlTextScan;
+
+    const size_t BatchBlocks = 16u; ///< Number of blocks classified at a time.
+    const uint64_t EvenBits = 0x5555555555555555ull; ///< Bits 0, 2, 4 and so on.
+
+    /**
+     * @brief Get the index of the lowest set bit. \c mask must not be zero.
+     */
+    inline unsigned LowestBit(uint64_t mask)
+    {
+#ifdef __GNUC__
+        return (unsigned)__builtin_ctzll(mask);
+#else
+        unsigned index = 0u;
+        while ((mask & 1u) == 0u)
+        {
+            mask >>= 1;
+            ++index;
+        }
+        return index;
+#endif
+    }
+
+    /**
+     * @brief Get the number of set bits.
+     */
+    inline unsigned PopCount(uint64_t mask)
+    {
+#ifdef __GNUC__
+        return (unsigned)__builtin_popcountll(mask);
+#else
+        unsigned count = 0u;
+        for ( ; mask != 0u; mask &= mask - 1u)
+        {
+            ++count;
+        }
+        return count;
+#endif
+    }
+
+    /**
+     * @brief Get a mask with bit \c n set if an odd number of bits up to and including \c n are set in \c mask.
+     * @remark Applied to the quotes, this gives the characters from each opening quote up to, but not including,
+     *      its closing quote.
+     */
+    inline uint64_t PrefixXor(uint64_t mask)
+    {
+        mask ^= mask << 1;
+        mask ^= mask << 2;
+        mask ^= mask << 4;
+        mask ^= mask << 8;
+        mask ^= mask << 16;
+        mask ^= mask << 32;
+        return mask;
+    }
+
+    /**
+     * @brief Find the characters that are escaped by a backslash.
+     * @param backslashes The backslashes in the block.
+     * @param carry Set if the first character of the block is escaped; receives the same for the next block.
+     * @remark The first backslash of a run escapes the second, the third the fourth and so on, so a character
+     *      after a run is escaped if the run is odd. Adding the starts of the runs that begin on odd bits to
+     *      the backslashes makes those runs carry out of their last bit; comparing with the even bits then tells
+     *      which characters after a backslash are escaped, for all runs at once.
+     */
+    inline uint64_t FindEscaped(uint64_t backslashes, uint64_t& carry)
+    {
+        backslashes &= ~carry;
+        uint64_t followsBackslash = (backslashes << 1) | carry;
+        uint64_t oddStarts = backslashes & ~EvenBits & ~followsBackslash;
+        uint64_t evenStarts = oddStarts + backslashes;
+        carry = (evenStarts < backslashes) ? 1u : 0u;
+        return (EvenBits ^ (evenStarts << 1)) & followsBackslash;
+    }
+
+    /**
+     * @brief Throw the exception for a syntax error.
+     */
+    void ThrowSyntaxError(const char* what, size_t offset)
+    {
+        char message[128];
+        std::snprintf(message, sizeof(message), "JSON syntax error at byte %lu: %s", (unsigned long)offset, what);
+        throw std::invalid_argument(message);
+    }
+}
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        CurlJsonIndex::CurlJsonIndex()
+            :   _count(0u),
+                _data(nullptr),
+                _size(0u)
+        {
+        }
+
+        void CurlJsonIndex::Build(const char* data, size_t sizeBytes)
+        {
+            if (sizeBytes >= UINT32_MAX)
+            {
+                throw std::length_error("JSON document too large to index");
+            }
+
+            this->_data = data;
+            this->_size = sizeBytes;
+            this->_count = 0u;
+            FindTokens();
+            MatchBrackets();
+        }
+
+        void CurlJsonIndex::FindTokens()
+        {
+            CurlJsonBlockMasks masks[BatchBlocks];
+            uint64_t escapeCarry = 0u;
+            uint64_t inStringCarry = 0u; // All ones if the previous block ended inside a string
+            uint64_t delimiterCarry = 1u; // Set if the previous block ended with a delimiter; the text starts with one
+
+            size_t blockCount = 0u;
+            for (size_t batchStart = 0u; batchStart < this->_size; batchStart += blockCount * CurlTextScan::BlockSize)
+            {
+                // Classify a batch of whole blocks, or the end of the text padded with spaces to a full block.
+                size_t remaining = this->_size - batchStart;
+                blockCount = remaining / CurlTextScan::BlockSize;
+                if (blockCount > 0u)
+                {
+                    blockCount = (blockCount < BatchBlocks) ? blockCount : BatchBlocks;
+                    CurlTextScan::ClassifyJsonBlocks(this->_data + batchStart, blockCount, masks);
+                }
+                else
+                {
+                    char tail[CurlTextScan::BlockSize];
+                    std::memset(tail, ' ', sizeof(tail));
+                    std::memcpy(tail, this->_data + batchStart, remaining);
+                    blockCount = 1u;
+                    CurlTextScan::ClassifyJsonBlocks(tail, 1u, masks);
+                }
+
+                // Each block adds at most one token per byte, and AppendTokens() writes up to three more.
+                if (this->_tokens.size() < this->_count + (blockCount * CurlTextScan::BlockSize) + 3u)
+                {
+                    this->_tokens.resize(std::max(this->_tokens.size() * 2u, this->_count + (BatchBlocks * CurlTextScan::BlockSize) + 3u));
+                }
+
+                for (size_t block = 0u; block < blockCount; ++block)
+                {
+                    const CurlJsonBlockMasks& blockMasks(masks[block]);
+                    uint64_t quotes = blockMasks.quotes & ~FindEscaped(blockMasks.backslashes, escapeCarry);
+                    uint64_t inString = PrefixXor(quotes) ^ inStringCarry;
+                    inStringCarry = (uint64_t)((int64_t)inString >> 63);
+
+                    // Numbers and literals start after a delimiter; everything else outside strings is one.
+                    uint64_t delimiters = blockMasks.operators | blockMasks.whiteSpace | quotes;
+                    uint64_t scalarStarts = ~(delimiters | blockMasks.quotes) & ((delimiters << 1) | delimiterCarry) & ~inString;
+                    delimiterCarry = delimiters >> 63;
+
+                    // An opening quote is the first character inside its string.
+                    uint64_t tokens = (blockMasks.operators & ~inString) | (quotes & inString) | scalarStarts;
+                    AppendTokens(tokens, (uint32_t)(batchStart + (block * CurlTextScan::BlockSize)));
+                }
+            }
+
+            if (inStringCarry != 0u)
+            {
+                ThrowSyntaxError("unterminated string", this->_size);
+            }
+        }
+
+        void CurlJsonIndex::AppendTokens(uint64_t tokens, uint32_t blockOffset)
+        {
+            // Four tokens per round without a branch per token. Up to three slots past the last token are written;
+            // FindTokens() leaves room for them and they are overwritten by the next block.
+            size_t count = (size_t)PopCount(tokens);
+            Token* out = this->_tokens.data() + this->_count;
+            for (size_t index = 0u; index < count; index += 4u)
+            {
+                out[index].offset = blockOffset + LowestBit(tokens);
+                tokens &= tokens - 1u;
+                out[index + 1u].offset = blockOffset + LowestBit(tokens | ((uint64_t)1u << 63));
+                tokens &= tokens - 1u;
+                out[index + 2u].offset = blockOffset + LowestBit(tokens | ((uint64_t)1u << 63));
+                tokens &= tokens - 1u;
+                out[index + 3u].offset = blockOffset + LowestBit(tokens | ((uint64_t)1u << 63));
+                tokens &= tokens - 1u;
+            }
+            this->_count += count;
+        }
+
+        void CurlJsonIndex::MatchBrackets()
+        {
+            this->_openBrackets.clear();
+            for (size_t index = 0u; index < this->_count; ++index)
+            {
+                Token& token(this->_tokens[index]);
+                char ch = this->_data[token.offset];
+                if (('{' == ch) || ('[' == ch))
+                {
+                    this->_openBrackets.push_back((uint32_t)index);
+                }
+                else if (('}' == ch) || (']' == ch))
+                {
+                    if (this->_openBrackets.empty() || (this->_data[this->_tokens[this->_openBrackets.back()].offset] != ((']' == ch) ? '[' : '{')))
+                    {
+                        ThrowSyntaxError("unmatched bracket", token.offset);
+                    }
+                    token.match = this->_openBrackets.back();
+                    this->_tokens[token.match].match = (uint32_t)index;
+                    this->_openBrackets.pop_back();
+                }
+            }
+
+            if (!this->_openBrackets.empty())
+            {
+                ThrowSyntaxError("unclosed bracket", this->_tokens[this->_openBrackets.back()].offset);
+            }
+        }
+    } // namespace Web
+} // namespace AbcdEFramework
@@ -0,0 +1,134 @@
+/**
+ * @file
+ * @brief Declaration of the CurlJsonIndex class.
+ * @date 2026-10-19 [JFDR] Created.
+ */
+#if !defined CURL_JSON_INDEX_0B7E4D92C5A1483F9E26D8F1A3C07B5D
+#define CURL_JSON_INDEX_0B7E4D92C5A1483F9E26D8F1A3C07B5D 1
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        /**
+         * @brief Index of the tokens of a JSON document, built with the vectorised kernels of \c CurlTextScan.
+         * @remark This is the first stage of a simdjson style parser. The text is classified 64 bytes at a time into
+         *      bit masks of quotes, backslashes, structural characters and white space; escaped quotes and the
+         *      insides of strings are then removed with bit arithmetic, without a branch per byte. What is left is
+         *      the offset of every token: each structural character outside a string, each opening quote and the
+         *      first character of each number and literal. A second pass pairs every \c { and \c [ with its
+         *      closing bracket, so that a reader can step over a whole object or array in one step.
+         *
+         *      \c CurlJsonExtractor walks the index instead of the text when it is given one. Building the index
+         *      checks that strings are terminated and brackets match; the tokens themselves are not validated.
+         *      The index refers to the text by offset and does not keep it; the vectors are reused by the next
+         *      \c Build(), so an index that is kept for similar responses stops allocating.
+         */
+        class CurlJsonIndex
+        {
+            public:
+                /**
+                 * @brief A token of the document.
+                 */
+                struct Token
+                {
+                    uint32_t offset; ///< Offset of the first character of the token.
+                    uint32_t match; ///< For a bracket, the number of the token of the matching bracket; else undefined.
+                };
+
+            private:
+                std::vector<Token> _tokens; ///< The tokens; only the first \c _count are in use.
+                size_t _count; ///< Number of tokens.
+                std::vector<uint32_t> _openBrackets; ///< Tokens of the brackets that are open while matching.
+                const char* _data; ///< The text that was indexed.
+                size_t _size; ///< Number of characters in the text.
+
+            public:
+                /**
+                 * @brief Construct an empty index.
+                 */
+                CurlJsonIndex();
+
+            public:
+                /**
+                 * @brief Index a document.
+                 * @remark Throws \c std::invalid_argument if a string is not terminated or the brackets do not
+                 *      match, and \c std::length_error if the document is 4 GB or larger.
+                 */
+                void Build(const char* data, size_t sizeBytes);
+
+                /**
+                 * @brief Index a receive buffer.
+                 */
+                inline void Build(const std::vector<unsigned char>& body);
+
+                /**
+                 * @brief Get the text that was indexed. It must still be valid to be read.
+                 */
+                inline const char* GetData() const;
+
+                /**
+                 * @brief Get the number of characters in the text.
+                 */
+                inline size_t GetSize() const;
+
+                /**
+                 * @brief Get the number of tokens.
+                 */
+                inline size_t GetTokenCount() const;
+
+                /**
+                 * @brief Get a token.
+                 */
+                inline const Token& GetToken(size_t index) const;
+
+            private:
+                /**
+                 * @brief Find the tokens with the vectorised kernels.
+                 */
+                void FindTokens();
+
+                /**
+                 * @brief Append the tokens of a block.
+                 * @param tokens Bit \c n is set if a token starts at byte \c n of the block.
+                 */
+                void AppendTokens(uint64_t tokens, uint32_t blockOffset);
+
+                /**
+                 * @brief Pair the brackets.
+                 */
+                void MatchBrackets();
+        };
+
+        inline void CurlJsonIndex::Build(const std::vector<unsigned char>& body)
+        {
+            Build(reinterpret_cast<const char*>(body.data()), body.size());
+        }
+
+        inline const char* CurlJsonIndex::GetData() const
+        {
+            return this->_data;
+        }
+
+        inline size_t CurlJsonIndex::GetSize() const
+        {
+            return this->_size;
+        }
+
+        inline size_t CurlJsonIndex::GetTokenCount() const
+        {
+            return this->_count;
+        }
+
+        inline const CurlJsonIndex::Token& CurlJsonIndex::GetToken(size_t index) const
+        {
+            return this->_tokens[index];
+        }
+    } // namespace Web
+} // namespace AbcdEFramework
+
+#endif // CURL_JSON_INDEX_0B7E4D92C5A1483F9E26D8F1A3C07B5D
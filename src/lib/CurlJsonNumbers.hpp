@@ -0,0 +1,106 @@
+/**
+ * @file
+ * @brief Declaration of the CurlJsonNumbers class.
+ * @date 2026-10-19 [JFDR] Created.
+ */
+#if !defined CURL_JSON_NUMBERS_3F8A1C6E92D04B7B85E1A4C0D7269F13
+#define CURL_JSON_NUMBERS_3F8A1C6E92D04B7B85E1A4C0D7269F13 1
+
+#include <cstddef>
+#include <cstdint>
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        /**
+         * @brief Conversion of JSON numbers to and from text without \c snprintf() and \c strtod().
+         * @remark Doubles are printed with Grisu2: the shortest digits that read back as the same double in nearly
+         *      all cases, and never more than 17. The layout is that of <tt>%.15g</tt> with \c .0 added to whole
+         *      numbers, which is what \c json::dump() printed before, but without losing the last digits. Doubles
+         *      are read with the Eisel-Lemire algorithm, which gives the correctly rounded double for up to 19
+         *      significant digits from one or two 64 bit multiplications. Integers are printed two digits at a
+         *      time. None of it depends on the locale.
+         *
+         *      Build with \c AEF_JSON_FAST_NUMBERS defined to make \c json.hpp use these in \c dump() and
+         *      \c parse(); the programs in this repository do. The \c Try functions return \c false when they
+         *      cannot convert the value, so that the caller can fall back on the C library: a double that is not
+         *      finite, a number with more than 19 digits that Eisel-Lemire cannot round on its own, or an integer
+         *      that does not fit. They also return \c false for types other than \c double, \c int64_t and
+         *      \c uint64_t.
+         */
+        class CurlJsonNumbers
+        {
+            public:
+                /**
+                 * @brief Size of a buffer that any number printed by \c TryFormat() fits in, with the NUL character.
+                 */
+                static const size_t MaxFormattedSize = 32u;
+
+            public:
+                /**
+                 * @brief Print a double, e.g. \c 0.1, \c 2.0, \c -1.5e-07 or \c 1e+300.
+                 * @param buffer Receives the text and a NUL character; at least \c MaxFormattedSize bytes.
+                 * @return \c false if the value is not finite.
+                 */
+                static bool TryFormat(double value, char* buffer);
+
+                /**
+                 * @brief Print a signed integer.
+                 */
+                static bool TryFormat(int64_t value, char* buffer);
+
+                /**
+                 * @brief Print an unsigned integer.
+                 */
+                static bool TryFormat(uint64_t value, char* buffer);
+
+                /**
+                 * @brief Print another type: not handled.
+                 */
+                template<typename T>
+                static inline bool TryFormat(T value, char* buffer);
+
+                /**
+                 * @brief Read a JSON number as a double.
+                 * @param begin First character of the number, which must be valid JSON.
+                 * @param end Position after the last character.
+                 * @return \c false if the digits after the 19th could change the rounding; the value is then
+                 *      undefined.
+                 */
+                static bool TryParse(const char* begin, const char* end, double& value);
+
+                /**
+                 * @brief Read a JSON integer as a signed integer.
+                 * @return \c false if the text is not an integer or does not fit.
+                 */
+                static bool TryParse(const char* begin, const char* end, int64_t& value);
+
+                /**
+                 * @brief Read a JSON integer as an unsigned integer.
+                 * @return \c false if the text is not an integer without a sign or does not fit.
+                 */
+                static bool TryParse(const char* begin, const char* end, uint64_t& value);
+
+                /**
+                 * @brief Read another type: not handled.
+                 */
+                template<typename T>
+                static inline bool TryParse(const char* begin, const char* end, T& value);
+        };
+
+        template<typename T>
+        inline bool CurlJsonNumbers::TryFormat(T, char*)
+        {
+            return false;
+        }
+
+        template<typename T>
+        inline bool CurlJsonNumbers::TryParse(const char*, const char*, T&)
+        {
+            return false;
+        }
+    } // namespace Web
+} // namespace AbcdEFramework
+
+#endif // CURL_JSON_NUMBERS_3F8A1C6E92D04B7B85E1A4C0D7269F13
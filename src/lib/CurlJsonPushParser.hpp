@@ -0,0 +1,811 @@
+/**
+ * @file
+ * @brief Declaration of the CurlJsonPushParser class template.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] The key and token buffers are std::string, so they do not come from an arena.
+ */
+#if !defined CURL_JSON_PUSH_PARSER_5C8E1A4F7B2D4039A6E0D93F14B7C258
+#define CURL_JSON_PUSH_PARSER_5C8E1A4F7B2D4039A6E0D93F14B7C258 1
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        /**
+         * @brief Parses JSON text that arrives in chunks into a \c nlohmann::basic_json value.
+         * @remark The parser of \c json.hpp needs the whole text before it starts. This one keeps its state between
+         *      calls to \c Feed(), so a body can be parsed while it is received, and builds the value in place with
+         *      the types of \c JsonType. Nesting is tracked on an explicit stack, so deep documents do not use the
+         *      call stack. The result is the same as \c JsonType::parse() on the concatenated text: non-negative
+         *      integers are stored as unsigned numbers, negative ones as signed numbers, integers that do not fit
+         *      and other numbers as floating point numbers, and the last of duplicate object keys wins.
+         */
+        template <typename JsonType>
+        class CurlJsonPushParser
+        {
+            private:
+                typedef typename JsonType::value_t ValueType;
+                typedef typename JsonType::string_t StringType;
+                typedef typename JsonType::object_t ObjectType;
+                typedef typename JsonType::array_t ArrayType;
+                typedef typename JsonType::number_integer_t IntegerType;
+                typedef typename JsonType::number_unsigned_t UnsignedType;
+                typedef typename JsonType::number_float_t FloatType;
+
+                /**
+                 * @brief What the parser expects next.
+                 */
+                enum State
+                {
+                    EXPECT_VALUE, ///< Any value.
+                    EXPECT_VALUE_OR_ARRAY_END, ///< The first value of an array, or the end of an empty one.
+                    EXPECT_KEY_OR_OBJECT_END, ///< The first key of an object, or the end of an empty one.
+                    EXPECT_KEY, ///< A key after a comma.
+                    EXPECT_COLON, ///< The colon after a key.
+                    EXPECT_COMMA_OR_END, ///< A comma or the end of the innermost array or object.
+                    IN_STRING, ///< The characters of a string.
+                    IN_STRING_ESCAPE, ///< The character after a backslash.
+                    IN_STRING_UNICODE, ///< The four hexadecimal digits of a \c \\u escape.
+                    IN_STRING_SURROGATE_ESCAPE, ///< The backslash of the escape of a low surrogate.
+                    IN_STRING_SURROGATE_U, ///< The \c u of the escape of a low surrogate.
+                    IN_NUMBER, ///< The characters of a number.
+                    IN_LITERAL, ///< The characters of \c true, \c false or \c null.
+                    DONE ///< The value is complete; only white space may follow.
+                };
+
+                /**
+                 * @brief An array or object that is not complete yet.
+                 */
+                struct Frame
+                {
+                    JsonType* value; ///< The array or object, inside its parent.
+                    bool isObject; ///< \c true for an object.
+                };
+
+            private:
+                JsonType _root; ///< The value being built.
+                std::vector<Frame> _stack; ///< The open arrays and objects, innermost last.
+                // Kept on the heap even for a JsonType with an arena allocator, because the parser outlives a
+                // CurlArena::Reset() and keeps the capacity of these buffers from one document to the next.
+                std::string _key; ///< The key of the value that is parsed next in an object.
+                std::string _token; ///< The characters of the current string or number.
+                State _state; ///< What the parser expects next.
+                bool _stringIsKey; ///< \c true if the current string is an object key.
+                const char* _literal; ///< The literal being matched.
+                size_t _literalPos; ///< Number of characters of \c _literal matched so far.
+                unsigned _codeUnit; ///< The value of the \c \\u escape being read.
+                unsigned _hexDigits; ///< Number of hexadecimal digits of \c _codeUnit read so far.
+                unsigned _highSurrogate; ///< High surrogate waiting for its low surrogate, or zero.
+                size_t _consumed; ///< Number of bytes passed to \c Feed() before the current chunk.
+
+            public:
+                /**
+                 * @brief Constructor.
+                 */
+                CurlJsonPushParser();
+
+            public:
+                /**
+                 * @brief Parse the next chunk of the text.
+                 * @remark Throws \c std::invalid_argument if the text is not valid JSON. The parser must be reset
+                 *      before it is used again.
+                 */
+                void Feed(const char* data, size_t sizeBytes);
+
+                /**
+                 * @brief Signal the end of the text.
+                 * @remark Completes a number at the end of the text. Throws \c std::invalid_argument if the text
+                 *      ended before the value was complete.
+                 */
+                void Finish();
+
+                /**
+                 * @brief Test whether a complete value was parsed.
+                 * @remark A number at the top level is only complete once \c Finish() was called.
+                 */
+                inline bool IsComplete() const;
+
+                /**
+                 * @brief Get the value that was parsed. It is incomplete until \c IsComplete() returns \c true.
+                 */
+                inline const JsonType& GetValue() const;
+
+                /**
+                 * @brief Move the value out of the parser. The parser must be reset before it is used again.
+                 */
+                inline JsonType TakeValue();
+
+                /**
+                 * @brief Discard the value and the state so that another text can be parsed.
+                 * @remark The buffers of the parser keep their capacity.
+                 */
+                void Reset();
+
+            private:
+                /**
+                 * @brief Store a value in the innermost array or object, or as the root.
+                 * @return The stored value.
+                 */
+                JsonType* AddValue(JsonType&& value);
+
+                /**
+                 * @brief Move to the state after a complete value.
+                 */
+                inline void ValueDone();
+
+                /**
+                 * @brief Open an array or object.
+                 */
+                void OpenContainer(bool isObject);
+
+                /**
+                 * @brief Close the innermost array or object if it matches \c closer.
+                 */
+                void CloseContainer(char closer, size_t offset);
+
+                /**
+                 * @brief Store the string in \c _token as a key or a value.
+                 */
+                void FinishString();
+
+                /**
+                 * @brief Convert the number in \c _token and store it.
+                 */
+                void FinishNumber(size_t offset);
+
+                /**
+                 * @brief Append a code point to \c _token as UTF-8.
+                 */
+                void AppendCodePoint(unsigned codePoint);
+
+                /**
+                 * @brief Start a value with its first character.
+                 * @return \c false if no value starts with \c ch.
+                 */
+                bool StartValue(char ch);
+
+                /**
+                 * @brief Test for the white space that may appear between tokens.
+                 */
+                static inline bool IsWhiteSpace(char ch);
+
+                /**
+                 * @brief Test for a decimal digit.
+                 */
+                static inline bool IsDigit(char ch);
+
+                /**
+                 * @brief Get the value of a hexadecimal digit, or -1.
+                 */
+                static inline int HexValue(char ch);
+
+                /**
+                 * @brief Test whether \c text follows the grammar of a JSON number.
+                 * @param isInteger Receives \c true if the number has no fraction and no exponent.
+                 */
+                static bool IsValidNumber(const std::string& text, bool& isInteger);
+
+                /**
+                 * @brief Throw the exception for a syntax error.
+                 */
+                static void ThrowSyntaxError(const char* what, size_t offset);
+        };
+
+        template <typename JsonType>
+        CurlJsonPushParser<JsonType>::CurlJsonPushParser()
+            :   _state(EXPECT_VALUE),
+                _stringIsKey(false),
+                _literal(nullptr),
+                _literalPos(0u),
+                _codeUnit(0u),
+                _hexDigits(0u),
+                _highSurrogate(0u),
+                _consumed(0u)
+        {
+        }
+
+        template <typename JsonType>
+        void CurlJsonPushParser<JsonType>::Feed(const char* data, size_t sizeBytes)
+        {
+            const char* pos = data;
+            const char* end = data + sizeBytes;
+            while (pos < end)
+            {
+                switch (this->_state)
+                {
+                    case IN_STRING:
+                    {
+                        // Copy the run of plain characters at once; most of a document is inside strings.
+                        const char* run = pos;
+                        while ((run < end) && (*run != '"') && (*run != '\\') && ((unsigned char)*run >= 0x20u))
+                        {
+                            ++run;
+                        }
+                        this->_token.append(pos, (size_t)(run - pos));
+                        pos = run;
+                        if (pos == end)
+                        {
+                            break;
+                        }
+
+                        char ch = *pos;
+                        if ('"' == ch)
+                        {
+                            ++pos;
+                            FinishString();
+                        }
+                        else if ('\\' == ch)
+                        {
+                            ++pos;
+                            this->_state = IN_STRING_ESCAPE;
+                        }
+                        else
+                        {
+                            ThrowSyntaxError("control character in string", this->_consumed + (size_t)(pos - data));
+                        }
+                        break;
+                    }
+
+                    case IN_STRING_ESCAPE:
+                    {
+                        char ch = *pos;
+                        char decoded;
+                        switch (ch)
+                        {
+                            case '"': decoded = '"'; break;
+                            case '\\': decoded = '\\'; break;
+                            case '/': decoded = '/'; break;
+                            case 'b': decoded = '\b'; break;
+                            case 'f': decoded = '\f'; break;
+                            case 'n': decoded = '\n'; break;
+                            case 'r': decoded = '\r'; break;
+                            case 't': decoded = '\t'; break;
+                            case 'u': decoded = '\0'; break;
+                            default:
+                                ThrowSyntaxError("invalid escape", this->_consumed + (size_t)(pos - data));
+                                return;
+                        }
+
+                        if ('u' == ch)
+                        {
+                            this->_codeUnit = 0u;
+                            this->_hexDigits = 0u;
+                            this->_state = IN_STRING_UNICODE;
+                        }
+                        else
+                        {
+                            this->_token.push_back(decoded);
+                            this->_state = IN_STRING;
+                        }
+                        ++pos;
+                        break;
+                    }
+
+                    case IN_STRING_UNICODE:
+                    {
+                        int digit = HexValue(*pos);
+                        if (digit < 0)
+                        {
+                            ThrowSyntaxError("invalid \\u escape", this->_consumed + (size_t)(pos - data));
+                        }
+                        ++pos;
+                        this->_codeUnit = (this->_codeUnit << 4) | (unsigned)digit;
+                        if (++this->_hexDigits < 4u)
+                        {
+                            break;
+                        }
+
+                        unsigned codeUnit = this->_codeUnit;
+                        if (this->_highSurrogate != 0u)
+                        {
+                            if ((codeUnit < 0xDC00u) || (codeUnit > 0xDFFFu))
+                            {
+                                ThrowSyntaxError("missing low surrogate", this->_consumed + (size_t)(pos - data));
+                            }
+                            AppendCodePoint(0x10000u + ((this->_highSurrogate - 0xD800u) << 10) + (codeUnit - 0xDC00u));
+                            this->_highSurrogate = 0u;
+                            this->_state = IN_STRING;
+                        }
+                        else if ((codeUnit >= 0xD800u) && (codeUnit <= 0xDBFFu))
+                        {
+                            this->_highSurrogate = codeUnit;
+                            this->_state = IN_STRING_SURROGATE_ESCAPE;
+                        }
+                        else if ((codeUnit >= 0xDC00u) && (codeUnit <= 0xDFFFu))
+                        {
+                            ThrowSyntaxError("low surrogate without high surrogate", this->_consumed + (size_t)(pos - data));
+                        }
+                        else
+                        {
+                            AppendCodePoint(codeUnit);
+                            this->_state = IN_STRING;
+                        }
+                        break;
+                    }
+
+                    case IN_STRING_SURROGATE_ESCAPE:
+                    case IN_STRING_SURROGATE_U:
+                    {
+                        char expected = (IN_STRING_SURROGATE_ESCAPE == this->_state) ? '\\' : 'u';
+                        if (*pos != expected)
+                        {
+                            ThrowSyntaxError("missing low surrogate", this->_consumed + (size_t)(pos - data));
+                        }
+                        ++pos;
+                        if (IN_STRING_SURROGATE_ESCAPE == this->_state)
+                        {
+                            this->_state = IN_STRING_SURROGATE_U;
+                        }
+                        else
+                        {
+                            this->_codeUnit = 0u;
+                            this->_hexDigits = 0u;
+                            this->_state = IN_STRING_UNICODE;
+                        }
+                        break;
+                    }
+
+                    case IN_NUMBER:
+                    {
+                        // Collect the characters that can be part of a number; the grammar is checked at the end.
+                        const char* run = pos;
+                        while ((run < end) && (IsDigit(*run) || ('.' == *run) || ('e' == *run) || ('E' == *run) || ('+' == *run) || ('-' == *run)))
+                        {
+                            ++run;
+                        }
+                        this->_token.append(pos, (size_t)(run - pos));
+                        pos = run;
+                        if (pos < end)
+                        {
+                            // The character after the number is handled in the next state.
+                            FinishNumber(this->_consumed + (size_t)(pos - data));
+                        }
+                        break;
+                    }
+
+                    case IN_LITERAL:
+                    {
+                        if (*pos != this->_literal[this->_literalPos])
+                        {
+                            ThrowSyntaxError("invalid literal", this->_consumed + (size_t)(pos - data));
+                        }
+                        ++pos;
+                        if ('\0' == this->_literal[++this->_literalPos])
+                        {
+                            switch (this->_literal[0])
+                            {
+                                case 't': AddValue(JsonType(true)); break;
+                                case 'f': AddValue(JsonType(false)); break;
+                                default: AddValue(JsonType(nullptr)); break;
+                            }
+                            ValueDone();
+                        }
+                        break;
+                    }
+
+                    default:
+                    {
+                        char ch = *pos;
+                        if (IsWhiteSpace(ch))
+                        {
+                            ++pos;
+                            break;
+                        }
+
+                        size_t offset = this->_consumed + (size_t)(pos - data);
+                        ++pos;
+                        switch (this->_state)
+                        {
+                            case EXPECT_VALUE_OR_ARRAY_END:
+                                if (']' == ch)
+                                {
+                                    CloseContainer(ch, offset);
+                                    break;
+                                }
+                                // Fall through
+                            case EXPECT_VALUE:
+                                if (!StartValue(ch))
+                                {
+                                    ThrowSyntaxError("unexpected character", offset);
+                                }
+                                break;
+
+                            case EXPECT_KEY_OR_OBJECT_END:
+                            case EXPECT_KEY:
+                                if (('}' == ch) && (EXPECT_KEY_OR_OBJECT_END == this->_state))
+                                {
+                                    CloseContainer(ch, offset);
+                                }
+                                else if ('"' == ch)
+                                {
+                                    this->_token.clear();
+                                    this->_stringIsKey = true;
+                                    this->_state = IN_STRING;
+                                }
+                                else
+                                {
+                                    ThrowSyntaxError("expected a key", offset);
+                                }
+                                break;
+
+                            case EXPECT_COLON:
+                                if (ch != ':')
+                                {
+                                    ThrowSyntaxError("expected ':'", offset);
+                                }
+                                this->_state = EXPECT_VALUE;
+                                break;
+
+                            case EXPECT_COMMA_OR_END:
+                                if (',' == ch)
+                                {
+                                    this->_state = this->_stack.back().isObject ? EXPECT_KEY : EXPECT_VALUE;
+                                }
+                                else
+                                {
+                                    CloseContainer(ch, offset);
+                                }
+                                break;
+
+                            default:
+                                ThrowSyntaxError("unexpected character after the value", offset);
+                                break;
+                        }
+                        break;
+                    }
+                }
+            }
+
+            this->_consumed += sizeBytes;
+        }
+
+        template <typename JsonType>
+        void CurlJsonPushParser<JsonType>::Finish()
+        {
+            if (IN_NUMBER == this->_state)
+            {
+                FinishNumber(this->_consumed);
+            }
+
+            if (this->_state != DONE)
+            {
+                ThrowSyntaxError("unexpected end of input", this->_consumed);
+            }
+        }
+
+        template <typename JsonType>
+        inline bool CurlJsonPushParser<JsonType>::IsComplete() const
+        {
+            return DONE == this->_state;
+        }
+
+        template <typename JsonType>
+        inline const JsonType& CurlJsonPushParser<JsonType>::GetValue() const
+        {
+            return this->_root;
+        }
+
+        template <typename JsonType>
+        inline JsonType CurlJsonPushParser<JsonType>::TakeValue()
+        {
+            return std::move(this->_root);
+        }
+
+        template <typename JsonType>
+        void CurlJsonPushParser<JsonType>::Reset()
+        {
+            this->_root = JsonType();
+            this->_stack.clear();
+            this->_key.clear();
+            this->_token.clear();
+            this->_state = EXPECT_VALUE;
+            this->_stringIsKey = false;
+            this->_literal = nullptr;
+            this->_literalPos = 0u;
+            this->_codeUnit = 0u;
+            this->_hexDigits = 0u;
+            this->_highSurrogate = 0u;
+            this->_consumed = 0u;
+        }
+
+        template <typename JsonType>
+        JsonType* CurlJsonPushParser<JsonType>::AddValue(JsonType&& value)
+        {
+            if (this->_stack.empty())
+            {
+                this->_root = std::move(value);
+                return &(this->_root);
+            }
+
+            // Only the innermost container grows, so the pointers to the outer ones on the stack stay valid.
+            const Frame& frame(this->_stack.back());
+            if (frame.isObject)
+            {
+                ObjectType& object(*(frame.value->template get_ptr<ObjectType*>()));
+                JsonType& slot(object[StringType(this->_key.data(), this->_key.size())]);
+                slot = std::move(value);
+                return &slot;
+            }
+
+            ArrayType& array(*(frame.value->template get_ptr<ArrayType*>()));
+            array.push_back(std::move(value));
+            return &(array.back());
+        }
+
+        template <typename JsonType>
+        inline void CurlJsonPushParser<JsonType>::ValueDone()
+        {
+            this->_state = this->_stack.empty() ? DONE : EXPECT_COMMA_OR_END;
+        }
+
+        template <typename JsonType>
+        void CurlJsonPushParser<JsonType>::OpenContainer(bool isObject)
+        {
+            Frame frame;
+            frame.value = AddValue(JsonType(isObject ? ValueType::object : ValueType::array));
+            frame.isObject = isObject;
+            this->_stack.push_back(frame);
+            this->_state = isObject ? EXPECT_KEY_OR_OBJECT_END : EXPECT_VALUE_OR_ARRAY_END;
+        }
+
+        template <typename JsonType>
+        void CurlJsonPushParser<JsonType>::CloseContainer(char closer, size_t offset)
+        {
+            if (closer != (this->_stack.back().isObject ? '}' : ']'))
+            {
+                ThrowSyntaxError("unexpected character", offset);
+            }
+            this->_stack.pop_back();
+            ValueDone();
+        }
+
+        template <typename JsonType>
+        void CurlJsonPushParser<JsonType>::FinishString()
+        {
+            if (this->_stringIsKey)
+            {
+                // Copied rather than swapped, so that both buffers keep their capacity.
+                this->_key.assign(this->_token);
+                this->_stringIsKey = false;
+                this->_state = EXPECT_COLON;
+            }
+            else
+            {
+                // The string is created in place and filled, so that it is copied once and with the allocator of
+                // JsonType.
+                JsonType* slot = AddValue(JsonType(ValueType::string));
+                slot->template get_ptr<StringType*>()->assign(this->_token.data(), this->_token.size());
+                ValueDone();
+            }
+        }
+
+        template <typename JsonType>
+        void CurlJsonPushParser<JsonType>::FinishNumber(size_t offset)
+        {
+            bool isInteger;
+            if (!IsValidNumber(this->_token, isInteger))
+            {
+                ThrowSyntaxError("invalid number", offset - this->_token.size());
+            }
+
+            if (isInteger)
+            {
+                // Accumulate the magnitude; if it overflows, the number is stored as floating point.
+                bool negative = ('-' == this->_token[0]);
+                UnsignedType magnitude = 0u;
+                bool overflow = false;
+                for (size_t index = negative ? 1u : 0u; index < this->_token.size(); ++index)
+                {
+                    UnsignedType digit = (UnsignedType)(this->_token[index] - '0');
+                    if (magnitude > (std::numeric_limits<UnsignedType>::max() - digit) / 10u)
+                    {
+                        overflow = true;
+                        break;
+                    }
+                    magnitude = (magnitude * 10u) + digit;
+                }
+
+                if (!overflow && !negative)
+                {
+                    AddValue(JsonType(magnitude));
+                    ValueDone();
+                    return;
+                }
+                if (!overflow && (magnitude <= (UnsignedType)std::numeric_limits<IntegerType>::max() + 1u))
+                {
+                    AddValue(JsonType((IntegerType)(0u - magnitude)));
+                    ValueDone();
+                    return;
+                }
+            }
+
+            AddValue(JsonType((FloatType)std::strtod(this->_token.c_str(), nullptr)));
+            ValueDone();
+        }
+
+        template <typename JsonType>
+        void CurlJsonPushParser<JsonType>::AppendCodePoint(unsigned codePoint)
+        {
+            if (codePoint < 0x80u)
+            {
+                this->_token.push_back((char)codePoint);
+            }
+            else if (codePoint < 0x800u)
+            {
+                this->_token.push_back((char)(0xC0u | (codePoint >> 6)));
+                this->_token.push_back((char)(0x80u | (codePoint & 0x3Fu)));
+            }
+            else if (codePoint < 0x10000u)
+            {
+                this->_token.push_back((char)(0xE0u | (codePoint >> 12)));
+                this->_token.push_back((char)(0x80u | ((codePoint >> 6) & 0x3Fu)));
+                this->_token.push_back((char)(0x80u | (codePoint & 0x3Fu)));
+            }
+            else
+            {
+                this->_token.push_back((char)(0xF0u | (codePoint >> 18)));
+                this->_token.push_back((char)(0x80u | ((codePoint >> 12) & 0x3Fu)));
+                this->_token.push_back((char)(0x80u | ((codePoint >> 6) & 0x3Fu)));
+                this->_token.push_back((char)(0x80u | (codePoint & 0x3Fu)));
+            }
+        }
+
+        template <typename JsonType>
+        bool CurlJsonPushParser<JsonType>::StartValue(char ch)
+        {
+            switch (ch)
+            {
+                case '{':
+                    OpenContainer(true);
+                    return true;
+
+                case '[':
+                    OpenContainer(false);
+                    return true;
+
+                case '"':
+                    this->_token.clear();
+                    this->_stringIsKey = false;
+                    this->_state = IN_STRING;
+                    return true;
+
+                case 't':
+                    this->_literal = "true";
+                    break;
+
+                case 'f':
+                    this->_literal = "false";
+                    break;
+
+                case 'n':
+                    this->_literal = "null";
+                    break;
+
+                default:
+                    if (('-' == ch) || IsDigit(ch))
+                    {
+                        this->_token.assign(1u, ch);
+                        this->_state = IN_NUMBER;
+                        return true;
+                    }
+                    return false;
+            }
+
+            this->_literalPos = 1u;
+            this->_state = IN_LITERAL;
+            return true;
+        }
+
+        template <typename JsonType>
+        inline bool CurlJsonPushParser<JsonType>::IsWhiteSpace(char ch)
+        {
+            return (' ' == ch) || ('\n' == ch) || ('\r' == ch) || ('\t' == ch);
+        }
+
+        template <typename JsonType>
+        inline bool CurlJsonPushParser<JsonType>::IsDigit(char ch)
+        {
+            return (ch >= '0') && (ch <= '9');
+        }
+
+        template <typename JsonType>
+        inline int CurlJsonPushParser<JsonType>::HexValue(char ch)
+        {
+            if (IsDigit(ch))
+            {
+                return ch - '0';
+            }
+            if ((ch >= 'a') && (ch <= 'f'))
+            {
+                return ch - 'a' + 10;
+            }
+            if ((ch >= 'A') && (ch <= 'F'))
+            {
+                return ch - 'A' + 10;
+            }
+            return -1;
+        }
+
+        template <typename JsonType>
+        bool CurlJsonPushParser<JsonType>::IsValidNumber(const std::string& text, bool& isInteger)
+        {
+            // -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+            size_t pos = 0u;
+            size_t size = text.size();
+            if ((pos < size) && ('-' == text[pos]))
+            {
+                ++pos;
+            }
+            if ((pos < size) && ('0' == text[pos]))
+            {
+                ++pos;
+            }
+            else if ((pos < size) && IsDigit(text[pos]))
+            {
+                while ((pos < size) && IsDigit(text[pos]))
+                {
+                    ++pos;
+                }
+            }
+            else
+            {
+                return false;
+            }
+
+            isInteger = true;
+            if ((pos < size) && ('.' == text[pos]))
+            {
+                isInteger = false;
+                size_t digitsStart = ++pos;
+                while ((pos < size) && IsDigit(text[pos]))
+                {
+                    ++pos;
+                }
+                if (pos == digitsStart)
+                {
+                    return false;
+                }
+            }
+            if ((pos < size) && (('e' == text[pos]) || ('E' == text[pos])))
+            {
+                isInteger = false;
+                ++pos;
+                if ((pos < size) && (('+' == text[pos]) || ('-' == text[pos])))
+                {
+                    ++pos;
+                }
+                size_t digitsStart = pos;
+                while ((pos < size) && IsDigit(text[pos]))
+                {
+                    ++pos;
+                }
+                if (pos == digitsStart)
+                {
+                    return false;
+                }
+            }
+
+            return pos == size;
+        }
+
+        template <typename JsonType>
+        void CurlJsonPushParser<JsonType>::ThrowSyntaxError(const char* what, size_t offset)
+        {
+            char message[128];
+            std::snprintf(message, sizeof(message), "JSON syntax error at byte %lu: %s", (unsigned long)offset, what);
+            throw std::invalid_argument(message);
+        }
+    } // namespace Web
+} // namespace AbcdEFramework
+
+#endif // CURL_JSON_PUSH_PARSER_5C8E1A4F7B2D4039A6E0D93F14B7C258
@@ -0,0 +1,117 @@
+/**
+ * @file
+ * @brief Declaration of the CurlJsonSink class template.
+ * @date 2026-10-19 [JFDR] Created.
+ */
+#if !defined CURL_JSON_SINK_9A3D6F0B2E8C4B71A5D4E1C7F03B2896
+#define CURL_JSON_SINK_9A3D6F0B2E8C4B71A5D4E1C7F03B2896 1
+
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <json.hpp>
+#include "CurlJsonPushParser.hpp"
+#include "CurlReceiveSink.hpp"
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        /**
+         * @brief Parses the body of a response as JSON while it is received.
+         * @remark Install it with \c CurlEasyWrapper::ReceiveSink(). Each chunk that cURL passes to the write
+         *      callback is fed to a \c CurlJsonPushParser, so the body is never held in full. If the body is not
+         *      valid JSON, the transfer is aborted with \c CURLE_WRITE_ERROR and \c TakeValue() throws the parse
+         *      error.
+         */
+        template <typename JsonType = nlohmann::json>
+        class CurlJsonSink : public CurlReceiveSink
+        {
+            private:
+                CurlJsonPushParser<JsonType> _parser; ///< The parser that the chunks are fed to.
+                std::string _error; ///< Message of the parse error, or empty.
+
+            public:
+                /**
+                 * @brief Feed the next chunk of the body to the parser.
+                 */
+                virtual bool Write(const char* data, size_t sizeBytes) override;
+
+            public:
+                /**
+                 * @brief Test whether the body could not be parsed.
+                 */
+                inline bool HasError() const;
+
+                /**
+                 * @brief Get the message of the parse error, or an empty string.
+                 */
+                inline const std::string& GetError() const;
+
+                /**
+                 * @brief Get the parsed body once the transfer has finished.
+                 * @remark Throws \c std::invalid_argument if the body was not valid JSON or ended early.
+                 */
+                JsonType TakeValue();
+
+                /**
+                 * @brief Prepare the sink for the next response.
+                 */
+                void Reset();
+        };
+
+        template <typename JsonType>
+        bool CurlJsonSink<JsonType>::Write(const char* data, size_t sizeBytes)
+        {
+            if (!this->_error.empty())
+            {
+                return false;
+            }
+
+            try
+            {
+                this->_parser.Feed(data, sizeBytes);
+                return true;
+            }
+            catch (std::exception& ex)
+            {
+                // Exceptions must not pass through cURL; keep the message for TakeValue().
+                this->_error = ex.what();
+                return false;
+            }
+        }
+
+        template <typename JsonType>
+        inline bool CurlJsonSink<JsonType>::HasError() const
+        {
+            return !this->_error.empty();
+        }
+
+        template <typename JsonType>
+        inline const std::string& CurlJsonSink<JsonType>::GetError() const
+        {
+            return this->_error;
+        }
+
+        template <typename JsonType>
+        JsonType CurlJsonSink<JsonType>::TakeValue()
+        {
+            if (!this->_error.empty())
+            {
+                throw std::invalid_argument(this->_error);
+            }
+
+            this->_parser.Finish();
+            return this->_parser.TakeValue();
+        }
+
+        template <typename JsonType>
+        void CurlJsonSink<JsonType>::Reset()
+        {
+            this->_parser.Reset();
+            this->_error.clear();
+        }
+    } // namespace Web
+} // namespace AbcdEFramework
+
+#endif // CURL_JSON_SINK_9A3D6F0B2E8C4B71A5D4E1C7F03B2896
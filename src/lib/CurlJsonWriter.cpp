@@ -0,0 +1,92 @@
+/**
+ * @file
+ * @brief Definition of the CurlJsonWriter methods.
+ * @date 2026-10-19 [JFDR] Created.
+ */
+
+#include "CurlJsonNumbers.hpp"
+#include "CurlJsonWriter.hpp"
+
+namespace
+{
+    /**
+     * @brief Hexadecimal digits of the \c \\u escapes of control characters.
+     */
+    const char HexDigits[] = "0123456789abcdef";
+
+    /**
+     * @brief Test whether a character must be escaped in a JSON string.
+     */
+    inline bool MustEscape(unsigned char ch)
+    {
+        return (ch < 0x20u) || (ch == '"') || (ch == '\\');
+    }
+}
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        void CurlJsonWriter::AppendString(std::string& text, const char* data, size_t sizeBytes)
+        {
+            text += '"';
+
+            // Copy the runs of characters that need no escape in one go.
+            const char* end = data + sizeBytes;
+            const char* runStart = data;
+            for (const char* pos = data; pos < end; ++pos)
+            {
+                unsigned char ch = (unsigned char)*pos;
+                if (!MustEscape(ch))
+                {
+                    continue;
+                }
+
+                text.append(runStart, (size_t)(pos - runStart));
+                runStart = pos + 1;
+
+                char escape[6] = { '\\', '\0', '0', '0', '\0', '\0' };
+                switch (ch)
+                {
+                    case '"': escape[1] = '"'; break;
+                    case '\\': escape[1] = '\\'; break;
+                    case '\b': escape[1] = 'b'; break;
+                    case '\f': escape[1] = 'f'; break;
+                    case '\n': escape[1] = 'n'; break;
+                    case '\r': escape[1] = 'r'; break;
+                    case '\t': escape[1] = 't'; break;
+                    default:
+                        escape[1] = 'u';
+                        escape[4] = HexDigits[ch >> 4];
+                        escape[5] = HexDigits[ch & 0x0Fu];
+                        text.append(escape, 6u);
+                        continue;
+                }
+                text.append(escape, 2u);
+            }
+            text.append(runStart, (size_t)(end - runStart));
+
+            text += '"';
+        }
+
+        void CurlJsonWriter::AppendNumber(std::string& text, double value)
+        {
+            char buffer[CurlJsonNumbers::MaxFormattedSize];
+            text += CurlJsonNumbers::TryFormat(value, buffer) ? buffer : "null";
+        }
+
+        void CurlJsonWriter::AppendNumber(std::string& text, int64_t value)
+        {
+            char buffer[CurlJsonNumbers::MaxFormattedSize];
+            CurlJsonNumbers::TryFormat(value, buffer);
+            text += buffer;
+        }
+
+        void CurlJsonWriter::AppendNumber(std::string& text, uint64_t value)
+        {
+            char buffer[CurlJsonNumbers::MaxFormattedSize];
+            CurlJsonNumbers::TryFormat(value, buffer);
+            text += buffer;
+        }
+    } // namespace Web
+} // namespace AbcdEFramework
@@ -0,0 +1,131 @@
+/**
+ * @file
+ * @brief Declaration of the CurlJsonWriter class.
+ * @date 2026-10-19 [JFDR] Created.
+ */
+#if !defined CURL_JSON_WRITER_E41B7C0A95D3462F8B1C6A07D2F93E58
+#define CURL_JSON_WRITER_E41B7C0A95D3462F8B1C6A07D2F93E58 1
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        /**
+         * @brief Serialises a JSON value by appending its text to a string.
+         * @remark The text is the same as that of \c dump() without indentation, with \c json.hpp built with
+         *      \c AEF_JSON_FAST_NUMBERS, but it is written straight into the string instead of through a
+         *      \c std::stringstream and a copy of every escaped string. Appending to a string that is reused keeps
+         *      its capacity, so serialising a request body of a size that was seen before does not allocate.
+         *      Numbers are printed by \c CurlJsonNumbers; a number that is not finite is written as \c null.
+         *
+         *      \c JsonType is a \c nlohmann::basic_json type; include \c json.hpp before calling \c Append().
+         */
+        class CurlJsonWriter
+        {
+            public:
+                /**
+                 * @brief Append the text of a value.
+                 */
+                template <typename JsonType>
+                static inline void Append(std::string& text, const JsonType& value);
+
+            private:
+                /**
+                 * @brief Append a string with quotes, escaping the characters that JSON requires to be escaped.
+                 */
+                static void AppendString(std::string& text, const char* data, size_t sizeBytes);
+
+                /**
+                 * @brief Append a floating point number.
+                 */
+                static void AppendNumber(std::string& text, double value);
+
+                /**
+                 * @brief Append a signed integer.
+                 */
+                static void AppendNumber(std::string& text, int64_t value);
+
+                /**
+                 * @brief Append an unsigned integer.
+                 */
+                static void AppendNumber(std::string& text, uint64_t value);
+        };
+
+        template <typename JsonType>
+        inline void CurlJsonWriter::Append(std::string& text, const JsonType& value)
+        {
+            typedef typename JsonType::value_t ValueType;
+            switch (value.type())
+            {
+                case ValueType::object:
+                {
+                    text += '{';
+                    for (typename JsonType::const_iterator member = value.cbegin(); member != value.cend(); ++member)
+                    {
+                        if (member != value.cbegin())
+                        {
+                            text += ',';
+                        }
+                        AppendString(text, member.key().data(), member.key().size());
+                        text += ':';
+                        Append(text, member.value());
+                    }
+                    text += '}';
+                    break;
+                }
+
+                case ValueType::array:
+                {
+                    text += '[';
+                    for (typename JsonType::const_iterator element = value.cbegin(); element != value.cend(); ++element)
+                    {
+                        if (element != value.cbegin())
+                        {
+                            text += ',';
+                        }
+                        Append(text, *element);
+                    }
+                    text += ']';
+                    break;
+                }
+
+                case ValueType::string:
+                {
+                    const typename JsonType::string_t& stringValue(*value.template get_ptr<const typename JsonType::string_t*>());
+                    AppendString(text, stringValue.data(), stringValue.size());
+                    break;
+                }
+
+                case ValueType::boolean:
+                    text += *value.template get_ptr<const typename JsonType::boolean_t*>() ? "true" : "false";
+                    break;
+
+                case ValueType::number_integer:
+                    AppendNumber(text, (int64_t)*value.template get_ptr<const typename JsonType::number_integer_t*>());
+                    break;
+
+                case ValueType::number_unsigned:
+                    AppendNumber(text, (uint64_t)*value.template get_ptr<const typename JsonType::number_unsigned_t*>());
+                    break;
+
+                case ValueType::number_float:
+                    AppendNumber(text, (double)*value.template get_ptr<const typename JsonType::number_float_t*>());
+                    break;
+
+                case ValueType::null:
+                    text += "null";
+                    break;
+
+                case ValueType::discarded:
+                    text += "<discarded>";
+                    break;
+            }
+        }
+    } // namespace Web
+} // namespace AbcdEFramework
+
+#endif // CURL_JSON_WRITER_E41B7C0A95D3462F8B1C6A07D2F93E58
@@ -0,0 +1,139 @@
+/**
+ * @file
+ * @brief Definition of the CurlMultiWrapper methods.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] AddHandle() and RemoveHandle() tell the wrapper whether it is attached.
+ * @date 2026-10-19 [JFDR] AddHandle() clears the response headers and the error message of the previous transfer.
+ */
+
+#include <stdexcept>
+#include <string>
+#include "CurlMultiWrapper.hpp"
+
+#ifdef __GNUC__
+    #define AEF_METHOD_NAME __PRETTY_FUNCTION__
+#elif _MSC_VER
+    #define AEF_METHOD_NAME __FUNCSIG__
+#else
+    #error "C++ compiler signature not recognised."
+#endif
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        using std::runtime_error;
+        using std::string;
+
+        CurlMultiWrapper::CurlMultiWrapper()
+            :   _multiHandle(curl_multi_init())
+        {
+            if (nullptr == _multiHandle)
+            {
+                throw runtime_error(AEF_METHOD_NAME);
+            }
+        }
+
+        CurlMultiWrapper::~CurlMultiWrapper()
+        {
+            if (_multiHandle != nullptr)
+            {
+                curl_multi_cleanup(this->_multiHandle);
+                this->_multiHandle = nullptr;
+            }
+        }
+
+        void CurlMultiWrapper::AddHandle(CurlEasyWrapper& easy)
+        {
+            // As in TryExecute(): a transfer that fails before the first header must not report the last response.
+            easy.ClearErrorMessageBuffer();
+            easy._responseHeaders.Clear();
+
+            CURLMcode curlRes;
+            if (CURLM_OK != (curlRes = curl_multi_add_handle(this->_multiHandle, easy.GetHandle())))
+            {
+                ThrowMultiError(AEF_METHOD_NAME, curlRes);
+            }
+            easy._attachedToMulti = true;
+        }
+
+        void CurlMultiWrapper::RemoveHandle(CurlEasyWrapper& easy)
+        {
+            CURLMcode curlRes;
+            if (CURLM_OK != (curlRes = curl_multi_remove_handle(this->_multiHandle, easy.GetHandle())))
+            {
+                ThrowMultiError(AEF_METHOD_NAME, curlRes);
+            }
+            easy._attachedToMulti = false;
+        }
+
+        int CurlMultiWrapper::Perform()
+        {
+            int runningHandles = 0;
+            CURLMcode curlRes;
+            if (CURLM_OK != (curlRes = curl_multi_perform(this->_multiHandle, &runningHandles)))
+            {
+                ThrowMultiError(AEF_METHOD_NAME, curlRes);
+            }
+
+            return runningHandles;
+        }
+
+        int CurlMultiWrapper::Poll(int timeoutMilliseconds)
+        {
+            int numFds = 0;
+            CURLMcode curlRes;
+            if (CURLM_OK != (curlRes = curl_multi_poll(this->_multiHandle, nullptr, 0u, timeoutMilliseconds, &numFds)))
+            {
+                ThrowMultiError(AEF_METHOD_NAME, curlRes);
+            }
+
+            return numFds;
+        }
+
+        void CurlMultiWrapper::Wakeup()
+        {
+            CURLMcode curlRes;
+            if (CURLM_OK != (curlRes = curl_multi_wakeup(this->_multiHandle)))
+            {
+                ThrowMultiError(AEF_METHOD_NAME, curlRes);
+            }
+        }
+
+        bool CurlMultiWrapper::ReadInfo(CurlEasyWrapper*& easy, CURLcode& result)
+        {
+            int messagesInQueue = 0;
+            CURLMsg* message;
+            while (nullptr != (message = curl_multi_info_read(this->_multiHandle, &messagesInQueue)))
+            {
+                if (message->msg != CURLMSG_DONE)
+                {
+                    continue;
+                }
+
+                easy = CurlEasyWrapper::FromHandle(message->easy_handle);
+                result = message->data.result;
+                return true;
+            }
+
+            return false;
+        }
+
+        void CurlMultiWrapper::MaxHostConnections(long maxConnections)
+        {
+            CURLMcode curlRes;
+            if (CURLM_OK != (curlRes = curl_multi_setopt(this->_multiHandle, CURLMOPT_MAX_HOST_CONNECTIONS, maxConnections)))
+            {
+                ThrowMultiError(AEF_METHOD_NAME, curlRes);
+            }
+        }
+
+        void CurlMultiWrapper::ThrowMultiError(const char* methodName, CURLMcode errorCode)
+        {
+            throw CurlException
+            (
+                string(methodName) + " :: CURLMcode=[" + std::to_string((int)errorCode) + "]" + curl_multi_strerror(errorCode)
+            );
+        }
+    } // namespace Web
+} // namespace AbcdEFramework
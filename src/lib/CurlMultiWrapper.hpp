@@ -0,0 +1,99 @@
+/**
+ * @file
+ * @brief Declaration of the CurlMultiWrapper class.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] AddHandle() clears the response headers of the previous transfer.
+ */
+#if !defined CURL_MULTI_WRAPPER_23AD4F107564402898DED5FB0690AD74
+#define CURL_MULTI_WRAPPER_23AD4F107564402898DED5FB0690AD74 1
+
+#include <curl/curl.h>
+#include "CurlEasyWrapper.hpp"
+#include "CurlException.hpp"
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        /**
+         * @brief Wrapper around the cURL multi interface that drives many \c CurlEasyWrapper transfers on one thread.
+         */
+        class CurlMultiWrapper
+        {
+            private:
+                CURLM* _multiHandle; ///< Handle to the multi stack.
+
+            public:
+                /**
+                 * @brief Default constructor.
+                 */
+                CurlMultiWrapper();
+
+                /**
+                 * @brief Destructor.
+                 * @remark Handles that are still attached are not removed; their owners must outlive this object
+                 *      or remove them first.
+                 */
+                ~CurlMultiWrapper();
+
+            public:
+                /**
+                 * @brief Attach an easy handle so that its transfer is started by the next call to \c Perform().
+                 * @remark The response headers and the error message of the previous transfer are cleared, as by
+                 *      \c CurlEasyWrapper::TryExecute().
+                 * @param easy The wrapper whose transfer must be started.
+                 */
+                void AddHandle(CurlEasyWrapper& easy);
+
+                /**
+                 * @brief Detach an easy handle. This must be done before the handle can be attached again.
+                 * @param easy The wrapper to detach.
+                 */
+                void RemoveHandle(CurlEasyWrapper& easy);
+
+                /**
+                 * @brief Perform all pending work without blocking.
+                 * @return The number of transfers that are still running.
+                 */
+                int Perform();
+
+                /**
+                 * @brief Wait until there is activity on one of the transfers or until the timeout expires.
+                 * @param timeoutMilliseconds Maximum time to wait.
+                 * @return The number of file descriptors on which something happened.
+                 */
+                int Poll(int timeoutMilliseconds);
+
+                /**
+                 * @brief Wake up a thread that is blocked in \c Poll().
+                 */
+                void Wakeup();
+
+                /**
+                 * @brief Retrieve the next transfer that has completed.
+                 * @param easy Receives a pointer to the wrapper of the completed transfer.
+                 * @param result Receives the result code of the completed transfer.
+                 * @return \c true if a completed transfer was found, \c false if there are no more.
+                 */
+                bool ReadInfo(CurlEasyWrapper*& easy, CURLcode& result);
+
+                /**
+                 * @brief Limit the number of connections that are opened to a single host.
+                 * @param maxConnections Maximum number of connections, or zero for no limit.
+                 */
+                void MaxHostConnections(long maxConnections);
+
+            private:
+                /**
+                 * @brief Throw an exception for a failed call to the multi interface.
+                 */
+                [[noreturn]] static void ThrowMultiError(const char* methodName, CURLMcode errorCode);
+
+            private:
+                CurlMultiWrapper(const CurlMultiWrapper&) = delete;
+                CurlMultiWrapper& operator=(const CurlMultiWrapper&) = delete;
+        }; // class CurlMultiWrapper
+    } // namespace Web
+} // namespace AbcdEFramework
+
+#endif // CURL_MULTI_WRAPPER_23AD4F107564402898DED5FB0690AD74
@@ -0,0 +1,363 @@
+/**
+ * @file
+ * @brief Declaration of the CurlNdjsonSink class template.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] The queue holds at most the capacity; the rest of the chunk waits in the pending buffer.
+ */
+#if !defined CURL_NDJSON_SINK_4E91C0B7A3D25F68B0E7C41D9A2F6538
+#define CURL_NDJSON_SINK_4E91C0B7A3D25F68B0E7C41D9A2F6538 1
+
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <json.hpp>
+#include "CurlReceiveSink.hpp"
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        /**
+         * @brief Parses a body of newline delimited JSON records (NDJSON, JSON Lines) while it is received.
+         * @remark Install it with \c CurlEasyWrapper::ReceiveSink(). Each chunk is split on line feeds with
+         *      \c memchr(), and every record is parsed as soon as its line is complete. A record that lies within one
+         *      chunk is parsed where it is; only the start of a record that continues in the next chunk is copied.
+         *      A carriage return before the line feed and empty lines are ignored.
+         *
+         *      The records go to a consumer function, or to a queue that the caller drains with \c TryPop(). A queue
+         *      with a capacity never holds more records than that. Once it is full, the rest of the chunk is kept
+         *      unsplit in a pending buffer, and \c IsFull() pauses the transfer until
+         *      \c CurlEasyWrapper::ResumeReceive() is called after the queue was drained. \c TryPop() parses the
+         *      pending records as it makes room, so the pending buffer holds at most about one chunk.
+         *
+         *      If a record is not valid JSON or the consumer returns \c false, the transfer is aborted with
+         *      \c CURLE_WRITE_ERROR and \c GetError() tells why.
+         */
+        template <typename JsonType = nlohmann::json>
+        class CurlNdjsonSink : public CurlReceiveSink
+        {
+            public:
+                /**
+                 * @brief Function that takes a record. It returns \c false to abort the transfer; it must not throw.
+                 */
+                typedef std::function<bool(JsonType& record)> Consumer;
+
+            private:
+                Consumer _consumer; ///< Takes the records, if set; otherwise they are queued.
+                std::deque<JsonType> _records; ///< Records that were not taken yet.
+                size_t _capacity; ///< Number of queued records at which the sink is full, or zero for no limit.
+                std::string _pending; ///< Received data that was not split yet: the start of a record that
+                                      ///< continues in the next chunk, or the rest of a chunk once the queue was full.
+                size_t _pendingOffset; ///< Position in \c _pending of the data that was not split yet.
+                size_t _lineCount; ///< Number of lines that were split off, for the error message.
+                std::string _error; ///< Why the transfer was aborted, or empty.
+
+            public:
+                /**
+                 * @brief Construct a sink that queues the records.
+                 * @param capacity Largest number of queued records, at which the transfer is paused, or zero for no
+                 *      limit. Use zero with \c CurlEasyWrapper::Execute(), which cannot be resumed and therefore
+                 *      fails with \c CURLE_WRITE_ERROR once the queue is full.
+                 */
+                explicit CurlNdjsonSink(size_t capacity = 0u);
+
+                /**
+                 * @brief Construct a sink that passes every record to a function as soon as it is parsed.
+                 */
+                explicit CurlNdjsonSink(Consumer consumer);
+
+            public:
+                /**
+                 * @brief Split the next chunk of the body into records.
+                 */
+                virtual bool Write(const char* data, size_t sizeBytes) override;
+
+                /**
+                 * @brief Test whether the queue holds \c capacity records or more.
+                 */
+                virtual bool IsFull() const override;
+
+            public:
+                /**
+                 * @brief Take the oldest queued record, and parse pending records into the room that it leaves.
+                 * @remark A pending record that is not valid JSON sets \c HasError(); check it once the queue is
+                 *      drained.
+                 * @return \c false if the queue is empty.
+                 */
+                inline bool TryPop(JsonType& record);
+
+                /**
+                 * @brief Get the number of queued records.
+                 */
+                inline size_t Size() const;
+
+                /**
+                 * @brief Test whether the transfer was aborted because of a bad record or the consumer.
+                 */
+                inline bool HasError() const;
+
+                /**
+                 * @brief Get why the transfer was aborted, or an empty string.
+                 */
+                inline const std::string& GetError() const;
+
+                /**
+                 * @brief Complete the last record once the transfer has finished, if the body does not end with a
+                 *      line feed.
+                 * @remark Records that do not fit in the queue yet stay pending until \c TryPop() makes room.
+                 *      Throws \c std::invalid_argument if the transfer was aborted or a record that was parsed is not
+                 *      valid JSON.
+                 */
+                void Finish();
+
+                /**
+                 * @brief Prepare the sink for the next response. Queued records are discarded.
+                 */
+                void Reset();
+
+            private:
+                /**
+                 * @brief Parse the record on one line and pass it on.
+                 * @param first First character of the line.
+                 * @param last Position of the line feed, or after the last character.
+                 * @return \c false if the transfer must be aborted.
+                 */
+                bool AddRecord(const char* first, const char* last);
+
+                /**
+                 * @brief Parse the complete records of the pending buffer until the queue is full.
+                 * @return \c false if the transfer must be aborted.
+                 */
+                bool DrainPending();
+        };
+
+        template <typename JsonType>
+        CurlNdjsonSink<JsonType>::CurlNdjsonSink(size_t capacity)
+            :   _capacity(capacity),
+                _pendingOffset(0u),
+                _lineCount(0u)
+        {
+        }
+
+        template <typename JsonType>
+        CurlNdjsonSink<JsonType>::CurlNdjsonSink(Consumer consumer)
+            :   _consumer(std::move(consumer)),
+                _capacity(0u),
+                _pendingOffset(0u),
+                _lineCount(0u)
+        {
+        }
+
+        template <typename JsonType>
+        bool CurlNdjsonSink<JsonType>::Write(const char* data, size_t sizeBytes)
+        {
+            if (!this->_error.empty())
+            {
+                return false;
+            }
+
+            const char* end = data + sizeBytes;
+            const char* pos = data;
+            if (this->_pendingOffset < this->_pending.size())
+            {
+                // The chunk is passed while the queue is full only if the sink is not asked first; keep it whole.
+                if (IsFull())
+                {
+                    this->_pending.append(data, sizeBytes);
+                    return true;
+                }
+
+                // With room in the queue, the pending data is the start of one record; complete it first.
+                const char* lineFeed = static_cast<const char*>(::memchr(pos, '\n', sizeBytes));
+                if (nullptr == lineFeed)
+                {
+                    this->_pending.append(data, sizeBytes);
+                    return true;
+                }
+
+                this->_pending.append(pos, (size_t)(lineFeed - pos));
+                bool added = AddRecord(this->_pending.data() + this->_pendingOffset, this->_pending.data() + this->_pending.size());
+                this->_pending.clear();
+                this->_pendingOffset = 0u;
+                if (!added)
+                {
+                    return false;
+                }
+                pos = lineFeed + 1;
+            }
+
+            while ((pos < end) && !IsFull())
+            {
+                const char* lineFeed = static_cast<const char*>(::memchr(pos, '\n', (size_t)(end - pos)));
+                if (nullptr == lineFeed)
+                {
+                    break;
+                }
+
+                if (!AddRecord(pos, lineFeed))
+                {
+                    return false;
+                }
+                pos = lineFeed + 1;
+            }
+
+            // Either the start of a record that continues in the next chunk, or what did not fit in the queue.
+            if (pos < end)
+            {
+                this->_pending.clear();
+                this->_pendingOffset = 0u;
+                this->_pending.append(pos, (size_t)(end - pos));
+            }
+
+            return true;
+        }
+
+        template <typename JsonType>
+        bool CurlNdjsonSink<JsonType>::IsFull() const
+        {
+            return (this->_capacity != 0u) && (this->_records.size() >= this->_capacity);
+        }
+
+        template <typename JsonType>
+        inline bool CurlNdjsonSink<JsonType>::TryPop(JsonType& record)
+        {
+            if (this->_records.empty())
+            {
+                return false;
+            }
+
+            record = std::move(this->_records.front());
+            this->_records.pop_front();
+            if (this->_error.empty())
+            {
+                DrainPending();
+            }
+            return true;
+        }
+
+        template <typename JsonType>
+        inline size_t CurlNdjsonSink<JsonType>::Size() const
+        {
+            return this->_records.size();
+        }
+
+        template <typename JsonType>
+        inline bool CurlNdjsonSink<JsonType>::HasError() const
+        {
+            return !this->_error.empty();
+        }
+
+        template <typename JsonType>
+        inline const std::string& CurlNdjsonSink<JsonType>::GetError() const
+        {
+            return this->_error;
+        }
+
+        template <typename JsonType>
+        void CurlNdjsonSink<JsonType>::Finish()
+        {
+            if (this->_error.empty() && (this->_pendingOffset < this->_pending.size()))
+            {
+                // The last record ends with the body.
+                if (this->_pending.back() != '\n')
+                {
+                    this->_pending.push_back('\n');
+                }
+                DrainPending();
+            }
+
+            if (!this->_error.empty())
+            {
+                throw std::invalid_argument(this->_error);
+            }
+        }
+
+        template <typename JsonType>
+        void CurlNdjsonSink<JsonType>::Reset()
+        {
+            this->_records.clear();
+            this->_pending.clear();
+            this->_pendingOffset = 0u;
+            this->_lineCount = 0u;
+            this->_error.clear();
+        }
+
+        template <typename JsonType>
+        bool CurlNdjsonSink<JsonType>::AddRecord(const char* first, const char* last)
+        {
+            ++this->_lineCount;
+            if ((last > first) && (last[-1] == '\r'))
+            {
+                --last;
+            }
+            if (last == first)
+            {
+                return true;
+            }
+
+            try
+            {
+                JsonType record(JsonType::parse(first, last));
+                if (!this->_consumer)
+                {
+                    this->_records.push_back(std::move(record));
+                }
+                else if (!this->_consumer(record))
+                {
+                    this->_error = "The consumer stopped the transfer at line " + std::to_string(this->_lineCount);
+                    return false;
+                }
+                return true;
+            }
+            catch (std::exception& ex)
+            {
+                // Exceptions must not pass through cURL; keep the message for Finish().
+                this->_error = "Line " + std::to_string(this->_lineCount) + ": " + ex.what();
+                return false;
+            }
+        }
+
+        template <typename JsonType>
+        bool CurlNdjsonSink<JsonType>::DrainPending()
+        {
+            const char* end = this->_pending.data() + this->_pending.size();
+            const char* pos = this->_pending.data() + this->_pendingOffset;
+            bool added = true;
+            while ((pos < end) && !IsFull())
+            {
+                const char* lineFeed = static_cast<const char*>(::memchr(pos, '\n', (size_t)(end - pos)));
+                if (nullptr == lineFeed)
+                {
+                    break;
+                }
+
+                added = AddRecord(pos, lineFeed);
+                pos = lineFeed + 1;
+                if (!added)
+                {
+                    break;
+                }
+            }
+
+            // Records are taken from the front by moving the offset; the data is only moved once half of it is used.
+            this->_pendingOffset = (size_t)(pos - this->_pending.data());
+            if (this->_pendingOffset == this->_pending.size())
+            {
+                this->_pending.clear();
+                this->_pendingOffset = 0u;
+            }
+            else if (this->_pendingOffset > this->_pending.size() / 2u)
+            {
+                this->_pending.erase(0u, this->_pendingOffset);
+                this->_pendingOffset = 0u;
+            }
+            return added;
+        }
+    } // namespace Web
+} // namespace AbcdEFramework
+
+#endif // CURL_NDJSON_SINK_4E91C0B7A3D25F68B0E7C41D9A2F6538
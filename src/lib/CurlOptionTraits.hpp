@@ -0,0 +1,144 @@
+/**
+ * @file
+ * @brief Compile time table of the argument types of the cURL easy options.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] Added the tracked column: options that only the wrapper's own methods may set.
+ * @date 2026-10-19 [JFDR] The options that take a long have the value of a new CurlEasyWrapper.
+ */
+#if !defined CURL_OPTION_TRAITS_94337EE2DFF649C29246B6A2F9189FB3
+#define CURL_OPTION_TRAITS_94337EE2DFF649C29246B6A2F9189FB3 1
+
+#include <curl/curl.h>
+
+// Expands into the traits of one option
+#define AEF_CURL_OPTION_TRAITS(CURL_OPT, VALUE_TYPE, BORROWS_STRING, TRACKED) \
+    template <> struct CurlOptionTraits<CURL_OPT> \
+    { \
+        typedef VALUE_TYPE value_type; \
+        static constexpr bool borrowsString = BORROWS_STRING; \
+        static constexpr bool tracked = TRACKED; \
+    };
+
+// Expands into the traits of one option that takes a long
+#define AEF_CURL_LONG_OPTION_TRAITS(CURL_OPT, TRACKED, DEFAULT_VALUE) \
+    template <> struct CurlOptionTraits<CURL_OPT> \
+    { \
+        typedef long value_type; \
+        static constexpr bool borrowsString = false; \
+        static constexpr bool tracked = TRACKED; \
+        static constexpr long defaultValue = DEFAULT_VALUE; \
+    };
+
+// cURL 8.3.0 limits the number of redirects to 30; before it there was no limit.
+#if LIBCURL_VERSION_NUM >= 0x080300
+    #define AEF_CURL_DEFAULT_MAXREDIRS 30l
+#else
+    #define AEF_CURL_DEFAULT_MAXREDIRS -1l
+#endif
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        /**
+         * @brief Argument type of a cURL easy option.
+         * @remark Each specialisation has these members:
+         *      - \c value_type The type that \c curl_easy_setopt() expects for the option.
+         *      - \c borrowsString \c true if cURL keeps the string pointer instead of making its own copy, so the
+         *        caller has to keep the string alive for as long as the option is in use.
+         *      - \c tracked \c true if the wrapper keeps the value in its option cache or relies on it, e.g. the URL,
+         *        the request method and the write callback. \c CurlEasyWrapper::Set() rejects these at compile
+         *        time, because a value set behind the wrapper's back would make it skip a later change.
+         *      - \c defaultValue Only for the options that take a long: the value on a new \c CurlEasyWrapper, which
+         *        is the default of cURL except for \c CURLOPT_NOSIGNAL. \c CurlPreparedRequest sets it again when
+         *        the next template does not set the option.
+         *
+         *      Options that are not in the table have no definition, so using them with
+         *      \c CurlEasyWrapper::Set() does not compile. Add a line below when a new option is needed.
+         */
+        template <CURLoption Option> struct CurlOptionTraits;
+
+        // Options that take a long.
+        AEF_CURL_LONG_OPTION_TRAITS(CURLOPT_NOSIGNAL, false, 1l)
+        AEF_CURL_LONG_OPTION_TRAITS(CURLOPT_VERBOSE, true, 0l)
+        AEF_CURL_LONG_OPTION_TRAITS(CURLOPT_UPLOAD, true, 0l)
+        AEF_CURL_LONG_OPTION_TRAITS(CURLOPT_POST, true, 0l)
+        AEF_CURL_LONG_OPTION_TRAITS(CURLOPT_HTTPGET, true, 0l)
+        AEF_CURL_LONG_OPTION_TRAITS(CURLOPT_NOBODY, true, 0l)
+        AEF_CURL_LONG_OPTION_TRAITS(CURLOPT_FAILONERROR, true, 0l)
+        AEF_CURL_LONG_OPTION_TRAITS(CURLOPT_TIMEOUT, true, 0l)
+        AEF_CURL_LONG_OPTION_TRAITS(CURLOPT_TIMEOUT_MS, true, 0l)
+        AEF_CURL_LONG_OPTION_TRAITS(CURLOPT_CONNECTTIMEOUT, false, 0l)
+        AEF_CURL_LONG_OPTION_TRAITS(CURLOPT_CONNECTTIMEOUT_MS, false, 0l)
+        AEF_CURL_LONG_OPTION_TRAITS(CURLOPT_FOLLOWLOCATION, false, 0l)
+        AEF_CURL_LONG_OPTION_TRAITS(CURLOPT_MAXREDIRS, false, AEF_CURL_DEFAULT_MAXREDIRS)
+        AEF_CURL_LONG_OPTION_TRAITS(CURLOPT_POSTFIELDSIZE, false, -1l)
+        AEF_CURL_LONG_OPTION_TRAITS(CURLOPT_INFILESIZE, false, -1l)
+        AEF_CURL_LONG_OPTION_TRAITS(CURLOPT_TCP_NODELAY, false, 1l)
+        AEF_CURL_LONG_OPTION_TRAITS(CURLOPT_TCP_KEEPALIVE, false, 0l)
+        AEF_CURL_LONG_OPTION_TRAITS(CURLOPT_FORBID_REUSE, false, 0l)
+        AEF_CURL_LONG_OPTION_TRAITS(CURLOPT_FRESH_CONNECT, false, 0l)
+        AEF_CURL_LONG_OPTION_TRAITS(CURLOPT_MAXCONNECTS, false, 5l)
+        AEF_CURL_LONG_OPTION_TRAITS(CURLOPT_BUFFERSIZE, false, (long)CURL_MAX_WRITE_SIZE)
+        AEF_CURL_LONG_OPTION_TRAITS(CURLOPT_HTTP_VERSION, false, (long)CURL_HTTP_VERSION_NONE)
+        AEF_CURL_LONG_OPTION_TRAITS(CURLOPT_IPRESOLVE, false, (long)CURL_IPRESOLVE_WHATEVER)
+        AEF_CURL_LONG_OPTION_TRAITS(CURLOPT_LOW_SPEED_LIMIT, false, 0l)
+        AEF_CURL_LONG_OPTION_TRAITS(CURLOPT_LOW_SPEED_TIME, false, 0l)
+        AEF_CURL_LONG_OPTION_TRAITS(CURLOPT_SSL_VERIFYPEER, false, 1l)
+        AEF_CURL_LONG_OPTION_TRAITS(CURLOPT_SSL_VERIFYHOST, false, 2l)
+
+        // Options that take a curl_off_t.
+        AEF_CURL_OPTION_TRAITS(CURLOPT_POSTFIELDSIZE_LARGE, curl_off_t, false, false)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_INFILESIZE_LARGE, curl_off_t, false, false)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_RESUME_FROM_LARGE, curl_off_t, false, false)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_MAX_SEND_SPEED_LARGE, curl_off_t, false, false)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_MAX_RECV_SPEED_LARGE, curl_off_t, false, false)
+
+        // Options that take a string. cURL copies all of them except CURLOPT_POSTFIELDS.
+        AEF_CURL_OPTION_TRAITS(CURLOPT_URL, const char*, false, true)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_USERAGENT, const char*, false, true)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_CUSTOMREQUEST, const char*, false, false)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_ACCEPT_ENCODING, const char*, false, false)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_REFERER, const char*, false, false)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_COOKIE, const char*, false, false)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_USERPWD, const char*, false, false)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_PROXY, const char*, false, false)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_CAINFO, const char*, false, false)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_UNIX_SOCKET_PATH, const char*, false, false)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_COPYPOSTFIELDS, const char*, false, true)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_POSTFIELDS, const char*, true, true)
+
+        // Options that take a list of strings.
+        AEF_CURL_OPTION_TRAITS(CURLOPT_HTTPHEADER, curl_slist*, false, true)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_RESOLVE, curl_slist*, false, false)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_CONNECT_TO, curl_slist*, false, false)
+
+        // Options that take a pointer that is handed back to a callback, or a buffer.
+        AEF_CURL_OPTION_TRAITS(CURLOPT_ERRORBUFFER, char*, false, true)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_PRIVATE, void*, false, true)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_WRITEDATA, void*, false, true)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_READDATA, void*, false, false)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_HEADERDATA, void*, false, true)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_DEBUGDATA, void*, false, false)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_XFERINFODATA, void*, false, false)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_OPENSOCKETDATA, void*, false, false)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_SOCKOPTDATA, void*, false, false)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_CLOSESOCKETDATA, void*, false, false)
+
+        // Options that take a callback.
+        AEF_CURL_OPTION_TRAITS(CURLOPT_WRITEFUNCTION, curl_write_callback, false, true)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_HEADERFUNCTION, curl_write_callback, false, true)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_READFUNCTION, curl_read_callback, false, false)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_DEBUGFUNCTION, curl_debug_callback, false, false)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_XFERINFOFUNCTION, curl_xferinfo_callback, false, false)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_OPENSOCKETFUNCTION, curl_opensocket_callback, false, false)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_SOCKOPTFUNCTION, curl_sockopt_callback, false, false)
+        AEF_CURL_OPTION_TRAITS(CURLOPT_CLOSESOCKETFUNCTION, curl_closesocket_callback, false, false)
+    } // namespace Web
+} // namespace AbcdEFramework
+
+#undef AEF_CURL_OPTION_TRAITS
+#undef AEF_CURL_LONG_OPTION_TRAITS
+#undef AEF_CURL_DEFAULT_MAXREDIRS
+
+#endif // CURL_OPTION_TRAITS_94337EE2DFF649C29246B6A2F9189FB3
@@ -0,0 +1,93 @@
+/**
+ * @file
+ * @brief Definition of the CurlPreparedRequest methods.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] Added the CurlHeaderList overload of Builder::HttpHeader().
+ * @date 2026-10-19 [JFDR] The long options are applied by the wrapper with the other cached options.
+ */
+
+#include "CurlPreparedRequest.hpp"
+
+#ifdef __GNUC__
+    #define AEF_METHOD_NAME __PRETTY_FUNCTION__
+#elif _MSC_VER
+    #define AEF_METHOD_NAME __FUNCSIG__
+#else
+    #error "C++ compiler signature not recognised."
+#endif
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        using std::string;
+
+        CurlPreparedRequest::CurlPreparedRequest(std::shared_ptr<const Template> requestTemplate)
+            :   _template(std::move(requestTemplate))
+        {
+        }
+
+        void CurlPreparedRequest::ApplyTemplate(CurlEasyWrapper& curl, const std::string& query, const std::string* body) const
+        {
+            curl.ApplyOptions(this->_template->options, query, body);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // CurlPreparedRequest::Builder
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CurlPreparedRequest::Builder::Builder()
+        {
+            // Same user agent as a new CurlEasyWrapper, so that applying the template does not change it.
+            this->_template.options.userAgent = CurlEasyWrapper::DefaultUserAgent;
+        }
+
+        CurlPreparedRequest::Builder& CurlPreparedRequest::Builder::UrlPrefix(const std::string& urlPrefix)
+        {
+            this->_template.options.url = urlPrefix;
+            return *this;
+        }
+
+        CurlPreparedRequest::Builder& CurlPreparedRequest::Builder::UserAgent(const std::string& agent)
+        {
+            this->_template.options.userAgent = agent;
+            return *this;
+        }
+
+        CurlPreparedRequest::Builder& CurlPreparedRequest::Builder::TimeoutMSeconds(long timeoutMilliseconds)
+        {
+            this->_template.options.timeoutMilliseconds = timeoutMilliseconds;
+            return *this;
+        }
+
+        CurlPreparedRequest::Builder& CurlPreparedRequest::Builder::FailOnHttpErrors(bool failOnErrors)
+        {
+            this->_template.options.failOnErrors = failOnErrors;
+            return *this;
+        }
+
+        CurlPreparedRequest::Builder& CurlPreparedRequest::Builder::Verbose(bool verboseMode)
+        {
+            this->_template.options.verbose = verboseMode;
+            return *this;
+        }
+
+        CurlPreparedRequest::Builder& CurlPreparedRequest::Builder::HttpHeader(std::shared_ptr<const CurlSList> headers)
+        {
+            this->_template.options.headers = std::move(headers);
+            this->_template.options.headerList.reset();
+            return *this;
+        }
+
+        CurlPreparedRequest::Builder& CurlPreparedRequest::Builder::HttpHeader(std::shared_ptr<const CurlHeaderList> headers)
+        {
+            this->_template.options.headerList = std::move(headers);
+            this->_template.options.headers.reset();
+            return *this;
+        }
+
+        CurlPreparedRequest CurlPreparedRequest::Builder::Build() const
+        {
+            return CurlPreparedRequest(std::make_shared<const Template>(this->_template));
+        }
+    } // namespace Web
+} // namespace AbcdEFramework
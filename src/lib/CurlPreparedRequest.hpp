@@ -0,0 +1,195 @@
+/**
+ * @file
+ * @brief Declaration of the CurlPreparedRequest class.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] The builder accepts a CurlHeaderList.
+ * @date 2026-10-19 [JFDR] Builder::Set<>() rejects the options that the wrapper tracks.
+ * @date 2026-10-19 [JFDR] The long options are cached by the wrapper, and reset when the next template does not set them.
+ * @date 2026-10-19 [JFDR] Apply() sends a GET request even if the handle was last used with NoBody(), Post() or Upload().
+ */
+#if !defined CURL_PREPARED_REQUEST_FB16EE9EA67543C6B62A4CB25144CFA0
+#define CURL_PREPARED_REQUEST_FB16EE9EA67543C6B62A4CB25144CFA0 1
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <curl/curl.h>
+#include "CurlEasyWrapper.hpp"
+#include "CurlOptionTraits.hpp"
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        /**
+         * @brief Immutable request template that is applied to a \c CurlEasyWrapper in one call.
+         * @remark Built once with a \c CurlPreparedRequest::Builder. Copies share the template by reference count,
+         *      and the template is never changed after it was built, so one prepared request may be applied from
+         *      many threads at once, each to its own wrapper. Only the options whose value differs from the one on
+         *      the wrapper are passed to cURL, so applying the same template to a pooled handle again only sets the
+         *      query string and the body. An option that the previous template set through \c Builder::Set<>() and
+         *      this one does not is set back to its value on a new wrapper. The request method that the handle
+         *      used last is replaced as well, so a template may be applied to any pooled handle.
+         */
+        class CurlPreparedRequest
+        {
+            private:
+                /**
+                 * @brief The shared part of a prepared request.
+                 */
+                struct Template
+                {
+                    CurlOptionState options; ///< URL prefix and the options that the wrapper caches.
+                };
+
+            public:
+                class Builder;
+
+            private:
+                std::shared_ptr<const Template> _template; ///< The template, shared by all copies.
+
+            public:
+                /**
+                 * @brief Apply the template and send a GET request to the URL prefix.
+                 */
+                inline void Apply(CurlEasyWrapper& curl) const;
+
+                /**
+                 * @brief Apply the template and send a GET request.
+                 * @param query Appended to the URL prefix, e.g. \c "?id=42".
+                 */
+                inline void Apply(CurlEasyWrapper& curl, const std::string& query) const;
+
+                /**
+                 * @brief Apply the template and send a POST request.
+                 * @param query Appended to the URL prefix. May be empty.
+                 * @param body Data to post. The wrapper keeps a copy.
+                 */
+                inline void Apply(CurlEasyWrapper& curl, const std::string& query, const std::string& body) const;
+
+                /**
+                 * @brief Get the URL prefix.
+                 */
+                inline const std::string& GetUrlPrefix() const;
+
+            private:
+                /**
+                 * @brief Construct from a template that was built by a \c Builder.
+                 */
+                explicit CurlPreparedRequest(std::shared_ptr<const Template> requestTemplate);
+
+                /**
+                 * @brief Apply the template with an optional body.
+                 */
+                void ApplyTemplate(CurlEasyWrapper& curl, const std::string& query, const std::string* body) const;
+        };
+
+        /**
+         * @brief Collects the options of a \c CurlPreparedRequest.
+         */
+        class CurlPreparedRequest::Builder
+        {
+            private:
+                Template _template; ///< The template that is being built.
+
+            public:
+                /**
+                 * @brief Start with the options of a new \c CurlEasyWrapper.
+                 */
+                Builder();
+
+            public:
+                /**
+                 * @brief Set the part of the URL that is the same for every request.
+                 */
+                Builder& UrlPrefix(const std::string& urlPrefix);
+
+                /**
+                 * @brief Set the user agent string.
+                 */
+                Builder& UserAgent(const std::string& agent);
+
+                /**
+                 * @brief Number of milliseconds to wait before a transfer times out. Zero waits indefinitely.
+                 */
+                Builder& TimeoutMSeconds(long timeoutMilliseconds);
+
+                /**
+                 * @brief Report HTTP errors as failures.
+                 */
+                Builder& FailOnHttpErrors(bool failOnErrors);
+
+                /**
+                 * @brief Switch verbose output mode on or off.
+                 */
+                Builder& Verbose(bool verboseMode);
+
+                /**
+                 * @brief Set the custom HTTP headers. The list is shared, not copied.
+                 */
+                Builder& HttpHeader(std::shared_ptr<const CurlSList> headers);
+
+                /**
+                 * @brief Set the custom HTTP headers from a header list. The list is shared, not copied.
+                 */
+                Builder& HttpHeader(std::shared_ptr<const CurlHeaderList> headers);
+
+                /**
+                 * @brief Set any other option that takes a long, e.g. \c CURLOPT_CONNECTTIMEOUT_MS.
+                 * @tparam Option Option identifier. The option must be listed in \c CurlOptionTraits with a
+                 *      \c value_type of \c long. Setting it again replaces the earlier value.
+                 */
+                template <CURLoption Option>
+                inline Builder& Set(long value);
+
+                /**
+                 * @brief Create the prepared request. The builder may be used again afterwards.
+                 */
+                CurlPreparedRequest Build() const;
+        };
+
+        inline void CurlPreparedRequest::Apply(CurlEasyWrapper& curl) const
+        {
+            ApplyTemplate(curl, std::string(), nullptr);
+        }
+
+        inline void CurlPreparedRequest::Apply(CurlEasyWrapper& curl, const std::string& query) const
+        {
+            ApplyTemplate(curl, query, nullptr);
+        }
+
+        inline void CurlPreparedRequest::Apply(CurlEasyWrapper& curl, const std::string& query, const std::string& body) const
+        {
+            ApplyTemplate(curl, query, &body);
+        }
+
+        inline const std::string& CurlPreparedRequest::GetUrlPrefix() const
+        {
+            return this->_template->options.url;
+        }
+
+        template <CURLoption Option>
+        inline CurlPreparedRequest::Builder& CurlPreparedRequest::Builder::Set(long value)
+        {
+            static_assert(std::is_same<typename CurlOptionTraits<Option>::value_type, long>::value, "the option does not take a long");
+            static_assert(!CurlOptionTraits<Option>::tracked, "the wrapper tracks this option; use its method instead");
+            std::vector<CurlLongOption>& longOptions = this->_template.options.longOptions;
+            for (CurlLongOption& longOption : longOptions)
+            {
+                if (longOption.option == Option)
+                {
+                    longOption.value = value;
+                    return *this;
+                }
+            }
+
+            CurlLongOption longOption = { Option, value, CurlOptionTraits<Option>::defaultValue };
+            longOptions.push_back(longOption);
+            return *this;
+        }
+    } // namespace Web
+} // namespace AbcdEFramework
+
+#endif // CURL_PREPARED_REQUEST_FB16EE9EA67543C6B62A4CB25144CFA0
@@ -0,0 +1,57 @@
+/**
+ * @file
+ * @brief Declaration of the CurlReceiveSink interface.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] Added IsFull(), which pauses the transfer.
+ * @date 2026-10-19 [JFDR] A full sink fails a transfer of Execute() instead of pausing it.
+ */
+#if !defined CURL_RECEIVE_SINK_0B6E3F2A9C1D4E7B8F45A2D6C3E19B70
+#define CURL_RECEIVE_SINK_0B6E3F2A9C1D4E7B8F45A2D6C3E19B70 1
+
+#include <cstddef>
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        /**
+         * @brief Receives the body of a response chunk by chunk, instead of the receive buffer of the wrapper.
+         * @remark Install a sink with \c CurlEasyWrapper::ReceiveSink(). The sink is called from the write callback,
+         *      so it must not throw; report a failure by returning \c false, which makes cURL abort the transfer
+         *      with \c CURLE_WRITE_ERROR, and keep the reason in the sink.
+         */
+        class CurlReceiveSink
+        {
+            public:
+                /**
+                 * @brief Destructor.
+                 */
+                virtual ~CurlReceiveSink()
+                {
+                }
+
+            public:
+                /**
+                 * @brief Consume the next chunk of the body.
+                 * @param data The chunk. It is only valid during the call.
+                 * @param sizeBytes Number of bytes in the chunk.
+                 * @return \c true to continue the transfer, \c false to abort it.
+                 */
+                virtual bool Write(const char* data, size_t sizeBytes) = 0;
+
+                /**
+                 * @brief Test whether the sink has no room for more data.
+                 * @remark It is asked before every chunk. If it returns \c true, the transfer is paused without
+                 *      passing the chunk; cURL passes it again after \c CurlEasyWrapper::ResumeReceive(). Only a
+                 *      transfer driven by \c CurlMultiWrapper can be resumed; \c Execute() would not return while
+                 *      it is paused, so it fails with \c CURLE_WRITE_ERROR instead.
+                 */
+                virtual bool IsFull() const
+                {
+                    return false;
+                }
+        };
+    } // namespace Web
+} // namespace AbcdEFramework
+
+#endif // CURL_RECEIVE_SINK_0B6E3F2A9C1D4E7B8F45A2D6C3E19B70
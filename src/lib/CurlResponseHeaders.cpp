@@ -0,0 +1,209 @@
+/**
+ * @file
+ * @brief Definition of the CurlResponseHeaders methods.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] Lines and colons are found with CurlLineScanner.
+ */
+
+#include <cstring>
+#include "CurlGlobal.hpp"
+#include "CurlResponseHeaders.hpp"
+#include "CurlTextScan.hpp"
+
+namespace
+{
+    using AbcdEFramework::Web::CURL_ALLOC_RESPONSE_HEADERS;
+    using AbcdEFramework::Web::CurlGlobal;
+
+    /**
+     * @brief Test for the optional white space around a header value.
+     */
+    inline bool IsWhiteSpace(char ch)
+    {
+        return (' ' == ch) || ('\t' == ch);
+    }
+
+    /**
+     * @brief Count the allocation if a container grew.
+     */
+    template <typename Container>
+    inline void RecordGrowth(const Container& container, size_t capacityBefore)
+    {
+        if (container.capacity() != capacityBefore)
+        {
+            CurlGlobal::RecordAllocation(CURL_ALLOC_RESPONSE_HEADERS, container.capacity() * sizeof(typename Container::value_type));
+        }
+    }
+}
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        CurlResponseHeaders::CurlResponseHeaders()
+            :   _blockComplete(false),
+                _parsed(true),
+                _statusCode(0l)
+        {
+        }
+
+        long CurlResponseHeaders::GetStatusCode() const
+        {
+            if (!this->_parsed)
+            {
+                Parse();
+            }
+            return this->_statusCode;
+        }
+
+        size_t CurlResponseHeaders::Size() const
+        {
+            if (!this->_parsed)
+            {
+                Parse();
+            }
+            return this->_fields.size();
+        }
+
+        CurlStringView CurlResponseHeaders::GetName(size_t index) const
+        {
+            if (!this->_parsed)
+            {
+                Parse();
+            }
+            const Field& field(this->_fields.at(index));
+            return CurlStringView(this->_lines.data() + field.nameOffset, field.nameLength);
+        }
+
+        CurlStringView CurlResponseHeaders::GetValue(size_t index) const
+        {
+            if (!this->_parsed)
+            {
+                Parse();
+            }
+            const Field& field(this->_fields.at(index));
+            return CurlStringView(this->_lines.data() + field.valueOffset, field.valueLength);
+        }
+
+        CurlStringView CurlResponseHeaders::Find(const CurlStringView& name) const
+        {
+            if (!this->_parsed)
+            {
+                Parse();
+            }
+
+            for (const Field& field : this->_fields)
+            {
+                if ((field.nameLength == name.Size())
+                    && CurlStringView(this->_lines.data() + field.nameOffset, field.nameLength).EqualsIgnoreCase(name))
+                {
+                    return CurlStringView(this->_lines.data() + field.valueOffset, field.valueLength);
+                }
+            }
+
+            return CurlStringView();
+        }
+
+        void CurlResponseHeaders::Clear()
+        {
+            this->_lines.clear();
+            this->_blockComplete = false;
+            this->_fields.clear();
+            this->_statusCode = 0l;
+            this->_parsed = true;
+        }
+
+        size_t CurlResponseHeaders::CurlHeaderDataProc(char* buffer, size_t size, size_t nitems, void* userp)
+        {
+            CurlResponseHeaders* headers = reinterpret_cast<CurlResponseHeaders*>(userp);
+            size_t lineLength = size * nitems;
+
+            // The first line after the end of a block starts the next response; only the last one is kept.
+            if (headers->_blockComplete)
+            {
+                headers->_lines.clear();
+                headers->_blockComplete = false;
+            }
+
+            size_t capacityBefore = headers->_lines.capacity();
+            headers->_lines.append(buffer, lineLength);
+            RecordGrowth(headers->_lines, capacityBefore);
+            headers->_parsed = false;
+
+            if (((1u == lineLength) && ('\n' == buffer[0]))
+                || ((2u == lineLength) && ('\r' == buffer[0]) && ('\n' == buffer[1])))
+            {
+                headers->_blockComplete = true;
+            }
+
+            return lineLength;
+        }
+
+        void CurlResponseHeaders::Parse() const
+        {
+            size_t capacityBefore = this->_fields.capacity();
+            this->_fields.clear();
+            this->_statusCode = 0l;
+
+            const char* data = this->_lines.data();
+            CurlLineScanner scanner(data, this->_lines.size());
+            size_t lineStart;
+            size_t lineEnd;
+            size_t colon;
+            bool statusLine = true;
+            while (scanner.NextLine(lineStart, lineEnd, colon))
+            {
+                if ((lineEnd > lineStart) && ('\r' == data[lineEnd - 1u]))
+                {
+                    --lineEnd;
+                }
+
+                if (statusLine)
+                {
+                    // "HTTP/1.1 200 OK" or "HTTP/2 200"
+                    statusLine = false;
+                    if ((lineEnd - lineStart > 5u) && (::memcmp(data + lineStart, "HTTP/", 5u) == 0))
+                    {
+                        size_t pos = lineStart + 5u;
+                        while ((pos < lineEnd) && (data[pos] != ' '))
+                        {
+                            ++pos;
+                        }
+                        while ((pos < lineEnd) && (' ' == data[pos]))
+                        {
+                            ++pos;
+                        }
+                        while ((pos < lineEnd) && (data[pos] >= '0') && (data[pos] <= '9'))
+                        {
+                            this->_statusCode = (this->_statusCode * 10l) + (data[pos] - '0');
+                            ++pos;
+                        }
+                    }
+                }
+                else if ((colon < lineEnd) && !IsWhiteSpace(data[lineStart]))
+                {
+                    // Lines without a colon and lines that continue an obsolete folded value are skipped.
+                    Field field;
+                    field.nameOffset = lineStart;
+                    field.nameLength = colon - lineStart;
+                    size_t valueStart = colon + 1u;
+                    size_t valueEnd = lineEnd;
+                    while ((valueStart < valueEnd) && IsWhiteSpace(data[valueStart]))
+                    {
+                        ++valueStart;
+                    }
+                    while ((valueEnd > valueStart) && IsWhiteSpace(data[valueEnd - 1u]))
+                    {
+                        --valueEnd;
+                    }
+                    field.valueOffset = valueStart;
+                    field.valueLength = valueEnd - valueStart;
+                    this->_fields.push_back(field);
+                }
+            }
+
+            RecordGrowth(this->_fields, capacityBefore);
+            this->_parsed = true;
+        }
+    } // namespace Web
+} // namespace AbcdEFramework
@@ -0,0 +1,116 @@
+/**
+ * @file
+ * @brief Declaration of the CurlResponseHeaders class.
+ * @date 2026-10-19 [JFDR] Created.
+ */
+#if !defined CURL_RESPONSE_HEADERS_A4F27C9D0E8B4B63B1D5963E7C08F1A2
+#define CURL_RESPONSE_HEADERS_A4F27C9D0E8B4B63B1D5963E7C08F1A2 1
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "CurlStringView.hpp"
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        /**
+         * @brief The headers of the last response received by a \c CurlEasyWrapper.
+         * @remark The header callback only appends the raw lines to one buffer. The lines are split into names and
+         *      values the first time a header is read, so a request whose headers are never read pays for one copy
+         *      of the header bytes and nothing else. When a transfer receives more than one header block (after
+         *      a redirect or an interim \c 100 \c Continue response), only the last block is kept.
+         *
+         *      The views returned by the methods point into the buffer and are valid until the next transfer
+         *      starts on the wrapper. The object is not thread safe, not even for reading, because the first
+         *      read parses the buffer.
+         */
+        class CurlResponseHeaders
+        {
+            private:
+                /**
+                 * @brief Position of one header in the buffer.
+                 */
+                struct Field
+                {
+                    size_t nameOffset; ///< Offset of the header name.
+                    size_t nameLength; ///< Number of characters in the header name.
+                    size_t valueOffset; ///< Offset of the value, without leading white space.
+                    size_t valueLength; ///< Number of characters in the value, without trailing white space.
+                };
+
+            private:
+                std::string _lines; ///< The raw header lines, including the status line and the line ends.
+                bool _blockComplete; ///< Set when the empty line that ends a header block was received.
+                mutable bool _parsed; ///< Set if \c _fields and \c _statusCode describe \c _lines.
+                mutable long _statusCode; ///< Status code from the status line, or 0 if there is none.
+                mutable std::vector<Field> _fields; ///< The headers, in the order they were received.
+
+            public:
+                /**
+                 * @brief Construct an empty header store.
+                 */
+                CurlResponseHeaders();
+
+            public:
+                /**
+                 * @brief Get the status code from the status line, e.g. 200.
+                 * @return The status code, or 0 if no response was received.
+                 */
+                long GetStatusCode() const;
+
+                /**
+                 * @brief Get the number of headers, not counting the status line.
+                 */
+                size_t Size() const;
+
+                /**
+                 * @brief Get the name of the header at \c index.
+                 */
+                CurlStringView GetName(size_t index) const;
+
+                /**
+                 * @brief Get the value of the header at \c index.
+                 */
+                CurlStringView GetValue(size_t index) const;
+
+                /**
+                 * @brief Find the value of the first header with the given name, ignoring case.
+                 * @param name Header name, e.g. \c "Content-Type".
+                 * @return The value, or a null view if there is no such header.
+                 */
+                CurlStringView Find(const CurlStringView& name) const;
+
+                /**
+                 * @brief Get the raw header lines of the last header block.
+                 */
+                inline const std::string& GetRawLines() const;
+
+                /**
+                 * @brief Remove all headers.
+                 */
+                void Clear();
+
+            public:
+                /**
+                 * @brief Header callback for \c CURLOPT_HEADERFUNCTION.
+                 * @param userp Pointer to the \c CurlResponseHeaders instance, set with \c CURLOPT_HEADERDATA.
+                 */
+                static size_t CurlHeaderDataProc(char* buffer, size_t size, size_t nitems, void* userp);
+
+            private:
+                /**
+                 * @brief Split the buffer into headers.
+                 */
+                void Parse() const;
+        };
+
+        inline const std::string& CurlResponseHeaders::GetRawLines() const
+        {
+            return this->_lines;
+        }
+    } // namespace Web
+} // namespace AbcdEFramework
+
+#endif // CURL_RESPONSE_HEADERS_A4F27C9D0E8B4B63B1D5963E7C08F1A2
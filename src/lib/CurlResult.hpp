@@ -0,0 +1,154 @@
+/**
+ * @file
+ * @brief Declaration of the CurlResult class.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] Throw() uses the CurlException constructor that does not allocate.
+ */
+#if !defined CURL_RESULT_E92D78A1D0534A5AB9BD85E87F187991
+#define CURL_RESULT_E92D78A1D0534A5AB9BD85E87F187991 1
+
+#include <string>
+#include <curl/curl.h>
+#include "CurlException.hpp"
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        /**
+         * @brief Outcome of a \c CurlEasyWrapper call that does not throw.
+         * @remark Creating a result costs no more than storing three words; the error message is only built when
+         *      \c GetErrorMessage() or \c ThrowIfFailed() is called. The detail text points into the error buffer
+         *      of the wrapper that produced the result, so it is only valid until the next call on that wrapper.
+         */
+        class CurlResult
+        {
+            private:
+                CURLcode _errorCode; ///< Code returned by cURL.
+                const char* _methodName; ///< Name of the method that produced the result. Must have static storage.
+                const char* _detail; ///< Error text that cURL wrote to the error buffer, or \c nullptr.
+
+            public:
+                /**
+                 * @brief Construct a successful result.
+                 */
+                inline CurlResult();
+
+                /**
+                 * @brief Construct a result.
+                 * @param errorCode Code returned by cURL.
+                 * @param methodName Name of the method that produced the result. Must have static storage.
+                 * @param detail Error text that cURL wrote to the error buffer, or \c nullptr.
+                 */
+                inline CurlResult(CURLcode errorCode, const char* methodName, const char* detail);
+
+            public:
+                /**
+                 * @brief Test for success.
+                 */
+                inline explicit operator bool() const;
+
+                /**
+                 * @brief Test for success.
+                 */
+                inline bool IsOk() const;
+
+                /**
+                 * @brief Get the code returned by cURL.
+                 */
+                inline CURLcode GetErrorCode() const;
+
+                /**
+                 * @brief Get the name of the method that produced the result.
+                 */
+                inline const char* GetMethodName() const;
+
+                /**
+                 * @brief Get the error text without copying it.
+                 * @return The text from the error buffer if cURL wrote one, otherwise the text of \c curl_easy_strerror().
+                 */
+                inline const char* GetErrorText() const;
+
+                /**
+                 * @brief Build the error message.
+                 * @return A copy of the text returned by \c GetErrorText().
+                 */
+                inline std::string GetErrorMessage() const;
+
+                /**
+                 * @brief Throw a \c CurlException if the call failed.
+                 */
+                inline void ThrowIfFailed() const;
+
+            private:
+                /**
+                 * @brief Throw the \c CurlException for a failed call.
+                 * @remark Defined in the class body, because an out of class \c inline definition conflicts with
+                 *      the \c noinline attribute.
+                 */
+                [[noreturn]] AEF_COLD_PATH void Throw() const
+                {
+                    throw CurlException(this->_methodName, this->_errorCode, GetErrorText());
+                }
+        };
+
+        inline CurlResult::CurlResult()
+            :   _errorCode(CURLE_OK),
+                _methodName(""),
+                _detail(nullptr)
+        {
+        }
+
+        inline CurlResult::CurlResult(CURLcode errorCode, const char* methodName, const char* detail)
+            :   _errorCode(errorCode),
+                _methodName(methodName),
+                _detail(detail)
+        {
+        }
+
+        inline CurlResult::operator bool() const
+        {
+            return this->_errorCode == CURLE_OK;
+        }
+
+        inline bool CurlResult::IsOk() const
+        {
+            return this->_errorCode == CURLE_OK;
+        }
+
+        inline CURLcode CurlResult::GetErrorCode() const
+        {
+            return this->_errorCode;
+        }
+
+        inline const char* CurlResult::GetMethodName() const
+        {
+            return this->_methodName;
+        }
+
+        inline const char* CurlResult::GetErrorText() const
+        {
+            if ((this->_detail != nullptr) && (this->_detail[0] != '\0'))
+            {
+                return this->_detail;
+            }
+
+            return curl_easy_strerror(this->_errorCode);
+        }
+
+        inline std::string CurlResult::GetErrorMessage() const
+        {
+            return std::string(GetErrorText());
+        }
+
+        inline void CurlResult::ThrowIfFailed() const
+        {
+            if (this->_errorCode != CURLE_OK)
+            {
+                Throw();
+            }
+        }
+    } // namespace Web
+} // namespace AbcdEFramework
+
+#endif // CURL_RESULT_E92D78A1D0534A5AB9BD85E87F187991
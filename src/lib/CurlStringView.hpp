@@ -0,0 +1,180 @@
+/**
+ * @file
+ * @brief Declaration of the CurlStringView class.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] EqualsIgnoreCase() uses the vectorised comparison of CurlTextScan.
+ */
+#if !defined CURL_STRING_VIEW_3E6A0D51C2B74F8F9A17E4C8B05D62A9
+#define CURL_STRING_VIEW_3E6A0D51C2B74F8F9A17E4C8B05D62A9 1
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include "CurlTextScan.hpp"
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        /**
+         * @brief Characters that are owned by someone else, like \c std::string_view in C++17.
+         * @remark The view does not keep the characters alive; the documentation of the method that returns a view
+         *      says for how long it is valid. The characters are not NUL terminated.
+         */
+        class CurlStringView
+        {
+            private:
+                const char* _data; ///< First character, or \c nullptr for a null view.
+                size_t _size; ///< Number of characters.
+
+            public:
+                /**
+                 * @brief Construct a null view.
+                 */
+                inline CurlStringView();
+
+                /**
+                 * @brief Construct a view of \c size characters starting at \c data.
+                 */
+                inline CurlStringView(const char* data, size_t size);
+
+                /**
+                 * @brief Construct a view of a NUL terminated string.
+                 */
+                inline CurlStringView(const char* str);
+
+                /**
+                 * @brief Construct a view of the characters of a string.
+                 */
+                inline CurlStringView(const std::string& str);
+
+            public:
+                /**
+                 * @brief Test whether both views hold the same characters.
+                 */
+                inline bool operator==(const CurlStringView& rhs) const;
+
+                /**
+                 * @brief Test whether the views hold different characters.
+                 */
+                inline bool operator!=(const CurlStringView& rhs) const;
+
+            public:
+                /**
+                 * @brief Get the first character.
+                 */
+                inline const char* Data() const;
+
+                /**
+                 * @brief Get the number of characters.
+                 */
+                inline size_t Size() const;
+
+                /**
+                 * @brief Test whether the view has no characters.
+                 */
+                inline bool Empty() const;
+
+                /**
+                 * @brief Test whether the view refers to nothing at all, e.g. a header that was not found.
+                 */
+                inline bool IsNull() const;
+
+                /**
+                 * @brief Test whether both views hold the same characters, ignoring the case of ASCII letters.
+                 */
+                inline bool EqualsIgnoreCase(const CurlStringView& rhs) const;
+
+                /**
+                 * @brief Copy the characters into a string.
+                 */
+                inline std::string ToString() const;
+
+                /**
+                 * @brief Get an iterator to the first character.
+                 */
+                inline const char* begin() const;
+
+                /**
+                 * @brief Get an iterator past the last character.
+                 */
+                inline const char* end() const;
+        };
+
+        inline CurlStringView::CurlStringView()
+            :   _data(nullptr),
+                _size(0u)
+        {
+        }
+
+        inline CurlStringView::CurlStringView(const char* data, size_t size)
+            :   _data(data),
+                _size(size)
+        {
+        }
+
+        inline CurlStringView::CurlStringView(const char* str)
+            :   _data(str),
+                _size((str != nullptr) ? ::strlen(str) : 0u)
+        {
+        }
+
+        inline CurlStringView::CurlStringView(const std::string& str)
+            :   _data(str.data()),
+                _size(str.size())
+        {
+        }
+
+        inline bool CurlStringView::operator==(const CurlStringView& rhs) const
+        {
+            return (this->_size == rhs._size) && ((0u == this->_size) || (::memcmp(this->_data, rhs._data, this->_size) == 0));
+        }
+
+        inline bool CurlStringView::operator!=(const CurlStringView& rhs) const
+        {
+            return !(*this == rhs);
+        }
+
+        inline const char* CurlStringView::Data() const
+        {
+            return this->_data;
+        }
+
+        inline size_t CurlStringView::Size() const
+        {
+            return this->_size;
+        }
+
+        inline bool CurlStringView::Empty() const
+        {
+            return 0u == this->_size;
+        }
+
+        inline bool CurlStringView::IsNull() const
+        {
+            return nullptr == this->_data;
+        }
+
+        inline bool CurlStringView::EqualsIgnoreCase(const CurlStringView& rhs) const
+        {
+            return (this->_size == rhs._size) && CurlTextScan::EqualsIgnoreCase(this->_data, rhs._data, this->_size);
+        }
+
+        inline std::string CurlStringView::ToString() const
+        {
+            return (this->_data != nullptr) ? std::string(this->_data, this->_size) : std::string();
+        }
+
+        inline const char* CurlStringView::begin() const
+        {
+            return this->_data;
+        }
+
+        inline const char* CurlStringView::end() const
+        {
+            return this->_data + this->_size;
+        }
+    } // namespace Web
+} // namespace AbcdEFramework
+
+#endif // CURL_STRING_VIEW_3E6A0D51C2B74F8F9A17E4C8B05D62A9
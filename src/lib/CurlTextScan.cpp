@@ -0,0 +1,481 @@
+/**
+ * @file
+ * @brief Definition of the text scanning routines used to parse HTTP headers and JSON.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] Added the JSON classification kernels.
+ */
+
+#include <cstring>
+#include "CurlTextScan.hpp"
+
+#if !defined AEF_CURL_NO_SIMD && defined __GNUC__ && (defined __x86_64__ || defined __i386__) && defined __SSE2__
+    #define AEF_CURL_X86_SIMD 1
+    #include <immintrin.h>
+#endif
+
+namespace
+{
+    using AbcdEFramework::Web::CurlJsonBlockMasks;
+    using AbcdEFramework::Web::CurlTextScan;
+
+    /**
+     * @brief Get a mask with the bits below \c bitIndex cleared and the others set.
+     */
+    inline uint64_t BitsFrom(unsigned bitIndex)
+    {
+        return (bitIndex >= 64u) ? 0u : (~(uint64_t)0u << bitIndex);
+    }
+
+    /**
+     * @brief Get a mask with bit \c n set if byte \c n of \c word equals \c ch.
+     * @remark Eight bytes at a time in plain C++: the bytes that equal \c ch become zero, the exact zero byte
+     *      test sets their top bit, and the multiplication gathers the top bits into the lowest byte.
+     */
+    inline uint64_t MatchBytes8(uint64_t word, char ch)
+    {
+        const uint64_t low7 = 0x7F7F7F7F7F7F7F7Full;
+        uint64_t diff = word ^ ((uint64_t)(unsigned char)ch * 0x0101010101010101ull);
+        uint64_t zeroBytes = ~(((diff & low7) + low7) | diff | low7);
+        return ((zeroBytes >> 7) * 0x0102040810204080ull) >> 56;
+    }
+
+    void ClassifyBlocksScalar(const char* blocks, size_t blockCount, uint64_t* newLines, uint64_t* colons)
+    {
+        for (size_t block = 0u; block < blockCount; ++block)
+        {
+            const char* chars = blocks + (block * CurlTextScan::BlockSize);
+            uint64_t newLineMask = 0u;
+            uint64_t colonMask = 0u;
+            for (unsigned wordIndex = 0u; wordIndex < 8u; ++wordIndex)
+            {
+                uint64_t word;
+                ::memcpy(&word, chars + (wordIndex * 8u), sizeof(word));
+#if defined __BYTE_ORDER__ && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+                word = __builtin_bswap64(word);
+#endif
+                newLineMask |= MatchBytes8(word, '\n') << (wordIndex * 8u);
+                colonMask |= MatchBytes8(word, ':') << (wordIndex * 8u);
+            }
+            newLines[block] = newLineMask;
+            colons[block] = colonMask;
+        }
+    }
+
+    void ClassifyJsonBlocksScalar(const char* blocks, size_t blockCount, CurlJsonBlockMasks* masks)
+    {
+        for (size_t block = 0u; block < blockCount; ++block)
+        {
+            const char* chars = blocks + (block * CurlTextScan::BlockSize);
+            CurlJsonBlockMasks& blockMasks(masks[block]);
+            blockMasks.quotes = 0u;
+            blockMasks.backslashes = 0u;
+            blockMasks.operators = 0u;
+            blockMasks.whiteSpace = 0u;
+            for (unsigned wordIndex = 0u; wordIndex < 8u; ++wordIndex)
+            {
+                uint64_t word;
+                ::memcpy(&word, chars + (wordIndex * 8u), sizeof(word));
+#if defined __BYTE_ORDER__ && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+                word = __builtin_bswap64(word);
+#endif
+                // '[' and ']' differ from '{' and '}' only in bit 5.
+                const uint64_t folded = word | 0x2020202020202020ull;
+                const unsigned shift = wordIndex * 8u;
+                blockMasks.quotes |= MatchBytes8(word, '"') << shift;
+                blockMasks.backslashes |= MatchBytes8(word, '\\') << shift;
+                blockMasks.operators |= (MatchBytes8(folded, '{') | MatchBytes8(folded, '}') | MatchBytes8(word, ':')
+                    | MatchBytes8(word, ',')) << shift;
+                blockMasks.whiteSpace |= (MatchBytes8(word, ' ') | MatchBytes8(word, '\t') | MatchBytes8(word, '\n')
+                    | MatchBytes8(word, '\r')) << shift;
+            }
+        }
+    }
+
+    /**
+     * @brief Convert the ASCII capitals in eight bytes to lower case, leaving all other bytes alone.
+     */
+    inline uint64_t FoldCase8(uint64_t bytes)
+    {
+        const uint64_t ones = 0x0101010101010101ull;
+        uint64_t low7 = bytes & (0x7Fu * ones);
+
+        // Bit 7 of each byte is set in the sums if the byte is at least 'A' and more than 'Z' respectively.
+        uint64_t atLeastA = low7 + ((0x80u - 'A') * ones);
+        uint64_t aboveZ = low7 + ((0x80u - 'Z' - 1u) * ones);
+        uint64_t isCapital = atLeastA & ~aboveZ & ~bytes & (0x80u * ones);
+        return bytes | (isCapital >> 2);
+    }
+
+    /**
+     * @brief Compare eight bytes, ignoring case.
+     */
+    inline bool EqualsIgnoreCase8(const char* lhs, const char* rhs)
+    {
+        uint64_t lhsBytes;
+        uint64_t rhsBytes;
+        ::memcpy(&lhsBytes, lhs, sizeof(lhsBytes));
+        ::memcpy(&rhsBytes, rhs, sizeof(rhsBytes));
+        return (lhsBytes == rhsBytes) || (FoldCase8(lhsBytes) == FoldCase8(rhsBytes));
+    }
+
+    inline char FoldCase(char ch)
+    {
+        return ((ch >= 'A') && (ch <= 'Z')) ? static_cast<char>(ch + ('a' - 'A')) : ch;
+    }
+
+    bool EqualsIgnoreCaseScalar(const char* lhs, const char* rhs, size_t length)
+    {
+        if (length < 8u)
+        {
+            for (size_t index = 0u; index < length; ++index)
+            {
+                if (FoldCase(lhs[index]) != FoldCase(rhs[index]))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Eight bytes at a time; the last word overlaps the one before it if the length is not a multiple of 8.
+        size_t offset = 0u;
+        for ( ; offset + 8u < length; offset += 8u)
+        {
+            if (!EqualsIgnoreCase8(lhs + offset, rhs + offset))
+            {
+                return false;
+            }
+        }
+        return EqualsIgnoreCase8(lhs + length - 8u, rhs + length - 8u);
+    }
+
+#ifdef AEF_CURL_X86_SIMD
+    void ClassifyBlocksSse2(const char* blocks, size_t blockCount, uint64_t* newLines, uint64_t* colons)
+    {
+        const __m128i newLine = _mm_set1_epi8('\n');
+        const __m128i colon = _mm_set1_epi8(':');
+        for (size_t block = 0u; block < blockCount; ++block)
+        {
+            const char* chars = blocks + (block * CurlTextScan::BlockSize);
+            uint64_t newLineMask = 0u;
+            uint64_t colonMask = 0u;
+            for (unsigned lane = 0u; lane < 4u; ++lane)
+            {
+                __m128i lane16 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + (lane * 16u)));
+                newLineMask |= (uint64_t)(unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(lane16, newLine)) << (lane * 16u);
+                colonMask |= (uint64_t)(unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(lane16, colon)) << (lane * 16u);
+            }
+            newLines[block] = newLineMask;
+            colons[block] = colonMask;
+        }
+    }
+
+    __attribute__((target("avx2")))
+    void ClassifyBlocksAvx2(const char* blocks, size_t blockCount, uint64_t* newLines, uint64_t* colons)
+    {
+        const __m256i newLine = _mm256_set1_epi8('\n');
+        const __m256i colon = _mm256_set1_epi8(':');
+        for (size_t block = 0u; block < blockCount; ++block)
+        {
+            const char* chars = blocks + (block * CurlTextScan::BlockSize);
+            __m256i lowChars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(chars));
+            __m256i highChars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(chars + 32));
+            newLines[block] = (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(lowChars, newLine))
+                | ((uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(highChars, newLine)) << 32);
+            colons[block] = (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(lowChars, colon))
+                | ((uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(highChars, colon)) << 32);
+        }
+    }
+
+    /**
+     * @brief Get the bytes of a vector that equal one of the structural characters, and those that are white space.
+     */
+    inline void ClassifyJson16(__m128i chars, unsigned& quotes, unsigned& backslashes, unsigned& operators, unsigned& whiteSpace)
+    {
+        // '[' and ']' differ from '{' and '}' only in bit 5.
+        __m128i folded = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+        quotes = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(chars, _mm_set1_epi8('"')));
+        backslashes = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(chars, _mm_set1_epi8('\\')));
+        operators = (unsigned)_mm_movemask_epi8(_mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(folded, _mm_set1_epi8('{')), _mm_cmpeq_epi8(folded, _mm_set1_epi8('}'))),
+            _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8(':')), _mm_cmpeq_epi8(chars, _mm_set1_epi8(',')))));
+        whiteSpace = (unsigned)_mm_movemask_epi8(_mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(chars, _mm_set1_epi8('\t'))),
+            _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(chars, _mm_set1_epi8('\r')))));
+    }
+
+    void ClassifyJsonBlocksSse2(const char* blocks, size_t blockCount, CurlJsonBlockMasks* masks)
+    {
+        for (size_t block = 0u; block < blockCount; ++block)
+        {
+            const char* chars = blocks + (block * CurlTextScan::BlockSize);
+            CurlJsonBlockMasks& blockMasks(masks[block]);
+            blockMasks.quotes = 0u;
+            blockMasks.backslashes = 0u;
+            blockMasks.operators = 0u;
+            blockMasks.whiteSpace = 0u;
+            for (unsigned lane = 0u; lane < 4u; ++lane)
+            {
+                unsigned quotes;
+                unsigned backslashes;
+                unsigned operators;
+                unsigned whiteSpace;
+                ClassifyJson16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + (lane * 16u))), quotes, backslashes, operators, whiteSpace);
+                blockMasks.quotes |= (uint64_t)quotes << (lane * 16u);
+                blockMasks.backslashes |= (uint64_t)backslashes << (lane * 16u);
+                blockMasks.operators |= (uint64_t)operators << (lane * 16u);
+                blockMasks.whiteSpace |= (uint64_t)whiteSpace << (lane * 16u);
+            }
+        }
+    }
+
+    /**
+     * @brief Get a mask with bit \c n set if byte \c n of either vector is not zero; the first vector is the low half.
+     */
+    __attribute__((target("avx2")))
+    inline uint64_t Movemask64(__m256i low, __m256i high)
+    {
+        return (uint64_t)(uint32_t)_mm256_movemask_epi8(low) | ((uint64_t)(uint32_t)_mm256_movemask_epi8(high) << 32);
+    }
+
+    __attribute__((target("avx2")))
+    void ClassifyJsonBlocksAvx2(const char* blocks, size_t blockCount, CurlJsonBlockMasks* masks)
+    {
+        const __m256i quote = _mm256_set1_epi8('"');
+        const __m256i backslash = _mm256_set1_epi8('\\');
+        const __m256i openBrace = _mm256_set1_epi8('{');
+        const __m256i closeBrace = _mm256_set1_epi8('}');
+        const __m256i colon = _mm256_set1_epi8(':');
+        const __m256i comma = _mm256_set1_epi8(',');
+        const __m256i bit5 = _mm256_set1_epi8(0x20);
+
+        // White space is looked up by the low nibble: ' ' is 0x20, '\t' 0x09, '\n' 0x0A and '\r' 0x0D, so one
+        // shuffle gives the only white space character that a byte with that low nibble can be.
+        const __m256i whiteSpaceTable = _mm256_setr_epi8(' ', 0, 0, 0, 0, 0, 0, 0, 0, '\t', '\n', 0, 0, '\r', 0, 0,
+            ' ', 0, 0, 0, 0, 0, 0, 0, 0, '\t', '\n', 0, 0, '\r', 0, 0);
+        for (size_t block = 0u; block < blockCount; ++block)
+        {
+            const char* chars = blocks + (block * CurlTextScan::BlockSize);
+            __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(chars));
+            __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(chars + 32));
+            __m256i lowFolded = _mm256_or_si256(low, bit5);
+            __m256i highFolded = _mm256_or_si256(high, bit5);
+
+            CurlJsonBlockMasks& blockMasks(masks[block]);
+            blockMasks.quotes = Movemask64(_mm256_cmpeq_epi8(low, quote), _mm256_cmpeq_epi8(high, quote));
+            blockMasks.backslashes = Movemask64(_mm256_cmpeq_epi8(low, backslash), _mm256_cmpeq_epi8(high, backslash));
+            blockMasks.operators = Movemask64
+            (
+                _mm256_or_si256
+                (
+                    _mm256_or_si256(_mm256_cmpeq_epi8(lowFolded, openBrace), _mm256_cmpeq_epi8(lowFolded, closeBrace)),
+                    _mm256_or_si256(_mm256_cmpeq_epi8(low, colon), _mm256_cmpeq_epi8(low, comma))
+                ),
+                _mm256_or_si256
+                (
+                    _mm256_or_si256(_mm256_cmpeq_epi8(highFolded, openBrace), _mm256_cmpeq_epi8(highFolded, closeBrace)),
+                    _mm256_or_si256(_mm256_cmpeq_epi8(high, colon), _mm256_cmpeq_epi8(high, comma))
+                )
+            );
+
+            // The shuffle gives zero for bytes with the top bit set, which are never white space.
+            blockMasks.whiteSpace = Movemask64
+            (
+                _mm256_cmpeq_epi8(low, _mm256_shuffle_epi8(whiteSpaceTable, low)),
+                _mm256_cmpeq_epi8(high, _mm256_shuffle_epi8(whiteSpaceTable, high))
+            );
+        }
+    }
+
+    /**
+     * @brief Convert the ASCII capitals in 16 bytes to lower case.
+     */
+    inline __m128i FoldCase16(__m128i chars)
+    {
+        // Shift 'A'..'Z' to the bottom of the signed range, so that one signed comparison finds them.
+        __m128i shifted = _mm_add_epi8(chars, _mm_set1_epi8((char)(0x80 - 'A')));
+        __m128i isCapital = _mm_cmplt_epi8(shifted, _mm_set1_epi8((char)(-128 + 26)));
+        return _mm_or_si128(chars, _mm_and_si128(isCapital, _mm_set1_epi8(0x20)));
+    }
+
+    inline bool EqualsIgnoreCase16(const char* lhs, const char* rhs)
+    {
+        __m128i lhsChars = FoldCase16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs)));
+        __m128i rhsChars = FoldCase16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs)));
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(lhsChars, rhsChars)) == 0xFFFF;
+    }
+
+    bool EqualsIgnoreCaseSse2(const char* lhs, const char* rhs, size_t length)
+    {
+        if (length < 16u)
+        {
+            return EqualsIgnoreCaseScalar(lhs, rhs, length);
+        }
+
+        size_t offset = 0u;
+        for ( ; offset + 16u < length; offset += 16u)
+        {
+            if (!EqualsIgnoreCase16(lhs + offset, rhs + offset))
+            {
+                return false;
+            }
+        }
+        return EqualsIgnoreCase16(lhs + length - 16u, rhs + length - 16u);
+    }
+#endif
+}
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        // Start with the scalar code, which needs no dynamic initialisation, and upgrade below.
+        CurlTextScan::ClassifyBlocksFunction CurlTextScan::_classifyBlocks = ClassifyBlocksScalar;
+        CurlTextScan::ClassifyJsonBlocksFunction CurlTextScan::_classifyJsonBlocks = ClassifyJsonBlocksScalar;
+        CurlSimdLevel CurlTextScan::_simdLevel = CURL_SIMD_SCALAR;
+
+        namespace
+        {
+            const CurlSimdLevel InitialSimdLevel = CurlTextScan::SetSimdLevel(CURL_SIMD_AVX2);
+        }
+
+        CurlSimdLevel CurlTextScan::GetSimdLevel()
+        {
+            return _simdLevel;
+        }
+
+        CurlSimdLevel CurlTextScan::SetSimdLevel(CurlSimdLevel level)
+        {
+            _classifyBlocks = ClassifyBlocksScalar;
+            _classifyJsonBlocks = ClassifyJsonBlocksScalar;
+            _simdLevel = CURL_SIMD_SCALAR;
+
+#ifdef AEF_CURL_X86_SIMD
+            if (level >= CURL_SIMD_SSE2)
+            {
+                _classifyBlocks = ClassifyBlocksSse2;
+                _classifyJsonBlocks = ClassifyJsonBlocksSse2;
+                _simdLevel = CURL_SIMD_SSE2;
+            }
+
+            if ((level >= CURL_SIMD_AVX2) && __builtin_cpu_supports("avx2"))
+            {
+                _classifyBlocks = ClassifyBlocksAvx2;
+                _classifyJsonBlocks = ClassifyJsonBlocksAvx2;
+                _simdLevel = CURL_SIMD_AVX2;
+            }
+#else
+            (void)level;
+#endif
+            return _simdLevel;
+        }
+
+        bool CurlTextScan::EqualsIgnoreCase(const char* lhs, const char* rhs, size_t length)
+        {
+#ifdef AEF_CURL_X86_SIMD
+            // Header names are short, so 16 byte vectors are enough; AVX2 would not pay for itself here.
+            if (_simdLevel >= CURL_SIMD_SSE2)
+            {
+                return EqualsIgnoreCaseSse2(lhs, rhs, length);
+            }
+#endif
+            return EqualsIgnoreCaseScalar(lhs, rhs, length);
+        }
+
+        CurlLineScanner::CurlLineScanner(const char* data, size_t size)
+            :   _data(data),
+                _size(size),
+                _lineStart(0u),
+                _blockStart(0u),
+                _newLines(0u),
+                _colons(0u),
+                _batchIndex(0u),
+                _batchCount(0u)
+        {
+            if (size > 0u)
+            {
+                LoadBlock();
+            }
+        }
+
+        bool CurlLineScanner::NextLineAcrossBlocks(size_t& lineStart, size_t& lineEnd, size_t& colon)
+        {
+            if (this->_lineStart >= this->_size)
+            {
+                return false;
+            }
+
+            lineStart = this->_lineStart;
+            colon = this->_size;
+            bool colonFound = false;
+            for (;;)
+            {
+                unsigned newLineBit = (this->_newLines != 0u) ? LowestBit(this->_newLines) : 64u;
+                if (!colonFound && (this->_colons != 0u))
+                {
+                    unsigned colonBit = LowestBit(this->_colons);
+                    if (colonBit < newLineBit)
+                    {
+                        colon = this->_blockStart + colonBit;
+                        colonFound = true;
+                    }
+                }
+
+                if (newLineBit < 64u)
+                {
+                    // Consume everything up to and including the line feed.
+                    lineEnd = this->_blockStart + newLineBit;
+                    this->_newLines &= BitsFrom(newLineBit + 1u);
+                    this->_colons &= BitsFrom(newLineBit + 1u);
+                    this->_lineStart = lineEnd + 1u;
+                    if (!colonFound)
+                    {
+                        colon = lineEnd;
+                    }
+                    return true;
+                }
+
+                // The line continues in the next block.
+                this->_blockStart += CurlTextScan::BlockSize;
+                if (this->_blockStart >= this->_size)
+                {
+                    lineEnd = this->_size;
+                    this->_lineStart = this->_size;
+                    if (!colonFound)
+                    {
+                        colon = lineEnd;
+                    }
+                    return true;
+                }
+                LoadBlock();
+            }
+        }
+
+        void CurlLineScanner::LoadBlock()
+        {
+            if (++this->_batchIndex >= this->_batchCount)
+            {
+                // Classify the next batch of whole blocks, or the end of the text padded to a full block.
+                this->_batchIndex = 0u;
+                size_t remaining = this->_size - this->_blockStart;
+                if (remaining >= CurlTextScan::BlockSize)
+                {
+                    size_t wholeBlocks = remaining / CurlTextScan::BlockSize;
+                    this->_batchCount = (wholeBlocks < BatchBlocks) ? wholeBlocks : BatchBlocks;
+                    CurlTextScan::ClassifyBlocks(this->_data + this->_blockStart, this->_batchCount, this->_batchNewLines, this->_batchColons);
+                }
+                else
+                {
+                    // The padding matches nothing.
+                    char tail[CurlTextScan::BlockSize] = { 0 };
+                    ::memcpy(tail, this->_data + this->_blockStart, remaining);
+                    this->_batchCount = 1u;
+                    CurlTextScan::ClassifyBlocks(tail, 1u, this->_batchNewLines, this->_batchColons);
+                }
+            }
+
+            this->_newLines = this->_batchNewLines[this->_batchIndex];
+            this->_colons = this->_batchColons[this->_batchIndex];
+        }
+    } // namespace Web
+} // namespace AbcdEFramework
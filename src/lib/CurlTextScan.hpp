@@ -0,0 +1,201 @@
+/**
+ * @file
+ * @brief Declaration of the text scanning routines used to parse HTTP headers and JSON.
+ * @date 2026-10-19 [JFDR] Created.
+ * @date 2026-10-19 [JFDR] Added ClassifyJsonBlocks().
+ */
+#if !defined CURL_TEXT_SCAN_7D21C4E08B9A4F6E8C3A51F0E2B94D67
+#define CURL_TEXT_SCAN_7D21C4E08B9A4F6E8C3A51F0E2B94D67 1
+
+#include <cstddef>
+#include <cstdint>
+
+namespace AbcdEFramework
+{
+    namespace Web
+    {
+        /**
+         * @brief Instruction set used by \c CurlTextScan.
+         */
+        enum CurlSimdLevel
+        {
+            CURL_SIMD_SCALAR = 0, ///< Plain C++, one 64 bit word at a time.
+            CURL_SIMD_SSE2, ///< 16 bytes at a time. Always available on x86-64.
+            CURL_SIMD_AVX2 ///< 32 bytes at a time. Used if the processor supports it.
+        };
+
+        /**
+         * @brief The characters of interest in a block of JSON text, one bit per byte.
+         */
+        struct CurlJsonBlockMasks
+        {
+            uint64_t quotes; ///< Double quotes.
+            uint64_t backslashes; ///< Backslashes.
+            uint64_t operators; ///< The structural characters <tt>{ } [ ] : ,</tt>
+            uint64_t whiteSpace; ///< Spaces, tabs, carriage returns and line feeds.
+        };
+
+        /**
+         * @brief Vectorised routines for scanning header and JSON text.
+         * @remark The best instruction set is selected once, when the program starts, from what the processor
+         *      supports. On processors other than x86 the scalar code is used. Define \c AEF_CURL_NO_SIMD to build
+         *      the scalar code only.
+         */
+        class CurlTextScan
+        {
+            public:
+                /**
+                 * @brief Number of bytes in a block classified by \c ClassifyBlocks().
+                 */
+                static const size_t BlockSize = 64u;
+
+            public:
+                /**
+                 * @brief Get the instruction set in use.
+                 */
+                static CurlSimdLevel GetSimdLevel();
+
+                /**
+                 * @brief Select the instruction set, e.g. to compare them in a benchmark.
+                 * @remark Not thread safe; call it before any transfer starts.
+                 * @return The level in use, which is lower than \c level if the processor does not support it.
+                 */
+                static CurlSimdLevel SetSimdLevel(CurlSimdLevel level);
+
+                /**
+                 * @brief Find the line feeds and colons in consecutive blocks of \c BlockSize bytes.
+                 * @param blocks The bytes. All \c blockCount * \c BlockSize bytes must be readable.
+                 * @param blockCount Number of blocks.
+                 * @param newLines Receives one mask per block with bit \c n set if byte \c n is a line feed.
+                 * @param colons Receives one mask per block with bit \c n set if byte \c n is a colon.
+                 */
+                static inline void ClassifyBlocks(const char* blocks, size_t blockCount, uint64_t* newLines, uint64_t* colons);
+
+                /**
+                 * @brief Find the characters that delimit JSON tokens in consecutive blocks of \c BlockSize bytes.
+                 * @param blocks The bytes. All \c blockCount * \c BlockSize bytes must be readable.
+                 * @param blockCount Number of blocks.
+                 * @param masks Receives the masks of each block. Strings are not taken into account; that is up to
+                 *      the caller.
+                 */
+                static inline void ClassifyJsonBlocks(const char* blocks, size_t blockCount, CurlJsonBlockMasks* masks);
+
+                /**
+                 * @brief Compare two strings of the same length, ignoring the case of ASCII letters.
+                 */
+                static bool EqualsIgnoreCase(const char* lhs, const char* rhs, size_t length);
+
+            private:
+                typedef void (*ClassifyBlocksFunction)(const char* blocks, size_t blockCount, uint64_t* newLines, uint64_t* colons);
+                typedef void (*ClassifyJsonBlocksFunction)(const char* blocks, size_t blockCount, CurlJsonBlockMasks* masks);
+
+                static ClassifyBlocksFunction _classifyBlocks; ///< Implementation of \c ClassifyBlocks() in use.
+                static ClassifyJsonBlocksFunction _classifyJsonBlocks; ///< Implementation of \c ClassifyJsonBlocks() in use.
+                static CurlSimdLevel _simdLevel; ///< The level that \c _classifyBlocks belongs to.
+        };
+
+        /**
+         * @brief Splits header text into lines and finds the first colon on each line.
+         * @remark The text is classified up to \c BatchBlocks blocks of 64 bytes at a time with
+         *      \c CurlTextScan::ClassifyBlocks(), and lines and colons are then found by counting trailing zero
+         *      bits, so the work per line does not depend on its length and has no data dependent branches.
+         */
+        class CurlLineScanner
+        {
+            private:
+                static const size_t BatchBlocks = 16u; ///< Number of blocks classified at a time.
+
+            private:
+                const char* _data; ///< The text.
+                size_t _size; ///< Number of characters in the text.
+                size_t _lineStart; ///< Offset of the next line.
+                size_t _blockStart; ///< Offset of the block that the masks describe.
+                uint64_t _newLines; ///< Line feeds in the block that were not consumed yet.
+                uint64_t _colons; ///< Colons in the block that were not consumed yet.
+                size_t _batchIndex; ///< Index of the current block in the batch.
+                size_t _batchCount; ///< Number of blocks in the batch.
+                uint64_t _batchNewLines[BatchBlocks]; ///< Line feed masks of the batch.
+                uint64_t _batchColons[BatchBlocks]; ///< Colon masks of the batch.
+
+            public:
+                /**
+                 * @brief Start scanning \c size characters at \c data.
+                 */
+                CurlLineScanner(const char* data, size_t size);
+
+            public:
+                /**
+                 * @brief Get the next line.
+                 * @param lineStart Receives the offset of the first character of the line.
+                 * @param lineEnd Receives the offset of the line feed, or the size of the text for a last line
+                 *      without one. A carriage return before the line feed is part of the line.
+                 * @param colon Receives the offset of the first colon on the line, or \c lineEnd if there is none.
+                 * @return \c false if there are no more lines.
+                 */
+                inline bool NextLine(size_t& lineStart, size_t& lineEnd, size_t& colon);
+
+            private:
+                /**
+                 * @brief Get the next line if it does not end in the current block.
+                 */
+                bool NextLineAcrossBlocks(size_t& lineStart, size_t& lineEnd, size_t& colon);
+
+                /**
+                 * @brief Get the index of the lowest set bit. \c mask must not be zero.
+                 */
+                static inline unsigned LowestBit(uint64_t mask);
+
+                /**
+                 * @brief Load the masks of the block at \c _blockStart, classifying the next batch if needed.
+                 */
+                void LoadBlock();
+        };
+
+        inline void CurlTextScan::ClassifyBlocks(const char* blocks, size_t blockCount, uint64_t* newLines, uint64_t* colons)
+        {
+            _classifyBlocks(blocks, blockCount, newLines, colons);
+        }
+
+        inline void CurlTextScan::ClassifyJsonBlocks(const char* blocks, size_t blockCount, CurlJsonBlockMasks* masks)
+        {
+            _classifyJsonBlocks(blocks, blockCount, masks);
+        }
+
+        inline bool CurlLineScanner::NextLine(size_t& lineStart, size_t& lineEnd, size_t& colon)
+        {
+            if (0u == this->_newLines)
+            {
+                return NextLineAcrossBlocks(lineStart, lineEnd, colon);
+            }
+
+            // The line ends in this block. Header lines are short, so this is the common case, and it has no
+            // branches that depend on the data.
+            uint64_t lineBits = this->_newLines ^ (this->_newLines - 1u); // Bits up to and including the line feed
+            uint64_t lineColons = this->_colons & lineBits;
+            lineStart = this->_lineStart;
+            lineEnd = this->_blockStart + LowestBit(this->_newLines);
+            colon = (lineColons != 0u) ? this->_blockStart + LowestBit(lineColons) : lineEnd;
+            this->_newLines &= ~lineBits;
+            this->_colons &= ~lineBits;
+            this->_lineStart = lineEnd + 1u;
+            return true;
+        }
+
+        inline unsigned CurlLineScanner::LowestBit(uint64_t mask)
+        {
+#ifdef __GNUC__
+            return (unsigned)__builtin_ctzll(mask);
+#else
+            unsigned index = 0u;
+            while ((mask & 1u) == 0u)
+            {
+                mask >>= 1;
+                ++index;
+            }
+            return index;
+#endif
+        }
+    } // namespace Web
+} // namespace AbcdEFramework
+
+#endif // CURL_TEXT_SCAN_7D21C4E08B9A4F6E8C3A51F0E2B94D67
@@ -0,0 +1,243 @@
+/**
+ * @file
+ * @brief Checks of CurlJsonNumbers: printed numbers read back with the same bits, reading agrees with strtod(), and
+ *      the edge cases of the integer and double layouts. Run by make check.
+ * @date 2026-10-19 [JFDR] Created.
+ */
+
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <json.hpp>
+#include <CurlJsonNumbers.hpp>
+
+using std::cerr;
+using std::endl;
+using std::string;
+using AbcdEFramework::Web::CurlJsonNumbers;
+using json = nlohmann::json;
+
+namespace
+{
+    int failures = 0; ///< Number of checks that failed.
+
+    /**
+     * @brief Count a failed check and print what it was.
+     */
+    void Check(bool passed, const string& what)
+    {
+        if (!passed)
+        {
+            cerr << "FAIL: " << what << endl;
+            ++failures;
+        }
+    }
+
+    /**
+     * @brief Test whether two doubles have the same bits, so that 0.0 and -0.0 differ.
+     */
+    bool SameBits(double a, double b)
+    {
+        return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+
+    /**
+     * @brief Get the next number of a xorshift generator.
+     */
+    uint64_t NextRandom(uint64_t& state)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+
+    /**
+     * @brief Print a double and check the text, and that it reads back with the same bits.
+     * @param expected The expected text, or \c nullptr to only check the round trip.
+     */
+    void CheckDouble(double value, const char* expected)
+    {
+        char buffer[CurlJsonNumbers::MaxFormattedSize];
+        char full[32];
+        std::snprintf(full, sizeof(full), "%.17g", value);
+        if (!CurlJsonNumbers::TryFormat(value, buffer))
+        {
+            Check(false, string("TryFormat(") + full + ") failed");
+            return;
+        }
+        if (expected != nullptr)
+        {
+            Check(::strcmp(buffer, expected) == 0, string("TryFormat(") + full + ") gave " + buffer + " instead of " + expected);
+        }
+
+        Check(SameBits(std::strtod(buffer, nullptr), value), string("strtod(") + buffer + ") does not give " + full);
+        double parsed;
+        if (CurlJsonNumbers::TryParse(buffer, buffer + ::strlen(buffer), parsed))
+        {
+            Check(SameBits(parsed, value), string("TryParse(") + buffer + ") does not give " + full);
+        }
+    }
+
+    /**
+     * @brief Check that reading a text gives the same double as \c strtod(), unless the text is left to it.
+     */
+    void CheckParse(const char* text)
+    {
+        double parsed;
+        if (CurlJsonNumbers::TryParse(text, text + ::strlen(text), parsed))
+        {
+            Check(SameBits(parsed, std::strtod(text, nullptr)), string("TryParse(") + text + ") differs from strtod()");
+        }
+    }
+
+    /**
+     * @brief Print random doubles of every exponent and decimal values, and read them back, also with 17 digits.
+     */
+    void CheckDoubleDifferential(size_t count)
+    {
+        uint64_t state = 88172645463325252ull;
+        char full[32];
+        for (size_t index = 0u; index < count; ++index)
+        {
+            uint64_t random = NextRandom(state);
+            double value;
+            switch (index % 3u)
+            {
+                case 0u:
+                    value = (double)(random % 10000000u) / 100.0;
+                    break;
+                case 1u:
+                    value = (double)(int64_t)random * 1e-6;
+                    break;
+                default:
+                    std::memcpy(&value, &random, sizeof(value));
+                    break;
+            }
+            if (!std::isfinite(value))
+            {
+                char buffer[CurlJsonNumbers::MaxFormattedSize];
+                Check(!CurlJsonNumbers::TryFormat(value, buffer), "TryFormat() accepted a value that is not finite");
+                continue;
+            }
+
+            CheckDouble(value, nullptr);
+            std::snprintf(full, sizeof(full), "%.17g", value);
+            CheckParse(full);
+        }
+    }
+
+    /**
+     * @brief Print random integers and compare them with \c snprintf(), and read them back.
+     */
+    void CheckIntegerDifferential(size_t count)
+    {
+        uint64_t state = 2463534242ull;
+        char buffer[CurlJsonNumbers::MaxFormattedSize];
+        char expected[32];
+        for (size_t index = 0u; index < count; ++index)
+        {
+            // Shift the values down now and then, so that every number of digits is tried.
+            const uint64_t unsignedValue = NextRandom(state) >> (index % 64u);
+            const int64_t signedValue = (index % 2u) ? -(int64_t)(unsignedValue >> 1) : (int64_t)(unsignedValue >> 1);
+
+            CurlJsonNumbers::TryFormat(unsignedValue, buffer);
+            std::snprintf(expected, sizeof(expected), "%" PRIu64, unsignedValue);
+            Check(::strcmp(buffer, expected) == 0, string("TryFormat(") + expected + ") gave " + buffer);
+            uint64_t unsignedParsed = 0u;
+            Check(CurlJsonNumbers::TryParse(buffer, buffer + ::strlen(buffer), unsignedParsed) && (unsignedParsed == unsignedValue), string("TryParse(") + buffer + ") as uint64_t");
+
+            CurlJsonNumbers::TryFormat(signedValue, buffer);
+            std::snprintf(expected, sizeof(expected), "%" PRId64, signedValue);
+            Check(::strcmp(buffer, expected) == 0, string("TryFormat(") + expected + ") gave " + buffer);
+            int64_t signedParsed = 0;
+            Check(CurlJsonNumbers::TryParse(buffer, buffer + ::strlen(buffer), signedParsed) && (signedParsed == signedValue), string("TryParse(") + buffer + ") as int64_t");
+        }
+    }
+
+    /**
+     * @brief Check the limits of the integer types.
+     */
+    void CheckIntegerLimits()
+    {
+        char buffer[CurlJsonNumbers::MaxFormattedSize];
+        const char* text;
+
+        Check(CurlJsonNumbers::TryFormat((int64_t)INT64_MIN, buffer) && (::strcmp(buffer, "-9223372036854775808") == 0), "TryFormat(INT64_MIN)");
+        int64_t signedValue = 0;
+        text = "-9223372036854775808";
+        Check(CurlJsonNumbers::TryParse(text, text + ::strlen(text), signedValue) && (INT64_MIN == signedValue), "TryParse(INT64_MIN)");
+        text = "-9223372036854775809";
+        Check(!CurlJsonNumbers::TryParse(text, text + ::strlen(text), signedValue), "TryParse(INT64_MIN - 1) must not fit");
+        text = "9223372036854775808";
+        Check(!CurlJsonNumbers::TryParse(text, text + ::strlen(text), signedValue), "TryParse(INT64_MAX + 1) must not fit");
+
+        Check(CurlJsonNumbers::TryFormat((uint64_t)UINT64_MAX, buffer) && (::strcmp(buffer, "18446744073709551615") == 0), "TryFormat(UINT64_MAX)");
+        uint64_t unsignedValue = 0u;
+        text = "18446744073709551615";
+        Check(CurlJsonNumbers::TryParse(text, text + ::strlen(text), unsignedValue) && (UINT64_MAX == unsignedValue), "TryParse(UINT64_MAX)");
+        text = "18446744073709551616";
+        Check(!CurlJsonNumbers::TryParse(text, text + ::strlen(text), unsignedValue), "TryParse(UINT64_MAX + 1) must not fit");
+        text = "-1";
+        Check(!CurlJsonNumbers::TryParse(text, text + ::strlen(text), unsignedValue), "TryParse(-1) as uint64_t must fail");
+
+        Check(CurlJsonNumbers::TryFormat((int64_t)0, buffer) && (::strcmp(buffer, "0") == 0), "TryFormat(0)");
+
+        // json.hpp keeps the type of each and prints them back the same.
+        const string document("[-9223372036854775808,18446744073709551615,0]");
+        Check(json::parse(document).dump() == document, "json round trip of the integer limits");
+    }
+
+    /**
+     * @brief Check the doubles at the edges: the smallest denormal, negative zero and the switch to an exponent.
+     */
+    void CheckDoubleEdgeCases()
+    {
+        CheckDouble(5e-324, "5e-324");
+        CheckDouble(2.2250738585072014e-308, "2.2250738585072014e-308");
+        CheckDouble(1.7976931348623157e308, "1.7976931348623157e+308");
+        CheckParse("4.9406564584124654e-324");
+        CheckParse("2.4703282292062327e-324");
+        CheckParse("2.4703282292062328e-324");
+
+        CheckDouble(-0.0, "-0.0");
+        CheckDouble(0.0, "0.0");
+        double parsed = 1.0;
+        const char* text = "-0.0";
+        Check(CurlJsonNumbers::TryParse(text, text + ::strlen(text), parsed) && (0.0 == parsed) && std::signbit(parsed), "TryParse(-0.0) must keep the sign");
+
+        // The layout of %.15g with .0 added to whole numbers: an exponent from 1e15 on and below 1e-4.
+        CheckDouble(1e15, "1e+15");
+        CheckDouble(1e14, "100000000000000.0");
+        CheckDouble(999999999999999.0, "999999999999999.0");
+        CheckDouble(1234567890123456.0, "1.234567890123456e+15");
+        CheckDouble(1e16, "1e+16");
+        CheckDouble(0.0001, "0.0001");
+        CheckDouble(1e-5, "1e-05");
+        CheckDouble(0.1, "0.1");
+        CheckDouble(2.0, "2.0");
+        CheckDouble(-1.5e-7, "-1.5e-07");
+
+        const string document("[5e-324,-0.0,1e+15,100000000000000.0,1.7976931348623157e+308]");
+        Check(json::parse(document).dump() == document, "json round trip of the double edge cases");
+    }
+}
+
+int main()
+{
+    CheckIntegerLimits();
+    CheckDoubleEdgeCases();
+    CheckIntegerDifferential(200000u);
+    CheckDoubleDifferential(300000u);
+
+    if (failures != 0)
+    {
+        cerr << failures << " checks failed" << endl;
+        return 1;
+    }
+    return 0;
+}